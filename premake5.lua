@@ -177,24 +177,36 @@ group ""
 -- Tests
 -- ========================
 include "test/Catch2Common.lua"
+include "test/CryptographyTests.lua"
 include "test/ObjCommonTestUtils.lua"
 include "test/ObjCommonTests.lua"
 include "test/ObjCompilingTests.lua"
 include "test/ObjLoadingTests.lua"
+include "test/ObjWritingTests.lua"
 include "test/ParserTestUtils.lua"
 include "test/ParserTests.lua"
+include "test/ZoneBenchmarks.lua"
 include "test/ZoneCodeGeneratorLibTests.lua"
 include "test/ZoneCommonTests.lua"
+include "test/ZoneLoadingTests.lua"
 
 -- Tests group: Unit test and other tests projects
 group "Tests"
     Catch2Common:project()
+    CryptographyTests:project()
     ObjCommonTestUtils:project()
     ObjCommonTests:project()
     ObjCompilingTests:project()
     ObjLoadingTests:project()
+    ObjWritingTests:project()
     ParserTestUtils:project()
     ParserTests:project()
     ZoneCodeGeneratorLibTests:project()
     ZoneCommonTests:project()
+    ZoneLoadingTests:project()
+group ""
+
+-- Benchmarks group: Throughput measurements that are not run as part of the tests
+group "Benchmarks"
+    ZoneBenchmarks:project()
 group ""
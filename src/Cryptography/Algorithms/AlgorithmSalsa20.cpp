@@ -1,5 +1,7 @@
 #include "AlgorithmSalsa20.h"
 
+#include "Internal/CpuFeatures.h"
+#include "Internal/Salsa20Simd.h"
 #include "salsa20.h"
 
 #include <cassert>
@@ -29,10 +31,37 @@ namespace
 
         void Process(const void* plainText, void* cipherText, const size_t amount) override
         {
-            Salsa20_Encrypt_Bytes(&m_context, static_cast<const uint8_t*>(plainText), static_cast<uint8_t*>(cipherText), static_cast<uint32_t>(amount));
+            auto* in = static_cast<const uint8_t*>(plainText);
+            auto* out = static_cast<uint8_t*>(cipherText);
+            auto remaining = amount;
+
+            // Encrypt as many full blocks as possible in parallel, the rest has to go through the reference implementation
+            // since it discards the remaining key stream of a partially used block
+            const auto& cpuFeatures = internal::CpuFeatures::Get();
+            if (cpuFeatures.m_avx2)
+                ProcessBlocks<internal::SALSA20_AVX2_BLOCK_COUNT>(internal::Salsa20EncryptBlocksAvx2, in, out, remaining);
+            if (cpuFeatures.m_sse2)
+                ProcessBlocks<internal::SALSA20_SSE2_BLOCK_COUNT>(internal::Salsa20EncryptBlocksSse2, in, out, remaining);
+
+            Salsa20_Encrypt_Bytes(&m_context, in, out, static_cast<uint32_t>(remaining));
         }
 
     private:
+        template<size_t BlockCount>
+        void ProcessBlocks(void (*encryptBlocks)(uint32_t*, const uint8_t*, uint8_t*, size_t), const uint8_t*& in, uint8_t*& out, size_t& remaining)
+        {
+            const auto blockCount = remaining / internal::SALSA20_BLOCK_SIZE / BlockCount * BlockCount;
+            if (blockCount == 0)
+                return;
+
+            encryptBlocks(m_context.m_input, in, out, blockCount);
+
+            const auto processedSize = blockCount * internal::SALSA20_BLOCK_SIZE;
+            in += processedSize;
+            out += processedSize;
+            remaining -= processedSize;
+        }
+
         salsa20_ctx m_context{};
     };
 } // namespace
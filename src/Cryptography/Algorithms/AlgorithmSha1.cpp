@@ -1,14 +1,18 @@
 #include "AlgorithmSha1.h"
 
+#include "Internal/CpuFeatures.h"
 #include "Internal/CryptoLibrary.h"
+#include "Internal/ShaNi.h"
 
 #include <cstdint>
+#include <iterator>
 
 using namespace cryptography;
 
 namespace
 {
     constexpr int HASH_SIZE = 20;
+    constexpr uint32_t INITIAL_STATE[]{0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
 
     class AlgorithmSha1 final : public IHashFunction
     {
@@ -49,6 +53,9 @@ namespace cryptography
 {
     std::unique_ptr<IHashFunction> CreateSha1()
     {
+        if (internal::CpuFeatures::Get().m_sha)
+            return std::make_unique<internal::ShaHashFunction<std::size(INITIAL_STATE)>>(INITIAL_STATE, internal::Sha1CompressShaNi);
+
         return std::make_unique<AlgorithmSha1>();
     }
 } // namespace cryptography
@@ -1,14 +1,18 @@
 #include "AlgorithmSha256.h"
 
+#include "Internal/CpuFeatures.h"
 #include "Internal/CryptoLibrary.h"
+#include "Internal/ShaNi.h"
 
 #include <cstdint>
+#include <iterator>
 
 using namespace cryptography;
 
 namespace
 {
     constexpr int HASH_SIZE = 32;
+    constexpr uint32_t INITIAL_STATE[]{0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
 
     class AlgorithmSha256 final : public IHashFunction
     {
@@ -49,6 +53,9 @@ namespace cryptography
 {
     std::unique_ptr<IHashFunction> CreateSha256()
     {
+        if (internal::CpuFeatures::Get().m_sha)
+            return std::make_unique<internal::ShaHashFunction<std::size(INITIAL_STATE)>>(INITIAL_STATE, internal::Sha256CompressShaNi);
+
         return std::make_unique<AlgorithmSha256>();
     }
 } // namespace cryptography
@@ -0,0 +1,84 @@
+#include "CpuFeatures.h"
+
+#ifdef CRYPTOGRAPHY_X86_INTRINSICS
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#include <cstdint>
+
+namespace
+{
+#ifdef CRYPTOGRAPHY_X86_INTRINSICS
+    void Cpuid(const unsigned leaf, const unsigned subLeaf, uint32_t (&registers)[4])
+    {
+#ifdef _MSC_VER
+        int values[4];
+        __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subLeaf));
+        for (auto i = 0u; i < 4u; i++)
+            registers[i] = static_cast<uint32_t>(values[i]);
+#else
+        if (!__get_cpuid_count(leaf, subLeaf, &registers[0], &registers[1], &registers[2], &registers[3]))
+            registers[0] = registers[1] = registers[2] = registers[3] = 0;
+#endif
+    }
+
+    uint64_t GetEnabledXStateFeatures()
+    {
+#ifdef _MSC_VER
+        return _xgetbv(0);
+#else
+        uint32_t eax, edx;
+        __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return static_cast<uint64_t>(edx) << 32 | eax;
+#endif
+    }
+#endif
+} // namespace
+
+namespace cryptography::internal
+{
+    CpuFeatures::CpuFeatures()
+        : m_sse2(false),
+          m_avx2(false),
+          m_sha(false)
+    {
+#ifdef CRYPTOGRAPHY_X86_INTRINSICS
+        uint32_t registers[4];
+        Cpuid(0, 0, registers);
+        const auto maxLeaf = registers[0];
+
+        Cpuid(1, 0, registers);
+        const auto sse2 = (registers[3] & (1u << 26)) != 0;
+        const auto ssse3 = (registers[2] & (1u << 9)) != 0;
+        const auto sse41 = (registers[2] & (1u << 19)) != 0;
+        const auto osxsave = (registers[2] & (1u << 27)) != 0;
+        const auto avx = (registers[2] & (1u << 28)) != 0;
+
+        // The os must save the ymm registers on context switches as well
+        const auto osSupportsAvx = osxsave && avx && (GetEnabledXStateFeatures() & 0x6u) == 0x6u;
+
+        auto avx2 = false;
+        auto sha = false;
+        if (maxLeaf >= 7)
+        {
+            Cpuid(7, 0, registers);
+            avx2 = (registers[1] & (1u << 5)) != 0;
+            sha = (registers[1] & (1u << 29)) != 0;
+        }
+
+        m_sse2 = sse2;
+        m_avx2 = osSupportsAvx && avx2;
+        m_sha = sha && sse2 && ssse3 && sse41;
+#endif
+    }
+
+    const CpuFeatures& CpuFeatures::Get()
+    {
+        static const CpuFeatures features;
+        return features;
+    }
+} // namespace cryptography::internal
@@ -0,0 +1,31 @@
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CRYPTOGRAPHY_X86_INTRINSICS
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CRYPTOGRAPHY_TARGET(instructionSets) __attribute__((target(instructionSets)))
+#else
+#define CRYPTOGRAPHY_TARGET(instructionSets)
+#endif
+
+namespace cryptography::internal
+{
+    /**
+     * \brief The instruction set extensions of the executing cpu that are relevant to cryptographic algorithms.
+     * Detected once on first use.
+     */
+    class CpuFeatures
+    {
+    public:
+        bool m_sse2;
+        bool m_avx2;
+        bool m_sha;
+
+        static const CpuFeatures& Get();
+
+    private:
+        CpuFeatures();
+    };
+} // namespace cryptography::internal
@@ -0,0 +1,210 @@
+#include "Salsa20Simd.h"
+
+#include "CpuFeatures.h"
+
+#include <cassert>
+
+#ifdef CRYPTOGRAPHY_X86_INTRINSICS
+#include <immintrin.h>
+
+// Salsa20 quarter round on 4 state words, where OP_ADD, OP_XOR and OP_ROTL are defined by the instruction set specific implementation
+#define SALSA20_QUARTER_ROUND(a, b, c, d)                                                                                                                      \
+    b = OP_XOR(b, OP_ROTL(OP_ADD(a, d), 7));                                                                                                                   \
+    c = OP_XOR(c, OP_ROTL(OP_ADD(b, a), 9));                                                                                                                   \
+    d = OP_XOR(d, OP_ROTL(OP_ADD(c, b), 13));                                                                                                                  \
+    a = OP_XOR(a, OP_ROTL(OP_ADD(d, c), 18))
+
+#define SALSA20_DOUBLE_ROUND(x)                                                                                                                                \
+    SALSA20_QUARTER_ROUND(x[0], x[4], x[8], x[12]);                                                                                                            \
+    SALSA20_QUARTER_ROUND(x[5], x[9], x[13], x[1]);                                                                                                            \
+    SALSA20_QUARTER_ROUND(x[10], x[14], x[2], x[6]);                                                                                                           \
+    SALSA20_QUARTER_ROUND(x[15], x[3], x[7], x[11]);                                                                                                           \
+    SALSA20_QUARTER_ROUND(x[0], x[1], x[2], x[3]);                                                                                                             \
+    SALSA20_QUARTER_ROUND(x[5], x[6], x[7], x[4]);                                                                                                             \
+    SALSA20_QUARTER_ROUND(x[10], x[11], x[8], x[9]);                                                                                                           \
+    SALSA20_QUARTER_ROUND(x[15], x[12], x[13], x[14])
+
+namespace
+{
+    uint64_t GetBlockCounter(const uint32_t* state)
+    {
+        return static_cast<uint64_t>(state[9]) << 32 | state[8];
+    }
+
+    void SetBlockCounter(uint32_t* state, const uint64_t counter)
+    {
+        state[8] = static_cast<uint32_t>(counter);
+        state[9] = static_cast<uint32_t>(counter >> 32);
+    }
+} // namespace
+
+namespace cryptography::internal
+{
+#define OP_ADD(a, b) _mm_add_epi32(a, b)
+#define OP_XOR(a, b) _mm_xor_si128(a, b)
+#define OP_ROTL(v, n) _mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - (n)))
+
+    CRYPTOGRAPHY_TARGET("sse2") void Salsa20EncryptBlocksSse2(uint32_t* state, const uint8_t* plainText, uint8_t* cipherText, size_t blockCount)
+    {
+        assert(blockCount % SALSA20_SSE2_BLOCK_COUNT == 0);
+
+        // Every vector holds the same state word of 4 consecutive blocks
+        __m128i input[16];
+        for (auto i = 0u; i < 16u; i++)
+            input[i] = _mm_set1_epi32(static_cast<int>(state[i]));
+
+        auto counter = GetBlockCounter(state);
+        for (; blockCount >= SALSA20_SSE2_BLOCK_COUNT; blockCount -= SALSA20_SSE2_BLOCK_COUNT)
+        {
+            input[8] = _mm_set_epi32(static_cast<int>(counter + 3), static_cast<int>(counter + 2), static_cast<int>(counter + 1), static_cast<int>(counter));
+            input[9] = _mm_set_epi32(static_cast<int>((counter + 3) >> 32),
+                                     static_cast<int>((counter + 2) >> 32),
+                                     static_cast<int>((counter + 1) >> 32),
+                                     static_cast<int>(counter >> 32));
+            counter += SALSA20_SSE2_BLOCK_COUNT;
+
+            __m128i x[16];
+            for (auto i = 0u; i < 16u; i++)
+                x[i] = input[i];
+
+            for (auto round = 0u; round < 20u; round += 2u)
+            {
+                SALSA20_DOUBLE_ROUND(x);
+            }
+
+            for (auto i = 0u; i < 16u; i += 4u)
+            {
+                const auto a = _mm_add_epi32(x[i + 0], input[i + 0]);
+                const auto b = _mm_add_epi32(x[i + 1], input[i + 1]);
+                const auto c = _mm_add_epi32(x[i + 2], input[i + 2]);
+                const auto d = _mm_add_epi32(x[i + 3], input[i + 3]);
+
+                // Transpose to get words i to i + 3 of each block
+                const auto ab0 = _mm_unpacklo_epi32(a, b);
+                const auto ab1 = _mm_unpackhi_epi32(a, b);
+                const auto cd0 = _mm_unpacklo_epi32(c, d);
+                const auto cd1 = _mm_unpackhi_epi32(c, d);
+
+                const __m128i blockWords[SALSA20_SSE2_BLOCK_COUNT]{
+                    _mm_unpacklo_epi64(ab0, cd0),
+                    _mm_unpackhi_epi64(ab0, cd0),
+                    _mm_unpacklo_epi64(ab1, cd1),
+                    _mm_unpackhi_epi64(ab1, cd1),
+                };
+
+                for (auto block = 0u; block < SALSA20_SSE2_BLOCK_COUNT; block++)
+                {
+                    const auto offset = block * SALSA20_BLOCK_SIZE + i * sizeof(uint32_t);
+                    const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&plainText[offset]));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(&cipherText[offset]), _mm_xor_si128(data, blockWords[block]));
+                }
+            }
+
+            plainText += SALSA20_SSE2_BLOCK_COUNT * SALSA20_BLOCK_SIZE;
+            cipherText += SALSA20_SSE2_BLOCK_COUNT * SALSA20_BLOCK_SIZE;
+        }
+
+        SetBlockCounter(state, counter);
+    }
+
+#undef OP_ADD
+#undef OP_XOR
+#undef OP_ROTL
+
+#define OP_ADD(a, b) _mm256_add_epi32(a, b)
+#define OP_XOR(a, b) _mm256_xor_si256(a, b)
+#define OP_ROTL(v, n) _mm256_or_si256(_mm256_slli_epi32(v, n), _mm256_srli_epi32(v, 32 - (n)))
+
+    CRYPTOGRAPHY_TARGET("avx2") void Salsa20EncryptBlocksAvx2(uint32_t* state, const uint8_t* plainText, uint8_t* cipherText, size_t blockCount)
+    {
+        assert(blockCount % SALSA20_AVX2_BLOCK_COUNT == 0);
+
+        // Every vector holds the same state word of 8 consecutive blocks
+        __m256i input[16];
+        for (auto i = 0u; i < 16u; i++)
+            input[i] = _mm256_set1_epi32(static_cast<int>(state[i]));
+
+        auto counter = GetBlockCounter(state);
+        for (; blockCount >= SALSA20_AVX2_BLOCK_COUNT; blockCount -= SALSA20_AVX2_BLOCK_COUNT)
+        {
+            int counterLow[SALSA20_AVX2_BLOCK_COUNT];
+            int counterHigh[SALSA20_AVX2_BLOCK_COUNT];
+            for (auto block = 0u; block < SALSA20_AVX2_BLOCK_COUNT; block++)
+            {
+                counterLow[block] = static_cast<int>(counter + block);
+                counterHigh[block] = static_cast<int>((counter + block) >> 32);
+            }
+            input[8] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counterLow));
+            input[9] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counterHigh));
+            counter += SALSA20_AVX2_BLOCK_COUNT;
+
+            __m256i x[16];
+            for (auto i = 0u; i < 16u; i++)
+                x[i] = input[i];
+
+            for (auto round = 0u; round < 20u; round += 2u)
+            {
+                SALSA20_DOUBLE_ROUND(x);
+            }
+
+            for (auto i = 0u; i < 16u; i += 4u)
+            {
+                const auto a = _mm256_add_epi32(x[i + 0], input[i + 0]);
+                const auto b = _mm256_add_epi32(x[i + 1], input[i + 1]);
+                const auto c = _mm256_add_epi32(x[i + 2], input[i + 2]);
+                const auto d = _mm256_add_epi32(x[i + 3], input[i + 3]);
+
+                // Transpose within both 128 bit lanes, the upper lane holds the words of blocks 4 to 7
+                const auto ab0 = _mm256_unpacklo_epi32(a, b);
+                const auto ab1 = _mm256_unpackhi_epi32(a, b);
+                const auto cd0 = _mm256_unpacklo_epi32(c, d);
+                const auto cd1 = _mm256_unpackhi_epi32(c, d);
+
+                const __m256i blockWords[4]{
+                    _mm256_unpacklo_epi64(ab0, cd0),
+                    _mm256_unpackhi_epi64(ab0, cd0),
+                    _mm256_unpacklo_epi64(ab1, cd1),
+                    _mm256_unpackhi_epi64(ab1, cd1),
+                };
+
+                for (auto block = 0u; block < 4u; block++)
+                {
+                    const auto lowOffset = block * SALSA20_BLOCK_SIZE + i * sizeof(uint32_t);
+                    const auto highOffset = lowOffset + 4u * SALSA20_BLOCK_SIZE;
+
+                    const auto lowData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&plainText[lowOffset]));
+                    const auto highData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&plainText[highOffset]));
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(&cipherText[lowOffset]), _mm_xor_si128(lowData, _mm256_castsi256_si128(blockWords[block])));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(&cipherText[highOffset]), _mm_xor_si128(highData, _mm256_extracti128_si256(blockWords[block], 1)));
+                }
+            }
+
+            plainText += SALSA20_AVX2_BLOCK_COUNT * SALSA20_BLOCK_SIZE;
+            cipherText += SALSA20_AVX2_BLOCK_COUNT * SALSA20_BLOCK_SIZE;
+        }
+
+        SetBlockCounter(state, counter);
+    }
+
+#undef OP_ADD
+#undef OP_XOR
+#undef OP_ROTL
+} // namespace cryptography::internal
+
+#else
+
+namespace cryptography::internal
+{
+    void Salsa20EncryptBlocksSse2(uint32_t* state, const uint8_t* plainText, uint8_t* cipherText, size_t blockCount)
+    {
+        assert(false);
+    }
+
+    void Salsa20EncryptBlocksAvx2(uint32_t* state, const uint8_t* plainText, uint8_t* cipherText, size_t blockCount)
+    {
+        assert(false);
+    }
+} // namespace cryptography::internal
+
+#endif
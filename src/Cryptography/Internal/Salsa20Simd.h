@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cryptography::internal
+{
+    constexpr size_t SALSA20_BLOCK_SIZE = 64;
+    constexpr size_t SALSA20_SSE2_BLOCK_COUNT = 4;
+    constexpr size_t SALSA20_AVX2_BLOCK_COUNT = 8;
+
+    /**
+     * \brief Encrypts multiple full Salsa20 blocks at once and advances the block counter of the state.
+     * Produces the exact same output as encrypting the blocks one after another.
+     * \param state The 16 input words of a Salsa20 context.
+     * \param plainText The data to encrypt. Must be \c blockCount * 64 bytes long.
+     * \param cipherText The buffer to write the encrypted data to. Can be the same as \c plainText.
+     * \param blockCount The amount of blocks to encrypt. Must be a multiple of \c SALSA20_SSE2_BLOCK_COUNT.
+     */
+    void Salsa20EncryptBlocksSse2(uint32_t* state, const uint8_t* plainText, uint8_t* cipherText, size_t blockCount);
+
+    /**
+     * \copydoc Salsa20EncryptBlocksSse2
+     * The amount of blocks must be a multiple of \c SALSA20_AVX2_BLOCK_COUNT.
+     */
+    void Salsa20EncryptBlocksAvx2(uint32_t* state, const uint8_t* plainText, uint8_t* cipherText, size_t blockCount);
+} // namespace cryptography::internal
@@ -0,0 +1,155 @@
+#include "ShaNi.h"
+
+#include "CpuFeatures.h"
+
+#include <cassert>
+
+#ifdef CRYPTOGRAPHY_X86_INTRINSICS
+#include <immintrin.h>
+
+namespace
+{
+    constexpr uint32_t SHA256_ROUND_CONSTANTS[]{
+        0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5, 0xD807AA98, 0x12835B01, 0x243185BE,
+        0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174, 0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA,
+        0x5CB0A9DC, 0x76F988DA, 0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967, 0x27B70A85,
+        0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85, 0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+        0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070, 0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F,
+        0x682E6FF3, 0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+    };
+} // namespace
+
+namespace cryptography::internal
+{
+    CRYPTOGRAPHY_TARGET("sha,sse4.1") void Sha1CompressShaNi(uint32_t* state, const uint8_t* data, size_t blockCount)
+    {
+        const auto byteSwapMask = _mm_set_epi64x(0x0001020304050607LL, 0x08090A0B0C0D0E0FLL);
+
+        auto abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1B);
+        auto e0 = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0);
+
+        for (; blockCount > 0; blockCount--, data += SHA_BLOCK_SIZE)
+        {
+            const auto abcdSave = abcd;
+            const auto eSave = e0;
+
+            __m128i messages[4];
+            __m128i e[2]{e0, _mm_setzero_si128()};
+
+            // Every iteration performs 4 rounds while preparing the message schedule for the following rounds
+            for (auto group = 0; group < 20; group++)
+            {
+                auto& message = messages[group % 4];
+                if (group < 4)
+                    message = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[group * 16])), byteSwapMask);
+
+                auto& currentE = e[group % 2];
+                if (group == 0)
+                    currentE = _mm_add_epi32(currentE, message);
+                else
+                    currentE = _mm_sha1nexte_epu32(currentE, message);
+
+                e[(group + 1) % 2] = abcd;
+
+                if (group >= 3 && group <= 18)
+                    messages[(group + 1) % 4] = _mm_sha1msg2_epu32(messages[(group + 1) % 4], message);
+
+                switch (group / 5)
+                {
+                case 0:
+                    abcd = _mm_sha1rnds4_epu32(abcd, currentE, 0);
+                    break;
+                case 1:
+                    abcd = _mm_sha1rnds4_epu32(abcd, currentE, 1);
+                    break;
+                case 2:
+                    abcd = _mm_sha1rnds4_epu32(abcd, currentE, 2);
+                    break;
+                default:
+                    abcd = _mm_sha1rnds4_epu32(abcd, currentE, 3);
+                    break;
+                }
+
+                if (group >= 1 && group <= 16)
+                    messages[(group + 3) % 4] = _mm_sha1msg1_epu32(messages[(group + 3) % 4], message);
+
+                if (group >= 2 && group <= 17)
+                    messages[(group + 2) % 4] = _mm_xor_si128(messages[(group + 2) % 4], message);
+            }
+
+            e0 = _mm_sha1nexte_epu32(e[0], eSave);
+            abcd = _mm_add_epi32(abcd, abcdSave);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi32(abcd, 0x1B));
+        state[4] = static_cast<uint32_t>(_mm_extract_epi32(e0, 3));
+    }
+
+    CRYPTOGRAPHY_TARGET("sha,sse4.1") void Sha256CompressShaNi(uint32_t* state, const uint8_t* data, size_t blockCount)
+    {
+        const auto byteSwapMask = _mm_set_epi64x(0x0C0D0E0F08090A0BLL, 0x0405060700010203LL);
+
+        // The instructions expect the state to be ordered as ABEF and CDGH
+        const auto dcba = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);
+        const auto hgfe = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B);
+        auto abef = _mm_alignr_epi8(dcba, hgfe, 8);
+        auto cdgh = _mm_blend_epi16(hgfe, dcba, 0xF0);
+
+        for (; blockCount > 0; blockCount--, data += SHA_BLOCK_SIZE)
+        {
+            const auto abefSave = abef;
+            const auto cdghSave = cdgh;
+
+            __m128i messages[4];
+
+            // Every iteration performs 4 rounds while preparing the message schedule for the following rounds
+            for (auto group = 0; group < 16; group++)
+            {
+                auto& message = messages[group % 4];
+                if (group < 4)
+                    message = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[group * 16])), byteSwapMask);
+
+                auto roundInput = _mm_add_epi32(message, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA256_ROUND_CONSTANTS[group * 4])));
+                cdgh = _mm_sha256rnds2_epu32(cdgh, abef, roundInput);
+
+                if (group >= 3 && group <= 14)
+                {
+                    auto& nextMessage = messages[(group + 1) % 4];
+                    nextMessage = _mm_add_epi32(nextMessage, _mm_alignr_epi8(message, messages[(group + 3) % 4], 4));
+                    nextMessage = _mm_sha256msg2_epu32(nextMessage, message);
+                }
+
+                roundInput = _mm_shuffle_epi32(roundInput, 0x0E);
+                abef = _mm_sha256rnds2_epu32(abef, cdgh, roundInput);
+
+                if (group >= 1 && group <= 12)
+                    messages[(group + 3) % 4] = _mm_sha256msg1_epu32(messages[(group + 3) % 4], message);
+            }
+
+            abef = _mm_add_epi32(abef, abefSave);
+            cdgh = _mm_add_epi32(cdgh, cdghSave);
+        }
+
+        const auto feba = _mm_shuffle_epi32(abef, 0x1B);
+        const auto dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), _mm_blend_epi16(feba, dchg, 0xF0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), _mm_alignr_epi8(dchg, feba, 8));
+    }
+} // namespace cryptography::internal
+
+#else
+
+namespace cryptography::internal
+{
+    void Sha1CompressShaNi(uint32_t* state, const uint8_t* data, size_t blockCount)
+    {
+        assert(false);
+    }
+
+    void Sha256CompressShaNi(uint32_t* state, const uint8_t* data, size_t blockCount)
+    {
+        assert(false);
+    }
+} // namespace cryptography::internal
+
+#endif
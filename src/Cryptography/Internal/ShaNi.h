@@ -0,0 +1,130 @@
+#pragma once
+
+#include "IHashFunction.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace cryptography::internal
+{
+    constexpr size_t SHA_BLOCK_SIZE = 64;
+
+    /**
+     * \brief Applies the SHA1 compression function to full blocks using the SHA instruction set extension.
+     */
+    void Sha1CompressShaNi(uint32_t* state, const uint8_t* data, size_t blockCount);
+
+    /**
+     * \brief Applies the SHA256 compression function to full blocks using the SHA instruction set extension.
+     */
+    void Sha256CompressShaNi(uint32_t* state, const uint8_t* data, size_t blockCount);
+
+    /**
+     * \brief Implements the message padding shared by SHA1 and SHA256 on top of a compression function.
+     * \tparam StateWordCount The amount of 32 bit words of the state, which is also the size of the resulting hash.
+     */
+    template<size_t StateWordCount> class ShaHashFunction final : public IHashFunction
+    {
+    public:
+        using compress_func_t = void (*)(uint32_t* state, const uint8_t* data, size_t blockCount);
+
+        ShaHashFunction(const uint32_t (&initialState)[StateWordCount], const compress_func_t compress)
+            : m_state{},
+              m_initial_state{},
+              m_buffer{},
+              m_buffer_size(0u),
+              m_total_size(0u),
+              m_compress(compress)
+        {
+            for (auto i = 0uz; i < StateWordCount; i++)
+                m_initial_state[i] = initialState[i];
+
+            ShaHashFunction::Init();
+        }
+
+        size_t GetHashSize() override
+        {
+            return StateWordCount * sizeof(uint32_t);
+        }
+
+        void Init() override
+        {
+            for (auto i = 0uz; i < StateWordCount; i++)
+                m_state[i] = m_initial_state[i];
+
+            m_buffer_size = 0u;
+            m_total_size = 0u;
+        }
+
+        void Process(const void* input, size_t inputSize) override
+        {
+            auto* data = static_cast<const uint8_t*>(input);
+            m_total_size += inputSize;
+
+            if (m_buffer_size > 0)
+            {
+                const auto copySize = std::min(inputSize, SHA_BLOCK_SIZE - m_buffer_size);
+                std::memcpy(&m_buffer[m_buffer_size], data, copySize);
+                m_buffer_size += copySize;
+                data += copySize;
+                inputSize -= copySize;
+
+                if (m_buffer_size < SHA_BLOCK_SIZE)
+                    return;
+
+                m_compress(m_state, m_buffer, 1);
+                m_buffer_size = 0;
+            }
+
+            const auto blockCount = inputSize / SHA_BLOCK_SIZE;
+            if (blockCount > 0)
+            {
+                m_compress(m_state, data, blockCount);
+                data += blockCount * SHA_BLOCK_SIZE;
+                inputSize -= blockCount * SHA_BLOCK_SIZE;
+            }
+
+            std::memcpy(m_buffer, data, inputSize);
+            m_buffer_size = inputSize;
+        }
+
+        void Finish(void* hashBuffer) override
+        {
+            const auto bitCount = m_total_size * 8u;
+
+            m_buffer[m_buffer_size++] = 0x80;
+            if (m_buffer_size > SHA_BLOCK_SIZE - sizeof(uint64_t))
+            {
+                std::memset(&m_buffer[m_buffer_size], 0, SHA_BLOCK_SIZE - m_buffer_size);
+                m_compress(m_state, m_buffer, 1);
+                m_buffer_size = 0;
+            }
+
+            std::memset(&m_buffer[m_buffer_size], 0, SHA_BLOCK_SIZE - sizeof(uint64_t) - m_buffer_size);
+            for (auto i = 0uz; i < sizeof(uint64_t); i++)
+                m_buffer[SHA_BLOCK_SIZE - 1 - i] = static_cast<uint8_t>(bitCount >> (i * 8u));
+            m_compress(m_state, m_buffer, 1);
+
+            auto* hash = static_cast<uint8_t*>(hashBuffer);
+            for (auto i = 0uz; i < StateWordCount; i++)
+            {
+                hash[i * 4 + 0] = static_cast<uint8_t>(m_state[i] >> 24);
+                hash[i * 4 + 1] = static_cast<uint8_t>(m_state[i] >> 16);
+                hash[i * 4 + 2] = static_cast<uint8_t>(m_state[i] >> 8);
+                hash[i * 4 + 3] = static_cast<uint8_t>(m_state[i]);
+            }
+
+            m_buffer_size = 0;
+        }
+
+    private:
+        uint32_t m_state[StateWordCount];
+        uint32_t m_initial_state[StateWordCount];
+        uint8_t m_buffer[SHA_BLOCK_SIZE];
+        size_t m_buffer_size;
+        uint64_t m_total_size;
+        compress_func_t m_compress;
+    };
+} // namespace cryptography::internal
@@ -7,9 +7,10 @@
 #include "SearchPath/OutputPathFilesystem.h"
 #include "SearchPath/SearchPaths.h"
 #include "Utils/ObjFileStream.h"
+#include "Utils/Tracing.h"
 #include "Zone/AssetList/AssetList.h"
-#include "Zone/AssetList/AssetListReader.h"
 #include "Zone/Definition/ZoneDefinitionStream.h"
+#include "ZoneCreation/IgnoredAssetCache.h"
 #include "ZoneCreation/ZoneCreationContext.h"
 #include "ZoneCreation/ZoneCreator.h"
 #include "ZoneLoading.h"
@@ -73,6 +74,11 @@ namespace
             m_game_specific_search_paths.reset();
         }
 
+        void Invalidate()
+        {
+            m_search_paths.Invalidate();
+        }
+
     private:
         const ILinkerSearchPathBuilder& m_search_path_builder;
         std::unique_ptr<ISearchPath> m_independent_search_paths;
@@ -92,6 +98,16 @@ namespace
         {
         }
 
+        /**
+         * \brief Makes all search paths notice files that were written while building, e.g. built zones that following targets may reference.
+         */
+        void InvalidateSearchPaths()
+        {
+            m_asset_paths.Invalidate();
+            m_gdt_paths.Invalidate();
+            m_source_paths.Invalidate();
+        }
+
         std::unique_ptr<ILinkerPaths> m_linker_paths;
         LinkerSearchPathContext m_asset_paths;
         LinkerSearchPathContext m_gdt_paths;
@@ -182,53 +198,50 @@ class LinkerImpl final : public Linker
         return zoneDefinition;
     }
 
-    bool ReadIgnoreEntries(LinkerPathManager& paths, const std::string& zoneName, const GameId game, AssetList& assetList) const
+    std::shared_ptr<const IgnoredAssetCache::ZoneAssets>
+        ReadIgnoreEntries(LinkerPathManager& paths, const std::string& zoneName, const GameId game, const fs::path& cacheDir)
     {
-        {
-            AssetListReader assetListReader(paths.m_source_paths.GetSearchPaths(), game);
-            const auto maybeReadAssetList = assetListReader.ReadAssetList(zoneName, false);
-            if (maybeReadAssetList)
-            {
-                assetList.m_entries.reserve(assetList.m_entries.size() + maybeReadAssetList->m_entries.size());
-                for (auto& entry : maybeReadAssetList->m_entries)
-                    assetList.m_entries.emplace_back(std::move(entry));
-
-                return true;
-            }
-        }
+        auto assetListAssets = m_ignored_asset_cache.GetAssetListAssets(paths.m_source_paths.GetSearchPaths(), game, zoneName, cacheDir);
+        if (assetListAssets)
+            return assetListAssets;
 
+        const auto zoneDefinition = ReadZoneDefinition(paths, zoneName, false);
+        if (zoneDefinition)
         {
-            const auto zoneDefinition = ReadZoneDefinition(paths, zoneName, false);
-
-            if (zoneDefinition)
-            {
-                assetList.m_entries.reserve(assetList.m_entries.size() + zoneDefinition->m_assets.size());
-                for (const auto& entry : zoneDefinition->m_assets)
-                    assetList.m_entries.emplace_back(entry.m_asset_type, entry.m_asset_name, entry.m_is_reference);
+            AssetList assetList;
+            assetList.m_entries.reserve(zoneDefinition->m_assets.size());
+            for (const auto& entry : zoneDefinition->m_assets)
+                assetList.m_entries.emplace_back(entry.m_asset_type, entry.m_asset_name, entry.m_is_reference);
 
-                return true;
-            }
+            return IgnoredAssetCache::CreateZoneAssets(assetList);
         }
 
-        return false;
+        return nullptr;
     }
 
-    bool ProcessZoneDefinitionIgnores(LinkerPathManager& paths, const std::string& targetName, ZoneCreationContext& context) const
+    bool ProcessZoneDefinitionIgnores(LinkerPathManager& paths, const std::string& targetName, ZoneCreationContext& context)
     {
         if (context.m_definition->m_ignores.empty())
             return true;
 
+        std::vector<std::shared_ptr<const IgnoredAssetCache::ZoneAssets>> ignoredZones;
+        ignoredZones.reserve(context.m_definition->m_ignores.size());
         for (const auto& ignore : context.m_definition->m_ignores)
         {
             if (ignore == targetName)
                 continue;
 
-            if (!ReadIgnoreEntries(paths, ignore, context.m_definition->m_game, context.m_ignored_assets))
+            auto ignoredZone = ReadIgnoreEntries(paths, ignore, context.m_definition->m_game, context.m_cache_dir);
+            if (!ignoredZone)
             {
                 std::cerr << std::format("Failed to read asset listing for ignoring assets of project \"{}\".\n", ignore);
                 return false;
             }
+
+            ignoredZones.emplace_back(std::move(ignoredZone));
         }
+
+        context.m_ignored_zone_assets = m_ignored_asset_cache.GetMergedAssets(ignoredZones);
         return true;
     }
 
@@ -258,7 +271,7 @@ class LinkerImpl final : public Linker
     }
 
     std::unique_ptr<Zone> CreateZoneForDefinition(
-        LinkerPathManager& paths, const fs::path& outDir, const fs::path& cacheDir, const std::string& targetName, ZoneDefinition& zoneDefinition) const
+        LinkerPathManager& paths, const fs::path& outDir, const fs::path& cacheDir, const std::string& targetName, ZoneDefinition& zoneDefinition)
     {
         ZoneCreationContext context(&zoneDefinition, &paths.m_asset_paths.GetSearchPaths(), outDir, cacheDir);
         if (!ProcessZoneDefinitionIgnores(paths, targetName, context))
@@ -291,8 +304,10 @@ class LinkerImpl final : public Linker
         return true;
     }
 
-    bool BuildFastFile(LinkerPathManager& paths, const std::string& projectName, const std::string& targetName, ZoneDefinition& zoneDefinition) const
+    bool BuildFastFile(LinkerPathManager& paths, const std::string& projectName, const std::string& targetName, ZoneDefinition& zoneDefinition)
     {
+        const utils::TraceScope trace("link", "BuildFastFile", targetName);
+
         const fs::path outDir(paths.m_linker_paths->BuildOutputFolderPath(projectName, zoneDefinition.m_game));
 
         OutputPathFilesystem outputPath(outDir);
@@ -305,10 +320,12 @@ class LinkerImpl final : public Linker
         if (zone)
             result = WriteZoneToFile(outputPath, *zone);
 
+        paths.InvalidateSearchPaths();
+
         return result;
     }
 
-    bool BuildProject(LinkerPathManager& paths, const std::string& projectName, const std::string& targetName) const
+    bool BuildProject(LinkerPathManager& paths, const std::string& projectName, const std::string& targetName)
     {
         std::deque<std::string> targetsToBuild;
         std::unordered_set<std::string> alreadyBuiltTargets;
@@ -465,12 +482,16 @@ public:
 
         UnloadZones();
 
+        if (!m_args.m_trace_file.empty() && !utils::WriteTraceFile(m_args.m_trace_file))
+            result = false;
+
         return result;
     }
 
 private:
     LinkerArgs m_args;
     std::vector<std::unique_ptr<Zone>> m_loaded_zones;
+    IgnoredAssetCache m_ignored_asset_cache;
 };
 
 std::unique_ptr<Linker> Linker::Create()
@@ -6,6 +6,7 @@
 #include "Utils/Arguments/UsageInformation.h"
 #include "Utils/FileUtils.h"
 #include "Utils/PathUtils.h"
+#include "Utils/Tracing.h"
 
 #include <filesystem>
 #include <format>
@@ -109,6 +110,13 @@ const CommandLineOption* const OPTION_MENU_NO_OPTIMIZATION =
                         "information when dumped though.)")
     .Build();
 
+const CommandLineOption* const OPTION_TRACE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("trace")
+    .WithDescription("Records the duration of loading, writing and asset creation steps and writes them to a file in the Chrome trace event format.")
+    .WithParameter("traceFilePath")
+    .Build();
+
 // clang-format on
 
 const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
@@ -125,6 +133,7 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_LOAD,
     OPTION_MENU_PERMISSIVE,
     OPTION_MENU_NO_OPTIMIZATION,
+    OPTION_TRACE,
 };
 
 LinkerArgs::LinkerArgs()
@@ -278,5 +287,12 @@ bool LinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldContin
     if (m_argument_parser.IsOptionSpecified(OPTION_MENU_NO_OPTIMIZATION))
         ObjLoading::Configuration.MenuNoOptimization = true;
 
+    // --trace
+    if (m_argument_parser.IsOptionSpecified(OPTION_TRACE))
+    {
+        m_trace_file = m_argument_parser.GetValueForOption(OPTION_TRACE);
+        utils::EnableTracing();
+    }
+
     return true;
 }
@@ -30,6 +30,8 @@ public:
     std::set<std::string> m_gdt_search_paths;
     std::set<std::string> m_source_search_paths;
 
+    std::string m_trace_file;
+
 private:
     /**
      * \brief Prints a command line usage help text for the Linker tool to stdout.
@@ -246,7 +246,7 @@ namespace
             }
 
             std::cout << std::format("Adding {} search path: {}\n", m_type_name, path);
-            searchPaths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(path));
+            searchPaths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(path, true));
             return true;
         }
 
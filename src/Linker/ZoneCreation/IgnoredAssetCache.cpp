@@ -0,0 +1,272 @@
+#include "IgnoredAssetCache.h"
+
+#include "Algorithms/AlgorithmSha256.h"
+#include "Utils/FileUtils.h"
+#include "Utils/Tracing.h"
+#include "Zone/AssetList/AssetListReader.h"
+#include "Zone/AssetNameResolver.h"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <iostream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr auto CACHE_FOLDER_NAME = "assetlist";
+    constexpr auto CACHE_FILE_EXTENSION = ".bin";
+    constexpr auto CACHE_SIZE_LIMIT = 64uz * 1024uz * 1024uz;
+    constexpr uint32_t CACHE_FILE_MAGIC = 0x4C534148; // "HASL"
+    constexpr uint32_t CACHE_FILE_VERSION = 1u;
+
+    class CacheFileHeader
+    {
+    public:
+        uint32_t m_magic;
+        uint32_t m_version;
+        uint64_t m_asset_count;
+    };
+
+    class CacheFileInfo
+    {
+    public:
+        fs::path m_path;
+        uintmax_t m_size;
+        fs::file_time_type m_last_write_time;
+    };
+
+    std::string HashData(const void* data, const size_t dataSize)
+    {
+        const auto sha256 = cryptography::CreateSha256();
+        const auto hashSize = sha256->GetHashSize();
+        std::vector<uint8_t> hash(hashSize);
+
+        sha256->Init();
+        sha256->Process(data, dataSize);
+        sha256->Finish(hash.data());
+
+        std::string hashString;
+        hashString.reserve(hashSize * 2u);
+        for (const auto hashByte : hash)
+            hashString += std::format("{:02x}", hashByte);
+
+        return hashString;
+    }
+
+    std::string HashAssetTypeNames(const GameId game)
+    {
+        const auto* assetNameResolver = IAssetNameResolver::GetResolverForGame(game);
+
+        std::string assetTypeNames;
+        for (asset_type_t assetType = 0; const auto assetTypeName = assetNameResolver->GetAssetTypeName(assetType); assetType++)
+        {
+            assetTypeNames += *assetTypeName;
+            assetTypeNames += '\n';
+        }
+
+        return HashData(assetTypeNames.data(), assetTypeNames.size());
+    }
+
+    std::vector<uint64_t> HashAssets(const AssetList& assetList)
+    {
+        std::vector<uint64_t> assetHashes;
+        assetHashes.reserve(assetList.m_entries.size());
+        for (const auto& entry : assetList.m_entries)
+            assetHashes.emplace_back(AssetHashSet::HashAsset(entry.m_type, entry.m_name));
+
+        // Sorted hashes only depend on the assets and not on the order they are listed in
+        std::ranges::sort(assetHashes);
+        const auto duplicates = std::ranges::unique(assetHashes);
+        assetHashes.erase(duplicates.begin(), duplicates.end());
+
+        return assetHashes;
+    }
+} // namespace
+
+std::shared_ptr<const IgnoredAssetCache::ZoneAssets>
+    IgnoredAssetCache::GetAssetListAssets(ISearchPath& searchPath, const GameId game, const std::string& zoneName, const fs::path& cacheDirectory)
+{
+    const AssetListReader assetListReader(searchPath, game);
+    const auto content = assetListReader.ReadAssetListContent(zoneName, false);
+    if (!content)
+        return nullptr;
+
+    // Asset hashes contain the numeric asset type, which differs between games and changes when asset types of a game are added or reordered.
+    // Keying by the names of all asset types of the game makes sure persisted hashes are only used with the asset types they were created with.
+    auto key = std::format("{}_{}_{}", static_cast<unsigned>(game), HashAssetTypeNames(game).substr(0u, 16u), HashData(content->data(), content->size()));
+    const auto existingZoneAssets = m_zone_assets.find(key);
+    if (existingZoneAssets != m_zone_assets.end())
+        return existingZoneAssets->second;
+
+    const utils::TraceScope trace("link", "ReadIgnoredAssetList", zoneName);
+
+    std::optional<fs::path> cacheFilePath;
+    std::optional<std::vector<uint64_t>> assetHashes;
+    if (!cacheDirectory.empty())
+    {
+        cacheFilePath = cacheDirectory / CACHE_FOLDER_NAME / std::format("{}{}", key, CACHE_FILE_EXTENSION);
+        assetHashes = ReadFromCache(*cacheFilePath);
+    }
+
+    if (!assetHashes)
+    {
+        const auto assetList = assetListReader.ParseAssetList(*content);
+        if (!assetList)
+            return nullptr;
+
+        assetHashes = HashAssets(*assetList);
+        if (cacheFilePath)
+        {
+            WriteToCache(*cacheFilePath, *assetHashes);
+            TrimCache(cacheFilePath->parent_path());
+        }
+    }
+
+    auto zoneAssets = std::make_shared<ZoneAssets>(key, std::move(*assetHashes));
+    m_zone_assets.emplace(std::move(key), zoneAssets);
+
+    return zoneAssets;
+}
+
+std::shared_ptr<const IgnoredAssetCache::ZoneAssets> IgnoredAssetCache::CreateZoneAssets(const AssetList& assetList)
+{
+    auto assetHashes = HashAssets(assetList);
+    auto key = std::format("list_{}", HashData(assetHashes.data(), assetHashes.size() * sizeof(uint64_t)));
+
+    return std::make_shared<ZoneAssets>(std::move(key), std::move(assetHashes));
+}
+
+std::shared_ptr<const AssetHashSet> IgnoredAssetCache::GetMergedAssets(const std::vector<std::shared_ptr<const ZoneAssets>>& zones)
+{
+    std::string key;
+    auto assetCount = 0uz;
+    for (const auto& zone : zones)
+    {
+        if (!key.empty())
+            key += ',';
+        key += zone->m_key;
+        assetCount += zone->m_asset_hashes.size();
+    }
+
+    const auto existingMergedAssets = m_merged_assets.find(key);
+    if (existingMergedAssets != m_merged_assets.end())
+        return existingMergedAssets->second;
+
+    const utils::TraceScope trace("link", "MergeIgnoredAssets");
+
+    std::vector<uint64_t> assetHashes;
+    assetHashes.reserve(assetCount);
+    for (const auto& zone : zones)
+        assetHashes.insert(assetHashes.end(), zone->m_asset_hashes.begin(), zone->m_asset_hashes.end());
+
+    auto mergedAssets = std::make_shared<const AssetHashSet>(std::move(assetHashes));
+    m_merged_assets.emplace(std::move(key), mergedAssets);
+
+    return mergedAssets;
+}
+
+std::optional<std::vector<uint64_t>> IgnoredAssetCache::ReadFromCache(const fs::path& cacheFilePath)
+{
+    std::ifstream stream(cacheFilePath, std::ios::in | std::ios::binary);
+    if (!stream.is_open())
+        return std::nullopt;
+
+    CacheFileHeader header{};
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (stream.gcount() != sizeof(header) || header.m_magic != CACHE_FILE_MAGIC || header.m_version != CACHE_FILE_VERSION)
+        return std::nullopt;
+
+    // Compare against the file size to not trust files that were only partially written
+    std::error_code ec;
+    const auto fileSize = fs::file_size(cacheFilePath, ec);
+    if (ec || fileSize != sizeof(header) + header.m_asset_count * sizeof(uint64_t))
+        return std::nullopt;
+
+    std::vector<uint64_t> assetHashes(static_cast<size_t>(header.m_asset_count));
+    const auto dataSize = static_cast<std::streamsize>(assetHashes.size() * sizeof(uint64_t));
+    stream.read(reinterpret_cast<char*>(assetHashes.data()), dataSize);
+    if (stream.gcount() != dataSize)
+        return std::nullopt;
+
+    // Mark the file as recently used so it is not removed when trimming the cache
+    fs::last_write_time(cacheFilePath, fs::file_time_type::clock::now(), ec);
+
+    return assetHashes;
+}
+
+void IgnoredAssetCache::WriteToCache(const fs::path& cacheFilePath, const std::vector<uint64_t>& assetHashes)
+{
+    std::error_code ec;
+    fs::create_directories(cacheFilePath.parent_path(), ec);
+    if (ec)
+    {
+        std::cerr << std::format("Could not create asset list cache directory \"{}\": {}\n", cacheFilePath.parent_path().string(), ec.message());
+        return;
+    }
+
+    // Write to a temporary file first so other builds never read a partially written cache file
+    const auto temporaryPath = FileUtils::MakeTemporaryFilePath(cacheFilePath);
+
+    {
+        std::ofstream stream(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!stream.is_open())
+            return;
+
+        const CacheFileHeader header{
+            .m_magic = CACHE_FILE_MAGIC,
+            .m_version = CACHE_FILE_VERSION,
+            .m_asset_count = assetHashes.size(),
+        };
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(reinterpret_cast<const char*>(assetHashes.data()), static_cast<std::streamsize>(assetHashes.size() * sizeof(uint64_t)));
+    }
+
+    fs::rename(temporaryPath, cacheFilePath, ec);
+    if (ec)
+        fs::remove(temporaryPath, ec);
+}
+
+void IgnoredAssetCache::TrimCache(const fs::path& cacheFolderPath)
+{
+    std::vector<CacheFileInfo> cacheFiles;
+    uintmax_t cacheSize = 0u;
+
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(cacheFolderPath, ec))
+    {
+        if (!entry.is_regular_file(ec) || entry.path().extension() != CACHE_FILE_EXTENSION)
+            continue;
+
+        const auto fileSize = entry.file_size(ec);
+        if (ec)
+            continue;
+
+        const auto lastWriteTime = entry.last_write_time(ec);
+        if (ec)
+            continue;
+
+        cacheFiles.emplace_back(entry.path(), fileSize, lastWriteTime);
+        cacheSize += fileSize;
+    }
+
+    if (cacheSize <= CACHE_SIZE_LIMIT)
+        return;
+
+    std::ranges::sort(cacheFiles,
+                      [](const CacheFileInfo& file0, const CacheFileInfo& file1)
+                      {
+                          return file0.m_last_write_time < file1.m_last_write_time;
+                      });
+
+    // Other builds may remove the same files at the same time, so failing to remove a file is not an error
+    for (const auto& cacheFile : cacheFiles)
+    {
+        if (cacheSize <= CACHE_SIZE_LIMIT)
+            break;
+
+        fs::remove(cacheFile.m_path, ec);
+        cacheSize -= cacheFile.m_size;
+    }
+}
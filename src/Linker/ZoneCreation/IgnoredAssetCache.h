@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Game/IGame.h"
+#include "SearchPath/ISearchPath.h"
+#include "Zone/AssetList/AssetHashSet.h"
+#include "Zone/AssetList/AssetList.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief Caches the assets of ignored zones for all zones built by the linker.
+ * Asset lists are persisted as hashes of their assets in the cache directory keyed by the hash of their content and the asset types of their game,
+ * so they are only parsed again when either of them changes. The least recently used files are removed once the cache exceeds its size limit.
+ * Merged sets are remembered by the zones they were merged from, since zones of a project usually ignore the same zones.
+ */
+class IgnoredAssetCache
+{
+public:
+    class ZoneAssets
+    {
+    public:
+        std::string m_key;
+        std::vector<uint64_t> m_asset_hashes;
+    };
+
+    /**
+     * \brief Reads the assets of the asset list of a zone.
+     * \return The assets of the zone or \c nullptr if the zone has no valid asset list.
+     */
+    std::shared_ptr<const ZoneAssets>
+        GetAssetListAssets(ISearchPath& searchPath, GameId game, const std::string& zoneName, const std::filesystem::path& cacheDirectory);
+
+    /**
+     * \brief Creates the assets of a zone that has no asset list, e.g. from its zone definition.
+     */
+    static std::shared_ptr<const ZoneAssets> CreateZoneAssets(const AssetList& assetList);
+
+    /**
+     * \brief Merges the assets of all specified zones into a single set.
+     */
+    std::shared_ptr<const AssetHashSet> GetMergedAssets(const std::vector<std::shared_ptr<const ZoneAssets>>& zones);
+
+private:
+    static std::optional<std::vector<uint64_t>> ReadFromCache(const std::filesystem::path& cacheFilePath);
+    static void WriteToCache(const std::filesystem::path& cacheFilePath, const std::vector<uint64_t>& assetHashes);
+    static void TrimCache(const std::filesystem::path& cacheFolderPath);
+
+    std::unordered_map<std::string, std::shared_ptr<const ZoneAssets>> m_zone_assets;
+    std::unordered_map<std::string, std::shared_ptr<const AssetHashSet>> m_merged_assets;
+};
@@ -1,6 +1,7 @@
 #pragma once
 #include "Obj/Gdt/Gdt.h"
 #include "SearchPath/ISearchPath.h"
+#include "Zone/AssetList/AssetHashSet.h"
 #include "Zone/AssetList/AssetList.h"
 #include "Zone/Definition/ZoneDefinition.h"
 
@@ -17,6 +18,7 @@ public:
     std::filesystem::path m_cache_dir;
     std::vector<std::unique_ptr<Gdt>> m_gdt_files;
     AssetList m_ignored_assets;
+    std::shared_ptr<const AssetHashSet> m_ignored_zone_assets;
 
     ZoneCreationContext();
     ZoneCreationContext(ZoneDefinition* definition, ISearchPath* assetSearchPath, std::filesystem::path outDir, std::filesystem::path cacheDir);
@@ -3,9 +3,13 @@
 #include "Gdt/GdtLookup.h"
 #include "IObjCompiler.h"
 #include "IObjLoader.h"
+#include "RawFile/RawFileCompressor.h"
 #include "SearchPath/OutputPathFilesystem.h"
 
 #include <cassert>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace
 {
@@ -34,6 +38,19 @@ namespace
             context.m_ignored_assets.m_entries.emplace_back(assetEntry.m_asset_type, assetEntry.m_asset_name, assetEntry.m_is_reference);
         }
     }
+
+    void PrepareAssets(const ZoneCreationContext& context, const AssetCreatorCollection& creatorCollection)
+    {
+        std::unordered_map<asset_type_t, std::vector<std::string>> assetNamesByType;
+        for (const auto& assetEntry : context.m_definition->m_assets)
+        {
+            if (!assetEntry.m_is_reference)
+                assetNamesByType[assetEntry.m_asset_type].emplace_back(assetEntry.m_asset_name);
+        }
+
+        for (const auto& [assetType, assetNames] : assetNamesByType)
+            creatorCollection.PrepareAssets(assetType, assetNames);
+    }
 } // namespace
 
 namespace zone_creator
@@ -56,7 +73,7 @@ namespace zone_creator
         auto zone = CreateZone(context, gameId);
 
         IgnoreReferencesFromAssets(context);
-        IgnoredAssetLookup ignoredAssetLookup(context.m_ignored_assets);
+        IgnoredAssetLookup ignoredAssetLookup(context.m_ignored_assets, context.m_ignored_zone_assets);
 
         GdtLookup lookup;
         InitLookup(context, lookup);
@@ -67,12 +84,15 @@ namespace zone_creator
         AssetCreatorCollection creatorCollection(*zone);
         ZoneDefinitionContext zoneDefinitionContext(*context.m_definition);
         AssetCreationContext creationContext(*zone, &creatorCollection, &ignoredAssetLookup);
+        creationContext.GetZoneAssetCreationState<RawFileCompressor>().SetCacheDirectory(context.m_cache_dir);
 
         OutputPathFilesystem outDir(context.m_out_dir);
         OutputPathFilesystem cacheDir(context.m_cache_dir);
         objCompiler->ConfigureCreatorCollection(
             creatorCollection, *zone, zoneDefinitionContext, *context.m_asset_search_path, lookup, creationContext, outDir, cacheDir);
         objLoader->ConfigureCreatorCollection(creatorCollection, *zone, *context.m_asset_search_path, lookup);
+        creatorCollection.BuildSourceIndex(*context.m_asset_search_path);
+        PrepareAssets(context, creatorCollection);
 
         for (const auto& assetEntry : context.m_definition->m_assets)
         {
@@ -84,7 +104,8 @@ namespace zone_creator
             ++zoneDefinitionContext.m_asset_index_in_definition;
         }
 
-        creatorCollection.FinalizeZone(creationContext);
+        if (!creatorCollection.FinalizeZone(creationContext))
+            return nullptr;
 
         return zone;
     }
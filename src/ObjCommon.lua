@@ -18,6 +18,10 @@ function ObjCommon:link(links)
 	links:linkto(Common)
 	links:linkto(minizip)
 	links:linkto(Parser)
+
+	if os.host() == "linux" then
+		links:add("pthread")
+	end
 end
 
 function ObjCommon:use()
@@ -1,5 +1,7 @@
 #include "ISearchPath.h"
 
+#include <sstream>
+
 bool SearchPathOpenFile::IsOpen() const
 {
     return m_stream != nullptr;
@@ -15,3 +17,25 @@ SearchPathOpenFile::SearchPathOpenFile(std::unique_ptr<std::istream> stream, con
       m_length(length)
 {
 }
+
+std::optional<std::string> ISearchPath::ReadFile(const std::string& fileName)
+{
+    const auto file = Open(fileName);
+    if (!file.IsOpen())
+        return std::nullopt;
+
+    // Not every search path knows the length of its files
+    if (file.m_length < 0)
+    {
+        std::ostringstream ss;
+        ss << file.m_stream->rdbuf();
+        return ss.str();
+    }
+
+    std::string content(static_cast<size_t>(file.m_length), '\0');
+    file.m_stream->read(content.data(), static_cast<std::streamsize>(content.size()));
+    if (file.m_stream->gcount() != static_cast<std::streamsize>(content.size()))
+        return std::nullopt;
+
+    return content;
+}
@@ -7,6 +7,7 @@
 #include <functional>
 #include <istream>
 #include <memory>
+#include <optional>
 #include <string>
 
 class SearchPathOpenFile
@@ -39,6 +40,13 @@ public:
      */
     virtual SearchPathOpenFile Open(const std::string& fileName) = 0;
 
+    /**
+     * \brief Reads the whole content of a file relative to the search path.
+     * \param fileName The relative path to the file to read.
+     * \return The content of the file or \c std::nullopt when the file could not be found or read.
+     */
+    std::optional<std::string> ReadFile(const std::string& fileName);
+
     /**
      * \brief Returns the path to the search path.
      * \return The path to the search path.
@@ -52,6 +60,12 @@ public:
      */
     virtual void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) = 0;
 
+    /**
+     * \brief Forgets everything the search path remembers about its files, so files that were created or removed since are noticed.
+     * Should be called after writing files that may be found by the search path.
+     */
+    virtual void Invalidate() {}
+
     /**
      * \brief Iterates through all files of the search path.
      * \param callback The callback to call for each found file with it's path relative to the search path.
@@ -0,0 +1,200 @@
+#include "OutputPathAsync.h"
+
+#include <algorithm>
+#include <cassert>
+#include <format>
+#include <iostream>
+#include <sstream>
+
+class OutputPathAsync::BufferedFileStream final : public std::ostream
+{
+public:
+    BufferedFileStream(OutputPathAsync& outputPath, std::string fileName, const uint64_t openIndex)
+        : std::ostream(&m_buffer),
+          m_output_path(outputPath),
+          m_file_name(std::move(fileName)),
+          m_open_index(openIndex)
+    {
+    }
+
+    ~BufferedFileStream() override
+    {
+        m_output_path.Enqueue(std::move(m_file_name), std::move(m_buffer).str(), m_open_index);
+    }
+
+    BufferedFileStream(const BufferedFileStream& other) = delete;
+    BufferedFileStream(BufferedFileStream&& other) noexcept = delete;
+    BufferedFileStream& operator=(const BufferedFileStream& other) = delete;
+    BufferedFileStream& operator=(BufferedFileStream&& other) noexcept = delete;
+
+private:
+    std::stringbuf m_buffer;
+    OutputPathAsync& m_output_path;
+    std::string m_file_name;
+    uint64_t m_open_index;
+};
+
+OutputPathAsync::PendingFile::PendingFile(std::string fileName, std::string data, const uint64_t openIndex)
+    : m_file_name(std::move(fileName)),
+      m_data(std::move(data)),
+      m_open_index(openIndex)
+{
+}
+
+OutputPathAsync::OutputPathAsync(IOutputPath& target)
+    : OutputPathAsync(target, std::clamp(std::thread::hardware_concurrency() / 2u, 1u, 4u), DEFAULT_MEMORY_BUDGET)
+{
+}
+
+OutputPathAsync::OutputPathAsync(IOutputPath& target, const size_t workerCount, const size_t memoryBudget)
+    : m_target(target),
+      m_memory_budget(memoryBudget),
+      m_buffered_size(0u),
+      m_active_writes(0u),
+      m_next_open_index(0u),
+      m_failed(false),
+      m_stopping(false)
+{
+    assert(workerCount > 0);
+
+    m_workers.reserve(workerCount);
+    for (auto i = 0uz; i < workerCount; i++)
+        m_workers.emplace_back(&OutputPathAsync::WorkerLoop, this);
+}
+
+OutputPathAsync::~OutputPathAsync()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_work_available.notify_all();
+
+    // Workers only stop once the queue is empty, so all files are written
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+std::unique_ptr<std::ostream> OutputPathAsync::Open(const std::string& fileName)
+{
+    uint64_t openIndex;
+    {
+        std::lock_guard lock(m_mutex);
+        openIndex = m_next_open_index++;
+        m_latest_open_indices[fileName] = openIndex;
+    }
+
+    return std::make_unique<BufferedFileStream>(*this, fileName, openIndex);
+}
+
+bool OutputPathAsync::Flush()
+{
+    std::unique_lock lock(m_mutex);
+    m_work_done.wait(lock,
+                     [this]
+                     {
+                         return m_pending_files.empty() && m_active_writes == 0;
+                     });
+
+    const auto success = !m_failed;
+    m_failed = false;
+
+    return success;
+}
+
+void OutputPathAsync::Enqueue(std::string fileName, std::string data, const uint64_t openIndex)
+{
+    {
+        std::unique_lock lock(m_mutex);
+
+        // Always accept a file when nothing is buffered, otherwise files larger than the budget could never be written
+        m_work_done.wait(lock,
+                         [this, &data]
+                         {
+                             return m_buffered_size == 0 || m_buffered_size + data.size() <= m_memory_budget;
+                         });
+
+        m_buffered_size += data.size();
+        m_pending_files.emplace_back(std::move(fileName), std::move(data), openIndex);
+    }
+
+    m_work_available.notify_one();
+}
+
+bool OutputPathAsync::WriteFile(const PendingFile& file) const
+{
+    const auto stream = m_target.Open(file.m_file_name);
+    if (!stream)
+    {
+        std::cerr << std::format("Failed to open file '{}'\n", file.m_file_name);
+        return false;
+    }
+
+    stream->write(file.m_data.data(), static_cast<std::streamsize>(file.m_data.size()));
+    stream->flush();
+
+    if (!stream->good())
+    {
+        std::cerr << std::format("Failed to write file '{}'\n", file.m_file_name);
+        return false;
+    }
+
+    return true;
+}
+
+std::deque<OutputPathAsync::PendingFile>::iterator OutputPathAsync::FindWritablePendingFile()
+{
+    // Files are written one at a time per path, so a file waits while an older version of it is still being written
+    return std::ranges::find_if(m_pending_files,
+                                [this](const PendingFile& file)
+                                {
+                                    return !m_files_being_written.contains(file.m_file_name);
+                                });
+}
+
+void OutputPathAsync::WorkerLoop()
+{
+    std::unique_lock lock(m_mutex);
+    while (true)
+    {
+        m_work_available.wait(lock,
+                              [this]
+                              {
+                                  return FindWritablePendingFile() != m_pending_files.end() || (m_stopping && m_pending_files.empty());
+                              });
+
+        const auto pendingFile = FindWritablePendingFile();
+        if (pendingFile == m_pending_files.end())
+            return;
+
+        const auto file = std::move(*pendingFile);
+        m_pending_files.erase(pendingFile);
+
+        // Only the data of the stream that was opened last is written when a file was opened multiple times.
+        // The open index is removed once the file of the latest stream is written, so files without one are outdated.
+        const auto latestOpenIndex = m_latest_open_indices.find(file.m_file_name);
+        if (latestOpenIndex == m_latest_open_indices.end() || latestOpenIndex->second != file.m_open_index)
+        {
+            m_buffered_size -= file.m_data.size();
+            m_work_done.notify_all();
+            continue;
+        }
+
+        m_latest_open_indices.erase(latestOpenIndex);
+        m_files_being_written.emplace(file.m_file_name);
+        m_active_writes++;
+
+        lock.unlock();
+        const auto success = WriteFile(file);
+        lock.lock();
+
+        m_files_being_written.erase(file.m_file_name);
+        m_active_writes--;
+        m_buffered_size -= file.m_data.size();
+        if (!success)
+            m_failed = true;
+
+        m_work_done.notify_all();
+        m_work_available.notify_all();
+    }
+}
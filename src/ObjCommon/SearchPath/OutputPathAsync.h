@@ -0,0 +1,78 @@
+#pragma once
+
+#include "IOutputPath.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * \brief An output path that buffers files in memory and writes them to another output path on background threads.
+ * A file is written once the stream returned by \c Open is destroyed.
+ * When the buffered data exceeds the memory budget, finishing a file blocks until enough data has been written.
+ * When the same file is opened multiple times, only the data of the stream that was opened last is written.
+ */
+class OutputPathAsync final : public IOutputPath
+{
+public:
+    static constexpr auto DEFAULT_MEMORY_BUDGET = 64uz * 1024uz * 1024uz;
+
+    OutputPathAsync(IOutputPath& target, size_t workerCount, size_t memoryBudget);
+    explicit OutputPathAsync(IOutputPath& target);
+    ~OutputPathAsync() override;
+
+    OutputPathAsync(const OutputPathAsync& other) = delete;
+    OutputPathAsync(OutputPathAsync&& other) noexcept = delete;
+    OutputPathAsync& operator=(const OutputPathAsync& other) = delete;
+    OutputPathAsync& operator=(OutputPathAsync&& other) noexcept = delete;
+
+    std::unique_ptr<std::ostream> Open(const std::string& fileName) override;
+
+    /**
+     * \brief Waits until all finished files have been written.
+     * \return \c true if all files since the last flush were written successfully, otherwise \c false
+     */
+    bool Flush();
+
+private:
+    class BufferedFileStream;
+
+    class PendingFile
+    {
+    public:
+        std::string m_file_name;
+        std::string m_data;
+        uint64_t m_open_index;
+
+        PendingFile(std::string fileName, std::string data, uint64_t openIndex);
+    };
+
+    void Enqueue(std::string fileName, std::string data, uint64_t openIndex);
+    [[nodiscard]] std::deque<PendingFile>::iterator FindWritablePendingFile();
+    void WorkerLoop();
+    bool WriteFile(const PendingFile& file) const;
+
+    IOutputPath& m_target;
+    size_t m_memory_budget;
+
+    std::mutex m_mutex;
+    std::condition_variable m_work_available;
+    std::condition_variable m_work_done;
+    std::deque<PendingFile> m_pending_files;
+    size_t m_buffered_size;
+    size_t m_active_writes;
+    uint64_t m_next_open_index;
+    std::unordered_map<std::string, uint64_t> m_latest_open_indices;
+    std::unordered_set<std::string> m_files_being_written;
+    bool m_failed;
+    bool m_stopping;
+
+    std::vector<std::thread> m_workers;
+};
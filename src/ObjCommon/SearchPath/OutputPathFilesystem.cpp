@@ -11,18 +11,41 @@ OutputPathFilesystem::OutputPathFilesystem(const fs::path& path)
 {
 }
 
+bool OutputPathFilesystem::CreateContainingDirectory(const fs::path& directory)
+{
+    const auto directoryString = directory.string();
+
+    std::lock_guard lock(m_directory_mutex);
+    if (m_created_directories.contains(directoryString))
+        return true;
+
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    if (ec)
+        return false;
+
+    // All parents exist now as well
+    m_created_directories.emplace(directoryString);
+    for (auto parent = directory.parent_path(); parent != m_path && parent.has_relative_path(); parent = parent.parent_path())
+    {
+        if (!m_created_directories.emplace(parent.string()).second)
+            break;
+    }
+
+    return true;
+}
+
 std::unique_ptr<std::ostream> OutputPathFilesystem::Open(const std::string& fileName)
 {
-    const auto fullNewPath = fs::weakly_canonical(m_path / fileName);
+    // Validate lexically, the output path was made canonical upon construction
+    const auto fullNewPath = (m_path / fileName).lexically_normal();
+    const auto relativePath = fullNewPath.lexically_relative(m_path);
 
-    if (!fullNewPath.string().starts_with(m_path.string()))
+    if (relativePath.empty() || *relativePath.begin() == "..")
         return nullptr;
 
     const auto containingDirectory = fullNewPath.parent_path();
-
-    std::error_code ec;
-    fs::create_directories(containingDirectory, ec);
-    if (ec)
+    if (!CreateContainingDirectory(containingDirectory))
     {
         std::cerr << std::format("Failed to create folder '{}' when try to open file '{}'\n", containingDirectory.string(), fileName);
         return nullptr;
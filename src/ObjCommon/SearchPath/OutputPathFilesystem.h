@@ -3,6 +3,9 @@
 #include "IOutputPath.h"
 
 #include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_set>
 
 class OutputPathFilesystem final : public IOutputPath
 {
@@ -12,5 +15,11 @@ public:
     std::unique_ptr<std::ostream> Open(const std::string& fileName) override;
 
 private:
+    bool CreateContainingDirectory(const std::filesystem::path& directory);
+
     std::filesystem::path m_path;
+
+    // Directories that are known to exist, so they do not need to be created again for every file inside them
+    std::mutex m_directory_mutex;
+    std::unordered_set<std::string> m_created_directories;
 };
@@ -1,6 +1,7 @@
 #include "SearchPathFilesystem.h"
 
 #include "Utils/ObjFileStream.h"
+#include "Utils/StringUtils.h"
 
 #include <filesystem>
 #include <format>
@@ -9,8 +10,36 @@
 
 namespace fs = std::filesystem;
 
+SearchPathFilesystem::DirectoryEntry::DirectoryEntry(std::string name, const bool isDirectory)
+    : m_name(std::move(name)),
+      m_is_directory(isDirectory)
+{
+}
+
+const SearchPathFilesystem::DirectoryEntry* SearchPathFilesystem::DirectoryIndex::Find(const std::string& name) const
+{
+    const auto entry = m_entries.find(name);
+    if (entry != m_entries.end())
+        return &entry->second;
+
+    auto lowerCaseName = name;
+    utils::MakeStringLowerCase(lowerCaseName);
+
+    const auto lowerCaseEntry = m_entries_by_lower_case_name.find(lowerCaseName);
+    if (lowerCaseEntry == m_entries_by_lower_case_name.end())
+        return nullptr;
+
+    return lowerCaseEntry->second;
+}
+
 SearchPathFilesystem::SearchPathFilesystem(std::string path)
-    : m_path(std::move(path))
+    : SearchPathFilesystem(std::move(path), false)
+{
+}
+
+SearchPathFilesystem::SearchPathFilesystem(std::string path, const bool useIndex)
+    : m_path(std::move(path)),
+      m_use_index(useIndex)
 {
 }
 
@@ -19,9 +48,100 @@ const std::string& SearchPathFilesystem::GetPath()
     return m_path;
 }
 
+std::unique_ptr<SearchPathFilesystem::DirectoryIndex> SearchPathFilesystem::CreateDirectoryIndex(const fs::path& directoryPath) const
+{
+    auto index = std::make_unique<DirectoryIndex>();
+
+    // A directory that does not exist (yet) stays empty until the index is invalidated
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(directoryPath, ec))
+    {
+        auto name = entry.path().filename().string();
+        auto lowerCaseName = name;
+        utils::MakeStringLowerCase(lowerCaseName);
+
+        const auto [newEntry, _] = index->m_entries.try_emplace(name, name, entry.is_directory(ec));
+        index->m_entries_by_lower_case_name.try_emplace(std::move(lowerCaseName), &newEntry->second);
+    }
+
+    return index;
+}
+
+const SearchPathFilesystem::DirectoryIndex& SearchPathFilesystem::GetDirectoryIndex(const std::string& relativeDirectoryPath)
+{
+    auto& index = m_directory_indices[relativeDirectoryPath];
+    if (!index)
+        index = CreateDirectoryIndex(fs::path(m_path).append(relativeDirectoryPath));
+
+    return *index;
+}
+
+std::optional<fs::path> SearchPathFilesystem::ResolveWithIndex(const std::string& fileName)
+{
+    if (fs::path(fileName).is_absolute())
+        return fileName;
+
+    std::vector<std::string> parts;
+    size_t partStart = 0;
+    for (size_t i = 0; i <= fileName.size(); i++)
+    {
+        if (i < fileName.size() && fileName[i] != '/' && fileName[i] != '\\')
+            continue;
+
+        auto part = fileName.substr(partStart, i - partStart);
+        partStart = i + 1;
+
+        if (part.empty() || part == ".")
+            continue;
+
+        // Paths leaving the search path cannot be resolved with the index
+        if (part == "..")
+            return fs::path(m_path).append(fileName);
+
+        parts.emplace_back(std::move(part));
+    }
+
+    if (parts.empty())
+        return std::nullopt;
+
+    std::lock_guard lock(m_index_mutex);
+
+    std::string relativePath;
+    for (auto i = 0uz; i < parts.size(); i++)
+    {
+        const auto* entry = GetDirectoryIndex(relativePath).Find(parts[i]);
+        const auto isLastPart = i + 1 == parts.size();
+        if (entry == nullptr || entry->m_is_directory == isLastPart)
+            return std::nullopt;
+
+        if (!relativePath.empty())
+            relativePath += '/';
+        relativePath += entry->m_name;
+    }
+
+    return fs::path(m_path).append(relativePath);
+}
+
+void SearchPathFilesystem::Invalidate()
+{
+    std::lock_guard lock(m_index_mutex);
+    m_directory_indices.clear();
+}
+
 SearchPathOpenFile SearchPathFilesystem::Open(const std::string& fileName)
 {
-    const auto filePath = fs::path(m_path).append(fileName);
+    fs::path filePath;
+    if (m_use_index)
+    {
+        auto resolvedPath = ResolveWithIndex(fileName);
+        if (!resolvedPath)
+            return SearchPathOpenFile();
+
+        filePath = std::move(*resolvedPath);
+    }
+    else
+        filePath = fs::path(m_path).append(fileName);
+
     std::ifstream file(filePath.string(), std::fstream::in | std::fstream::binary);
 
     if (file.is_open())
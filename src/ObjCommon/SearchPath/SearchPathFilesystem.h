@@ -2,16 +2,61 @@
 
 #include "ISearchPath.h"
 
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
 
 class SearchPathFilesystem final : public ISearchPath
 {
+    class DirectoryEntry
+    {
+    public:
+        std::string m_name;
+        bool m_is_directory;
+
+        DirectoryEntry(std::string name, bool isDirectory);
+    };
+
+    /**
+     * \brief The contents of a single directory of the search path.
+     * Entries are looked up by their exact name first and case-insensitively afterwards.
+     */
+    class DirectoryIndex
+    {
+    public:
+        std::unordered_map<std::string, DirectoryEntry> m_entries;
+        std::unordered_map<std::string, const DirectoryEntry*> m_entries_by_lower_case_name;
+
+        _NODISCARD const DirectoryEntry* Find(const std::string& name) const;
+    };
+
     std::string m_path;
+    bool m_use_index;
+
+    std::mutex m_index_mutex;
+    std::unordered_map<std::string, std::unique_ptr<DirectoryIndex>> m_directory_indices;
+
+    const DirectoryIndex& GetDirectoryIndex(const std::string& relativeDirectoryPath);
+    std::unique_ptr<DirectoryIndex> CreateDirectoryIndex(const std::filesystem::path& directoryPath) const;
+    std::optional<std::filesystem::path> ResolveWithIndex(const std::string& fileName);
 
 public:
     explicit SearchPathFilesystem(std::string path);
 
+    /**
+     * \brief Creates a search path for a folder of the filesystem.
+     * \param path The path to the folder.
+     * \param useIndex When \c true, the contents of all searched directories are remembered.
+     * This answers failed lookups without touching the filesystem and matches file names case-insensitively.
+     * Files that are created afterwards are only found after calling \c Invalidate.
+     */
+    SearchPathFilesystem(std::string path, bool useIndex);
+
     SearchPathOpenFile Open(const std::string& fileName) override;
     const std::string& GetPath() override;
     void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+    void Invalidate() override;
 };
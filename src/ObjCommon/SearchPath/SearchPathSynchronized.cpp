@@ -0,0 +1,46 @@
+#include "SearchPathSynchronized.h"
+
+#include <sstream>
+
+SearchPathSynchronized::SearchPathSynchronized(ISearchPath& searchPath)
+    : m_search_path(searchPath)
+{
+}
+
+SearchPathOpenFile SearchPathSynchronized::Open(const std::string& fileName)
+{
+    std::lock_guard lock(m_mutex);
+
+    const auto file = m_search_path.Open(fileName);
+    if (!file.IsOpen())
+        return SearchPathOpenFile();
+
+    std::string content(static_cast<size_t>(file.m_length), '\0');
+    file.m_stream->read(content.data(), static_cast<std::streamsize>(content.size()));
+    content.resize(static_cast<size_t>(file.m_stream->gcount()));
+
+    const auto length = static_cast<int64_t>(content.size());
+    return SearchPathOpenFile(std::make_unique<std::istringstream>(std::move(content)), length);
+}
+
+const std::string& SearchPathSynchronized::GetPath()
+{
+    std::lock_guard lock(m_mutex);
+
+    return m_search_path.GetPath();
+}
+
+void SearchPathSynchronized::Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback)
+{
+    // The lock is recursive so the callback can open the found files
+    std::lock_guard lock(m_mutex);
+
+    m_search_path.Find(options, callback);
+}
+
+void SearchPathSynchronized::Invalidate()
+{
+    std::lock_guard lock(m_mutex);
+
+    m_search_path.Invalidate();
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "ISearchPath.h"
+
+#include <mutex>
+#include <string>
+
+/**
+ * \brief Makes a search path usable from multiple threads at once.
+ * All accesses to the wrapped search path are serialized and opened files are read into memory completely,
+ * so the returned streams can be read independently of the wrapped search path.
+ */
+class SearchPathSynchronized final : public ISearchPath
+{
+public:
+    explicit SearchPathSynchronized(ISearchPath& searchPath);
+
+    SearchPathOpenFile Open(const std::string& fileName) override;
+    const std::string& GetPath() override;
+    void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+    void Invalidate() override;
+
+private:
+    ISearchPath& m_search_path;
+    std::recursive_mutex m_mutex;
+};
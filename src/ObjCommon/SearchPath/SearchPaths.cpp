@@ -32,6 +32,14 @@ void SearchPaths::Find(const SearchPathSearchOptions& options, const std::functi
     }
 }
 
+void SearchPaths::Invalidate()
+{
+    for (auto* searchPathEntry : m_search_paths)
+    {
+        searchPathEntry->Invalidate();
+    }
+}
+
 void SearchPaths::CommitSearchPath(std::unique_ptr<ISearchPath> searchPath)
 {
     m_search_paths.push_back(searchPath.get());
@@ -19,6 +19,7 @@ public:
     SearchPathOpenFile Open(const std::string& fileName) override;
     const std::string& GetPath() override;
     void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+    void Invalidate() override;
 
     SearchPaths(const SearchPaths& other) = delete;
     SearchPaths(SearchPaths&& other) noexcept = default;
@@ -60,7 +60,8 @@ void AbstractImageIPakPostProcessor::PostProcessAsset(XAssetInfoGeneric& assetIn
         m_current_ipak->AddImage(assetInfo.m_name);
 }
 
-void AbstractImageIPakPostProcessor::FinalizeZone(AssetCreationContext& context)
+bool AbstractImageIPakPostProcessor::FinalizeZone(AssetCreationContext& context)
 {
     m_ipak_creator.Finalize(m_search_path, m_out_dir);
+    return true;
 }
@@ -16,7 +16,7 @@ public:
     static bool AppliesToZoneDefinition(const ZoneDefinitionContext& zoneDefinition);
 
     void PostProcessAsset(XAssetInfoGeneric& assetInfo, AssetCreationContext& context) override;
-    void FinalizeZone(AssetCreationContext& context) override;
+    bool FinalizeZone(AssetCreationContext& context) override;
 
 private:
     void FindNextObjContainer();
@@ -61,7 +61,8 @@ void AbstractImageIwdPostProcessor::PostProcessAsset(XAssetInfoGeneric& assetInf
         m_current_iwd->AddFile(std::format("images/{}.iwi", assetInfo.m_name));
 }
 
-void AbstractImageIwdPostProcessor::FinalizeZone(AssetCreationContext& context)
+bool AbstractImageIwdPostProcessor::FinalizeZone(AssetCreationContext& context)
 {
     m_iwd_creator.Finalize(m_search_path, m_out_dir);
+    return true;
 }
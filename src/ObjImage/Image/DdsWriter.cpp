@@ -1,11 +1,14 @@
 #include "DdsWriter.h"
 
 #include "Image/DdsTypes.h"
+#include "Image/IwiLoader.h"
 #include "Image/TextureConverter.h"
 
 #include <cassert>
+#include <iostream>
 #include <map>
 #include <memory>
+#include <vector>
 
 const std::map<ImageFormatId, ImageFormatId> DDS_CONVERSION_TABLE{
     {ImageFormatId::R8_G8_B8, ImageFormatId::B8_G8_R8_X8},
@@ -31,10 +34,66 @@ public:
     {
     }
 
+    static bool SupportsIwiPassthrough(const ImageFormat* imageFormat)
+    {
+        return !DDS_CONVERSION_TABLE.contains(imageFormat->GetId());
+    }
+
     void DumpImage()
     {
         ConvertTextureIfNecessary();
+        WriteHeader();
+
+        const auto mipCount = m_texture->HasMipMaps() ? m_texture->GetMipMapCount() : 1;
+        for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
+        {
+            const auto* buffer = m_texture->GetBufferForMipLevel(mipLevel);
+            m_stream.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(GetSizeOfMipLevelData(mipLevel)));
+        }
+    }
+
+    bool DumpIwiPassthrough(std::istream& iwiStream)
+    {
+        assert(SupportsIwiPassthrough(m_texture->GetFormat()));
+
+        // Iwis store the smallest mip level first while dds files start with the largest one.
+        // Only buffer the smaller mip levels so the largest one can be copied directly afterwards.
+        const auto mipCount = m_texture->HasMipMaps() ? m_texture->GetMipMapCount() : 1;
+        auto smallerMipLevelsSize = 0uz;
+        for (auto mipLevel = 1; mipLevel < mipCount; mipLevel++)
+            smallerMipLevelsSize += GetSizeOfMipLevelData(mipLevel);
+
+        std::vector<char> smallerMipLevels(smallerMipLevelsSize);
+        iwiStream.read(smallerMipLevels.data(), static_cast<std::streamsize>(smallerMipLevelsSize));
+        if (iwiStream.gcount() != static_cast<std::streamsize>(smallerMipLevelsSize))
+        {
+            std::cerr << "Unexpected eof of iwi\n";
+            return false;
+        }
+
+        WriteHeader();
+
+        if (!iwi::CopyIwiMipLevelData(iwiStream, m_stream, GetSizeOfMipLevelData(0)))
+            return false;
+
+        auto mipLevelOffset = smallerMipLevelsSize;
+        for (auto mipLevel = 1; mipLevel < mipCount; mipLevel++)
+        {
+            const auto mipLevelSize = GetSizeOfMipLevelData(mipLevel);
+            mipLevelOffset -= mipLevelSize;
+            m_stream.write(&smallerMipLevels[mipLevelOffset], static_cast<std::streamsize>(mipLevelSize));
+        }
+
+        return true;
+    }
 
+    [[nodiscard]] size_t GetSizeOfMipLevelData(const int mipLevel) const
+    {
+        return m_texture->GetSizeOfMipLevel(mipLevel) * m_texture->GetFaceCount();
+    }
+
+    void WriteHeader()
+    {
         DDS_HEADER header{};
         PopulateDdsHeader(header);
 
@@ -49,14 +108,6 @@ public:
             PopulateDxt10Header(dxt10);
             m_stream.write(reinterpret_cast<const char*>(&dxt10), sizeof(dxt10));
         }
-
-        const auto mipCount = m_texture->HasMipMaps() ? m_texture->GetMipMapCount() : 1;
-        for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
-        {
-            const auto* buffer = m_texture->GetBufferForMipLevel(mipLevel);
-            const auto mipLevelSize = m_texture->GetSizeOfMipLevel(mipLevel) * m_texture->GetFaceCount();
-            m_stream.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(mipLevelSize));
-        }
     }
 
     static constexpr unsigned Mask1(const unsigned length)
@@ -238,3 +289,14 @@ void DdsWriter::DumpImage(std::ostream& stream, const Texture* texture)
     DdsWriterInternal internal(stream, texture);
     internal.DumpImage();
 }
+
+bool DdsWriter::SupportsIwiPassthrough(const ImageFormat* imageFormat)
+{
+    return DdsWriterInternal::SupportsIwiPassthrough(imageFormat);
+}
+
+bool DdsWriter::DumpIwiPassthrough(std::ostream& stream, const Texture* texture, std::istream& iwiStream)
+{
+    DdsWriterInternal internal(stream, texture);
+    return internal.DumpIwiPassthrough(iwiStream);
+}
@@ -9,4 +9,6 @@ public:
     bool SupportsImageFormat(const ImageFormat* imageFormat) override;
     std::string GetFileExtension() override;
     void DumpImage(std::ostream& stream, const Texture* texture) override;
+    bool SupportsIwiPassthrough(const ImageFormat* imageFormat) override;
+    bool DumpIwiPassthrough(std::ostream& stream, const Texture* texture, std::istream& iwiStream) override;
 };
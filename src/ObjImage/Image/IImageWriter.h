@@ -2,6 +2,7 @@
 
 #include "Image/Texture.h"
 
+#include <istream>
 #include <ostream>
 #include <string>
 
@@ -18,4 +19,19 @@ public:
     virtual bool SupportsImageFormat(const ImageFormat* imageFormat) = 0;
     virtual std::string GetFileExtension() = 0;
     virtual void DumpImage(std::ostream& stream, const Texture* texture) = 0;
+
+    /**
+     * \brief Checks whether images of the specified format are dumped with their mip level data unchanged.
+     * Those images can be dumped with \c DumpIwiPassthrough.
+     */
+    virtual bool SupportsIwiPassthrough(const ImageFormat* imageFormat) = 0;
+
+    /**
+     * \brief Dumps an image by copying its mip level data from an iwi instead of from a texture buffer.
+     * The output is identical to loading the iwi and dumping it with \c DumpImage.
+     * \param texture The texture describing the image as returned by \c iwi::LoadIwiHeader. It does not need to be allocated.
+     * \param iwiStream The iwi stream positioned at the start of its mip level data.
+     * \return \c false if the iwi did not contain all of its mip level data.
+     */
+    virtual bool DumpIwiPassthrough(std::ostream& stream, const Texture* texture, std::istream& iwiStream) = 0;
 };
@@ -2,6 +2,7 @@
 
 #include "Image/IwiTypes.h"
 
+#include <algorithm>
 #include <cassert>
 #include <format>
 #include <iostream>
@@ -9,6 +10,28 @@
 
 namespace iwi
 {
+    constexpr auto COPY_BUFFER_SIZE = 0x10000uz;
+
+    template<typename HeaderType> bool ValidateFileSizeForPicmip(const HeaderType& header, const Texture& texture)
+    {
+        auto currentFileSize = sizeof(HeaderType) + sizeof(IwiVersion);
+        const auto mipMapCount = texture.HasMipMaps() ? texture.GetMipMapCount() : 1;
+
+        for (auto currentMipLevel = mipMapCount - 1; currentMipLevel >= 0; currentMipLevel--)
+        {
+            currentFileSize += texture.GetSizeOfMipLevel(currentMipLevel) * texture.GetFaceCount();
+
+            if (currentMipLevel < static_cast<int>(std::extent_v<decltype(HeaderType::fileSizeForPicmip)>)
+                && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
+            {
+                std::cerr << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     const ImageFormat* GetFormat6(int8_t format)
     {
         switch (static_cast<iwi6::IwiFormat>(format))
@@ -46,7 +69,7 @@ namespace iwi
         return nullptr;
     }
 
-    std::unique_ptr<Texture> LoadIwi6(std::istream& stream)
+    std::unique_ptr<Texture> LoadIwi6Header(std::istream& stream)
     {
         iwi6::IwiHeader header{};
 
@@ -71,30 +94,8 @@ namespace iwi
         else
             texture = std::make_unique<Texture2D>(format, width, height, hasMipMaps);
 
-        texture->Allocate();
-
-        auto currentFileSize = sizeof(iwi6::IwiHeader) + sizeof(IwiVersion);
-        const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
-
-        for (auto currentMipLevel = mipMapCount - 1; currentMipLevel >= 0; currentMipLevel--)
-        {
-            const auto sizeOfMipLevel = texture->GetSizeOfMipLevel(currentMipLevel) * texture->GetFaceCount();
-            currentFileSize += sizeOfMipLevel;
-
-            if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi6::IwiHeader::fileSizeForPicmip)>)
-                && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
-            {
-                std::cerr << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
-                return nullptr;
-            }
-
-            stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
-            if (stream.gcount() != sizeOfMipLevel)
-            {
-                std::cerr << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
-                return nullptr;
-            }
-        }
+        if (!ValidateFileSizeForPicmip(header, *texture))
+            return nullptr;
 
         return texture;
     }
@@ -144,7 +145,7 @@ namespace iwi
         return nullptr;
     }
 
-    std::unique_ptr<Texture> LoadIwi8(std::istream& stream)
+    std::unique_ptr<Texture> LoadIwi8Header(std::istream& stream)
     {
         iwi8::IwiHeader header{};
 
@@ -185,30 +186,8 @@ namespace iwi
             return nullptr;
         }
 
-        texture->Allocate();
-
-        auto currentFileSize = sizeof(iwi8::IwiHeader) + sizeof(IwiVersion);
-        const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
-
-        for (auto currentMipLevel = mipMapCount - 1; currentMipLevel >= 0; currentMipLevel--)
-        {
-            const auto sizeOfMipLevel = texture->GetSizeOfMipLevel(currentMipLevel) * texture->GetFaceCount();
-            currentFileSize += sizeOfMipLevel;
-
-            if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi8::IwiHeader::fileSizeForPicmip)>)
-                && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
-            {
-                std::cerr << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
-                return nullptr;
-            }
-
-            stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
-            if (stream.gcount() != sizeOfMipLevel)
-            {
-                std::cerr << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
-                return nullptr;
-            }
-        }
+        if (!ValidateFileSizeForPicmip(header, *texture))
+            return nullptr;
 
         return texture;
     }
@@ -255,7 +234,7 @@ namespace iwi
         return nullptr;
     }
 
-    std::unique_ptr<Texture> LoadIwi13(std::istream& stream)
+    std::unique_ptr<Texture> LoadIwi13Header(std::istream& stream)
     {
         iwi13::IwiHeader header{};
 
@@ -280,30 +259,8 @@ namespace iwi
         else
             texture = std::make_unique<Texture2D>(format, width, height, hasMipMaps);
 
-        texture->Allocate();
-
-        auto currentFileSize = sizeof(iwi13::IwiHeader) + sizeof(IwiVersion);
-        const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
-
-        for (auto currentMipLevel = mipMapCount - 1; currentMipLevel >= 0; currentMipLevel--)
-        {
-            const auto sizeOfMipLevel = texture->GetSizeOfMipLevel(currentMipLevel) * texture->GetFaceCount();
-            currentFileSize += sizeOfMipLevel;
-
-            if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi13::IwiHeader::fileSizeForPicmip)>)
-                && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
-            {
-                std::cerr << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
-                return nullptr;
-            }
-
-            stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
-            if (stream.gcount() != sizeOfMipLevel)
-            {
-                std::cerr << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
-                return nullptr;
-            }
-        }
+        if (!ValidateFileSizeForPicmip(header, *texture))
+            return nullptr;
 
         return texture;
     }
@@ -352,7 +309,7 @@ namespace iwi
         return nullptr;
     }
 
-    std::unique_ptr<Texture> LoadIwi27(std::istream& stream)
+    std::unique_ptr<Texture> LoadIwi27Header(std::istream& stream)
     {
         iwi27::IwiHeader header{};
 
@@ -377,35 +334,13 @@ namespace iwi
         else
             texture = std::make_unique<Texture2D>(format, width, height, hasMipMaps);
 
-        texture->Allocate();
-
-        auto currentFileSize = sizeof(iwi27::IwiHeader) + sizeof(IwiVersion);
-        const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
-
-        for (auto currentMipLevel = mipMapCount - 1; currentMipLevel >= 0; currentMipLevel--)
-        {
-            const auto sizeOfMipLevel = texture->GetSizeOfMipLevel(currentMipLevel) * texture->GetFaceCount();
-            currentFileSize += sizeOfMipLevel;
-
-            if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi27::IwiHeader::fileSizeForPicmip)>)
-                && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
-            {
-                std::cerr << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
-                return nullptr;
-            }
-
-            stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
-            if (stream.gcount() != sizeOfMipLevel)
-            {
-                std::cerr << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
-                return nullptr;
-            }
-        }
+        if (!ValidateFileSizeForPicmip(header, *texture))
+            return nullptr;
 
         return texture;
     }
 
-    std::unique_ptr<Texture> LoadIwi(std::istream& stream)
+    std::unique_ptr<Texture> LoadIwiHeader(std::istream& stream)
     {
         IwiVersion iwiVersion{};
 
@@ -422,16 +357,16 @@ namespace iwi
         switch (iwiVersion.version)
         {
         case 6:
-            return LoadIwi6(stream);
+            return LoadIwi6Header(stream);
 
         case 8:
-            return LoadIwi8(stream);
+            return LoadIwi8Header(stream);
 
         case 13:
-            return LoadIwi13(stream);
+            return LoadIwi13Header(stream);
 
         case 27:
-            return LoadIwi27(stream);
+            return LoadIwi27Header(stream);
 
         default:
             break;
@@ -440,4 +375,64 @@ namespace iwi
         std::cerr << std::format("Unknown IWI version {}\n", iwiVersion.version);
         return nullptr;
     }
+
+    bool LoadIwiMipLevels(std::istream& stream, Texture& texture)
+    {
+        texture.Allocate();
+
+        const auto mipMapCount = texture.HasMipMaps() ? texture.GetMipMapCount() : 1;
+        for (auto currentMipLevel = mipMapCount - 1; currentMipLevel >= 0; currentMipLevel--)
+        {
+            const auto sizeOfMipLevel = static_cast<std::streamsize>(texture.GetSizeOfMipLevel(currentMipLevel) * texture.GetFaceCount());
+
+            stream.read(reinterpret_cast<char*>(texture.GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
+            if (stream.gcount() != sizeOfMipLevel)
+            {
+                std::cerr << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::unique_ptr<Texture> LoadIwi(std::istream& stream)
+    {
+        auto texture = LoadIwiHeader(stream);
+        if (!texture || !LoadIwiMipLevels(stream, *texture))
+            return nullptr;
+
+        return texture;
+    }
+
+    size_t GetIwiMipLevelDataSize(const Texture& texture)
+    {
+        auto mipLevelDataSize = 0uz;
+        const auto textureMipCount = texture.HasMipMaps() ? texture.GetMipMapCount() : 1;
+        for (auto currentMipLevel = 0; currentMipLevel < textureMipCount; currentMipLevel++)
+            mipLevelDataSize += texture.GetSizeOfMipLevel(currentMipLevel) * texture.GetFaceCount();
+
+        return mipLevelDataSize;
+    }
+
+    bool CopyIwiMipLevelData(std::istream& iwiStream, std::ostream& stream, size_t size)
+    {
+        char buffer[COPY_BUFFER_SIZE];
+        while (size > 0)
+        {
+            const auto sizeToCopy = static_cast<std::streamsize>(std::min(size, sizeof(buffer)));
+
+            iwiStream.read(buffer, sizeToCopy);
+            if (iwiStream.gcount() != sizeToCopy)
+            {
+                std::cerr << "Unexpected eof of iwi\n";
+                return false;
+            }
+
+            stream.write(buffer, sizeToCopy);
+            size -= static_cast<size_t>(sizeToCopy);
+        }
+
+        return true;
+    }
 } // namespace iwi
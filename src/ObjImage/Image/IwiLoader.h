@@ -4,8 +4,31 @@
 
 #include <istream>
 #include <memory>
+#include <ostream>
 
 namespace iwi
 {
     std::unique_ptr<Texture> LoadIwi(std::istream& stream);
+
+    /**
+     * \brief Reads the version and header of an iwi without reading its mip level data.
+     * \return A texture describing the iwi that is not allocated yet or \c nullptr if the iwi is invalid.
+     * The stream is left at the start of the mip level data which begins with the smallest mip level.
+     */
+    std::unique_ptr<Texture> LoadIwiHeader(std::istream& stream);
+
+    /**
+     * \brief Allocates a texture returned by \c LoadIwiHeader and reads its mip level data.
+     */
+    bool LoadIwiMipLevels(std::istream& stream, Texture& texture);
+
+    /**
+     * \brief The size of the mip level data of all faces of a texture returned by \c LoadIwiHeader.
+     */
+    size_t GetIwiMipLevelDataSize(const Texture& texture);
+
+    /**
+     * \brief Copies mip level data of an iwi to another stream in chunks instead of reading it into a texture.
+     */
+    bool CopyIwiMipLevelData(std::istream& iwiStream, std::ostream& stream, size_t size);
 }; // namespace iwi
@@ -1,5 +1,7 @@
 #include "IwiWriter13.h"
 
+#include "Image/IwiLoader.h"
+
 #include <cassert>
 #include <ostream>
 
@@ -86,10 +88,8 @@ void IwiWriter::FillHeader3D(IwiHeader& header, const Texture3D& texture)
     header.flags |= IMG_FLAG_VOLMAP;
 }
 
-void IwiWriter::DumpImage(std::ostream& stream, const Texture* texture)
+bool IwiWriter::WriteHeader(std::ostream& stream, const Texture* texture)
 {
-    assert(texture != nullptr);
-
     WriteVersion(stream);
 
     IwiHeader header{};
@@ -128,14 +128,41 @@ void IwiWriter::DumpImage(std::ostream& stream, const Texture* texture)
     else
     {
         assert(false);
-        return;
+        return false;
     }
 
     stream.write(reinterpret_cast<char*>(&header), sizeof(IwiHeader));
 
+    return true;
+}
+
+void IwiWriter::DumpImage(std::ostream& stream, const Texture* texture)
+{
+    assert(texture != nullptr);
+
+    if (!WriteHeader(stream, texture))
+        return;
+
+    const auto textureMipCount = texture->HasMipMaps() ? texture->GetMipMapCount() : 1;
     for (auto currentMipLevel = textureMipCount - 1; currentMipLevel >= 0; currentMipLevel--)
     {
         const auto mipLevelSize = texture->GetSizeOfMipLevel(currentMipLevel) * texture->GetFaceCount();
         stream.write(reinterpret_cast<const char*>(texture->GetBufferForMipLevel(currentMipLevel)), mipLevelSize);
     }
 }
+
+bool IwiWriter::SupportsIwiPassthrough(const ImageFormat* imageFormat)
+{
+    return true;
+}
+
+bool IwiWriter::DumpIwiPassthrough(std::ostream& stream, const Texture* texture, std::istream& iwiStream)
+{
+    assert(texture != nullptr);
+
+    if (!WriteHeader(stream, texture))
+        return false;
+
+    // Iwis of all versions store their mip levels in the same order so only the header needs to be rewritten
+    return iwi::CopyIwiMipLevelData(iwiStream, stream, iwi::GetIwiMipLevelDataSize(*texture));
+}
@@ -13,6 +13,7 @@ namespace iwi6
         static void FillHeader2D(IwiHeader& header, const Texture2D& texture);
         static void FillHeaderCube(IwiHeader& header, const TextureCube& texture);
         static void FillHeader3D(IwiHeader& header, const Texture3D& texture);
+        static bool WriteHeader(std::ostream& stream, const Texture* texture);
 
     public:
         IwiWriter();
@@ -26,5 +27,7 @@ namespace iwi6
         bool SupportsImageFormat(const ImageFormat* imageFormat) override;
         std::string GetFileExtension() override;
         void DumpImage(std::ostream& stream, const Texture* texture) override;
+        bool SupportsIwiPassthrough(const ImageFormat* imageFormat) override;
+        bool DumpIwiPassthrough(std::ostream& stream, const Texture* texture, std::istream& iwiStream) override;
     };
 } // namespace iwi6
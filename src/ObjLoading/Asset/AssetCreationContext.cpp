@@ -15,8 +15,17 @@ IgnoredAssetLookup::IgnoredAssetLookup(const AssetList& assetList)
     }
 }
 
+IgnoredAssetLookup::IgnoredAssetLookup(const AssetList& assetList, std::shared_ptr<const AssetHashSet> ignoredAssetSet)
+    : IgnoredAssetLookup(assetList)
+{
+    m_ignored_asset_set = std::move(ignoredAssetSet);
+}
+
 bool IgnoredAssetLookup::IsAssetIgnored(asset_type_t assetType, const std::string& name) const
 {
+    if (m_ignored_asset_set && m_ignored_asset_set->Contains(assetType, name))
+        return true;
+
     const auto entries = m_ignored_asset_lookup.equal_range(name);
 
     for (auto i = entries.first; i != entries.second; ++i)
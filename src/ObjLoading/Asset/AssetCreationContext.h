@@ -4,6 +4,7 @@
 #include "AssetRegistration.h"
 #include "Game/IAsset.h"
 #include "Pool/XAssetInfo.h"
+#include "Zone/AssetList/AssetHashSet.h"
 #include "Zone/AssetList/AssetList.h"
 #include "Zone/ZoneTypes.h"
 
@@ -21,9 +22,15 @@ public:
     IgnoredAssetLookup();
     explicit IgnoredAssetLookup(const AssetList& assetList);
 
+    /**
+     * \brief Ignores all assets of the specified list as well as all assets of a set that is shared between zones, e.g. the assets of ignored zones.
+     */
+    IgnoredAssetLookup(const AssetList& assetList, std::shared_ptr<const AssetHashSet> ignoredAssetSet);
+
     [[nodiscard]] bool IsAssetIgnored(asset_type_t assetType, const std::string& name) const;
 
     std::unordered_multimap<std::string, asset_type_t> m_ignored_asset_lookup;
+    std::shared_ptr<const AssetHashSet> m_ignored_asset_set;
 };
 
 class AssetCreationContext : public ZoneAssetCreationStateContainer
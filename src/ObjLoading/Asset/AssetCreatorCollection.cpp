@@ -1,8 +1,12 @@
 #include "AssetCreatorCollection.h"
 
+#include "Utils/Tracing.h"
+
+#include <algorithm>
 #include <cassert>
 
 AssetCreatorCollection::AssetCreatorCollection(const Zone& zone)
+    : m_zone(zone)
 {
     m_asset_creators_by_type.resize(zone.m_pools->GetAssetTypeCount());
     m_asset_post_processors_by_type.resize(zone.m_pools->GetAssetTypeCount());
@@ -39,27 +43,61 @@ void AssetCreatorCollection::AddDefaultAssetCreator(std::unique_ptr<IDefaultAsse
         m_default_asset_creators_by_type[handlingAssetType] = std::move(defaultAssetCreator);
 }
 
+void AssetCreatorCollection::BuildSourceIndex(ISearchPath& searchPath)
+{
+    const utils::TraceScope trace("create_asset", "build_source_index");
+
+    m_source_index.emplace();
+    m_source_index->AddFilesOfSearchPath(searchPath);
+}
+
+void AssetCreatorCollection::PrepareAssets(const asset_type_t assetType, const std::vector<std::string>& assetNames) const
+{
+    assert(assetType >= 0 && static_cast<unsigned>(assetType) < m_asset_creators_by_type.size());
+
+    if (assetType < 0 || static_cast<unsigned>(assetType) >= m_asset_creators_by_type.size())
+        return;
+
+    for (const auto& creator : m_asset_creators_by_type[assetType])
+        creator->PrepareAssets(assetNames);
+}
+
 AssetCreationResult AssetCreatorCollection::CreateAsset(const asset_type_t assetType, const std::string& assetName, AssetCreationContext& context) const
 {
     assert(assetType >= 0 && static_cast<unsigned>(assetType) < m_asset_creators_by_type.size());
 
+    const utils::TraceScope trace(
+        "create_asset", utils::IsTracingEnabled() ? m_zone.m_pools->GetAssetTypeName(assetType).value_or("unknown") : "", assetName);
+
     if (assetType >= 0 && static_cast<unsigned>(assetType) < m_asset_creators_by_type.size())
     {
-        for (const auto& creator : m_asset_creators_by_type[assetType])
+        const auto& creators = m_asset_creators_by_type[assetType];
+        auto hasSkippedCreator = false;
+        for (const auto& creator : creators)
         {
+            if (!MayHaveSource(*creator, assetName))
+            {
+                hasSkippedCreator = true;
+                continue;
+            }
+
             const auto result = creator->CreateAsset(assetName, context);
             if (result.HasTakenAction())
+                return PostProcessResult(assetType, result, context);
+        }
+
+        // The source index may be stale, so probe the skipped creators before giving up.
+        // Creators keep their order among each other but now come after the creators that were already tried.
+        if (hasSkippedCreator)
+        {
+            for (const auto& creator : creators)
             {
-                // Post process asset if creation was successful
-                if (result.HasBeenSuccessful())
-                {
-                    assert(static_cast<unsigned>(assetType) < m_asset_post_processors_by_type.size());
-                    for (auto* postProcessor : m_asset_post_processors_by_type[assetType])
-                        postProcessor->PostProcessAsset(*result.GetAssetInfo(), context);
-                }
-
-                // Return result that was either successful or failed
-                return result;
+                if (MayHaveSource(*creator, assetName))
+                    continue;
+
+                const auto result = creator->CreateAsset(assetName, context);
+                if (result.HasTakenAction())
+                    return PostProcessResult(assetType, result, context);
             }
         }
     }
@@ -79,10 +117,45 @@ AssetCreationResult AssetCreatorCollection::CreateDefaultAsset(const asset_type_
     return AssetCreationResult::NoAction();
 }
 
-void AssetCreatorCollection::FinalizeZone(AssetCreationContext& context) const
+bool AssetCreatorCollection::FinalizeZone(AssetCreationContext& context) const
 {
+    // Every creator and post processor is finalized even after a failure to report all errors at once
+    auto success = true;
     for (const auto& creator : m_asset_creators)
-        creator->FinalizeZone(context);
+        success = creator->FinalizeZone(context) && success;
     for (const auto& postProcessor : m_asset_post_processors)
-        postProcessor->FinalizeZone(context);
+        success = postProcessor->FinalizeZone(context) && success;
+
+    return success;
+}
+
+bool AssetCreatorCollection::MayHaveSource(const IAssetCreator& creator, const std::string& assetName) const
+{
+    if (!m_source_index)
+        return true;
+
+    const auto probedFileNames = creator.GetProbedFileNames(assetName);
+    if (probedFileNames.empty())
+        return true;
+
+    return std::ranges::any_of(probedFileNames,
+                               [this](const std::string& fileName)
+                               {
+                                   return m_source_index->ContainsFile(fileName);
+                               });
+}
+
+AssetCreationResult
+    AssetCreatorCollection::PostProcessResult(const asset_type_t assetType, const AssetCreationResult& result, AssetCreationContext& context) const
+{
+    // Post process asset if creation was successful
+    if (result.HasBeenSuccessful())
+    {
+        assert(static_cast<unsigned>(assetType) < m_asset_post_processors_by_type.size());
+        for (auto* postProcessor : m_asset_post_processors_by_type[assetType])
+            postProcessor->PostProcessAsset(*result.GetAssetInfo(), context);
+    }
+
+    // Return result that was either successful or failed
+    return result;
 }
@@ -1,13 +1,17 @@
 #pragma once
 
 #include "AssetCreationContext.h"
+#include "AssetSourceIndex.h"
 #include "Game/IGame.h"
 #include "IAssetCreator.h"
 #include "IAssetPostProcessor.h"
 #include "IDefaultAssetCreator.h"
+#include "SearchPath/ISearchPath.h"
 #include "Zone/ZoneTypes.h"
 
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 class AssetCreationContext;
@@ -25,14 +29,27 @@ public:
     void AddAssetPostProcessor(std::unique_ptr<IAssetPostProcessor> postProcessor);
     void AddDefaultAssetCreator(std::unique_ptr<IDefaultAssetCreator> defaultAssetCreator);
 
+    /**
+     * \brief Enumerates the search path once to be able to skip creators whose probed files do not exist.
+     * Files added to the search path afterwards are still found since skipped creators are tried when no other creator took action.
+     * Their creators do not keep their position in the creator order though: all other creators of the asset type are tried first.
+     */
+    void BuildSourceIndex(ISearchPath& searchPath);
+
+    void PrepareAssets(asset_type_t assetType, const std::vector<std::string>& assetNames) const;
     AssetCreationResult CreateAsset(asset_type_t assetType, const std::string& assetName, AssetCreationContext& context) const;
     AssetCreationResult CreateDefaultAsset(asset_type_t assetType, const std::string& assetName, AssetCreationContext& context) const;
-    void FinalizeZone(AssetCreationContext& context) const;
+    [[nodiscard]] bool FinalizeZone(AssetCreationContext& context) const;
 
 private:
+    [[nodiscard]] bool MayHaveSource(const IAssetCreator& creator, const std::string& assetName) const;
+    AssetCreationResult PostProcessResult(asset_type_t assetType, const AssetCreationResult& result, AssetCreationContext& context) const;
+
+    const Zone& m_zone;
     std::vector<std::vector<IAssetCreator*>> m_asset_creators_by_type;
     std::vector<std::unique_ptr<IAssetCreator>> m_asset_creators;
     std::vector<std::vector<IAssetPostProcessor*>> m_asset_post_processors_by_type;
     std::vector<std::unique_ptr<IAssetPostProcessor>> m_asset_post_processors;
     std::vector<std::unique_ptr<IDefaultAssetCreator>> m_default_asset_creators_by_type;
+    std::optional<AssetSourceIndex> m_source_index;
 };
@@ -0,0 +1,47 @@
+#include "AssetSourceIndex.h"
+
+#include "Utils/StringUtils.h"
+
+#include <algorithm>
+
+void AssetSourceIndex::AddFilesOfSearchPath(ISearchPath& searchPath)
+{
+    searchPath.Find(
+        [this](const std::string& filePath)
+        {
+            AddFile(filePath);
+        });
+}
+
+void AssetSourceIndex::AddFile(const std::string& filePath)
+{
+    const auto normalizedPath = NormalizeFileName(filePath);
+
+    // Filesystem search paths report their files prefixed with the search path itself.
+    // Since the prefix is not known here, every suffix that starts after a separator is indexed as a possible relative name.
+    m_file_names.emplace(normalizedPath);
+    for (auto separatorPos = normalizedPath.find('/'); separatorPos != std::string::npos; separatorPos = normalizedPath.find('/', separatorPos + 1u))
+    {
+        if (separatorPos + 1u < normalizedPath.size())
+            m_file_names.emplace(normalizedPath.substr(separatorPos + 1u));
+    }
+}
+
+bool AssetSourceIndex::ContainsFile(const std::string& fileName) const
+{
+    return m_file_names.contains(NormalizeFileName(fileName));
+}
+
+size_t AssetSourceIndex::GetEntryCount() const
+{
+    return m_file_names.size();
+}
+
+std::string AssetSourceIndex::NormalizeFileName(const std::string& fileName)
+{
+    auto normalizedName = fileName;
+    std::ranges::replace(normalizedName, '\\', '/');
+    utils::MakeStringLowerCase(normalizedName);
+
+    return normalizedName;
+}
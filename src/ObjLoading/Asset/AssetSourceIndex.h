@@ -0,0 +1,41 @@
+#pragma once
+
+#include "SearchPath/ISearchPath.h"
+
+#include <string>
+#include <unordered_set>
+
+/**
+ * \brief An index of all files of a search path that is built from a single enumeration of the search path.
+ * It is used to skip asset creators whose files are not present instead of probing the search path for each of them.
+ * File names are compared case insensitively and regardless of the path separator,
+ * so the index may report files that cannot be opened but never misses a file that can.
+ */
+class AssetSourceIndex
+{
+public:
+    AssetSourceIndex() = default;
+
+    /**
+     * \brief Adds all files of the search path to the index.
+     */
+    void AddFilesOfSearchPath(ISearchPath& searchPath);
+
+    /**
+     * \brief Adds a single file to the index.
+     * \param filePath The path of the file either relative to a search path or prefixed with the path of a search path.
+     */
+    void AddFile(const std::string& filePath);
+
+    /**
+     * \brief Checks whether a file with the specified name relative to a search path may exist.
+     */
+    [[nodiscard]] bool ContainsFile(const std::string& fileName) const;
+
+    [[nodiscard]] size_t GetEntryCount() const;
+
+private:
+    static std::string NormalizeFileName(const std::string& fileName);
+
+    std::unordered_set<std::string> m_file_names;
+};
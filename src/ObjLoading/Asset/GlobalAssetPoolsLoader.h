@@ -1,5 +1,6 @@
 #pragma once
 #include "Asset/IAssetCreator.h"
+#include "Asset/ReusedAssetImportState.h"
 #include "Pool/GlobalAssetPool.h"
 
 template<typename AssetType> class GlobalAssetPoolsLoader : public AssetCreator<AssetType>
@@ -19,6 +20,8 @@ public:
         if (!existingAsset)
             return AssetCreationResult::NoAction();
 
+        auto& importState = context.GetZoneAssetCreationState<ReusedAssetImportState>();
+
         AssetRegistration<AssetType> registration(assetName, existingAsset->Asset());
 
         for (const auto* dependency : existingAsset->m_dependencies)
@@ -34,11 +37,11 @@ public:
             registration.AddIndirectAssetReference(context.LoadIndirectAssetReferenceGeneric(indirectAssetReference.m_type, indirectAssetReference.m_name));
 
         // Make sure any used script string is available in the created zone
-        // The replacement of the scr_string_t values will be done upon writing
-        for (const auto scrString : existingAsset->m_used_script_strings)
-            m_zone.m_script_strings.AddOrGetScriptString(existingAsset->m_zone->m_script_strings.CValue(scrString));
+        importState.ImportScriptStrings(*existingAsset);
 
         auto* newAsset = context.AddAsset(std::move(registration));
+        if (!newAsset)
+            return AssetCreationResult::Failure();
 
         // Make sure we remember this asset came from another zone
         newAsset->m_zone = existingAsset->m_zone;
@@ -10,6 +10,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 class AssetCreationContext;
 
@@ -25,7 +26,31 @@ public:
 
     [[nodiscard]] virtual std::optional<asset_type_t> GetHandlingAssetType() const = 0;
     virtual AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) = 0;
-    virtual void FinalizeZone(AssetCreationContext& context){};
+
+    /**
+     * \brief Returns the names of the files relative to the search path that are probed when creating the asset with the specified name.
+     * The creator is skipped when none of these files exist.
+     * Creators that do not only load from files of the search path return an empty list to always be tried.
+     */
+    [[nodiscard]] virtual std::vector<std::string> GetProbedFileNames(const std::string& assetName) const
+    {
+        return {};
+    }
+
+    /**
+     * \brief Called with the names of all assets of the handled type that are listed in the zone definition before any of them are created.
+     * Creators can use this to prepare work that can be done for all assets at once, like parsing their files in parallel.
+     */
+    virtual void PrepareAssets(const std::vector<std::string>& assetNames) {}
+
+    /**
+     * \brief Called after all assets of the zone were created to complete work that was deferred until then.
+     * \return \c true if the zone can be written, \c false if finalizing failed and the zone must not be written.
+     */
+    virtual bool FinalizeZone(AssetCreationContext& context)
+    {
+        return true;
+    }
 };
 
 template<typename AssetType> class AssetCreator : public IAssetCreator
@@ -25,5 +25,13 @@ public:
 
     [[nodiscard]] virtual asset_type_t GetHandlingAssetType() const = 0;
     virtual void PostProcessAsset(XAssetInfoGeneric& assetInfo, AssetCreationContext& context) = 0;
-    virtual void FinalizeZone(AssetCreationContext& context){};
+
+    /**
+     * \brief Called after all assets of the zone were created.
+     * \return \c true if the zone can be written, \c false if finalizing failed and the zone must not be written.
+     */
+    virtual bool FinalizeZone(AssetCreationContext& context)
+    {
+        return true;
+    }
 };
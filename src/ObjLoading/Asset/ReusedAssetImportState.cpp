@@ -0,0 +1,39 @@
+#include "ReusedAssetImportState.h"
+
+#include <cassert>
+
+ReusedAssetImportState::ReusedAssetImportState()
+    : m_zone(nullptr)
+{
+}
+
+void ReusedAssetImportState::Inject(ZoneAssetCreationInjection& inject)
+{
+    m_zone = &inject.m_zone;
+}
+
+void ReusedAssetImportState::ImportScriptStrings(const XAssetInfoGeneric& sourceAsset)
+{
+    assert(m_zone);
+    assert(sourceAsset.m_zone);
+
+    if (sourceAsset.m_used_script_strings.empty())
+        return;
+
+    const auto& sourceScriptStrings = sourceAsset.m_zone->m_script_strings;
+    auto& imported = m_imported_script_strings[sourceAsset.m_zone];
+
+    // Size the table once for all script strings of the source zone, it does not change after the zone has been loaded
+    if (imported.size() < sourceScriptStrings.Count())
+        imported.resize(sourceScriptStrings.Count());
+
+    for (const auto scrString : sourceAsset.m_used_script_strings)
+    {
+        assert(scrString < imported.size());
+        if (scrString >= imported.size() || imported[scrString])
+            continue;
+
+        m_zone->m_script_strings.AddOrGetScriptString(sourceScriptStrings.CValue(scrString));
+        imported[scrString] = true;
+    }
+}
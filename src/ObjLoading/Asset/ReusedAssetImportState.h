@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Asset/IZoneAssetCreationState.h"
+#include "Pool/XAssetInfo.h"
+#include "Zone/Zone.h"
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief Remembers which script strings of already loaded zones have been imported by the zone that is being created.
+ * Script strings that are shared by many reused assets are therefore only looked up once.
+ */
+class ReusedAssetImportState final : public IZoneAssetCreationState
+{
+public:
+    ReusedAssetImportState();
+
+    void Inject(ZoneAssetCreationInjection& inject) override;
+
+    /**
+     * \brief Makes sure all script strings used by the specified asset of a loaded zone are available in the created zone.
+     * The replacement of the scr_string_t values is still done upon writing.
+     */
+    void ImportScriptStrings(const XAssetInfoGeneric& sourceAsset);
+
+private:
+    Zone* m_zone;
+    std::unordered_map<const Zone*, std::vector<bool>> m_imported_script_strings;
+};
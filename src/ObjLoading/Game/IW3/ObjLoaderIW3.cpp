@@ -17,6 +17,11 @@ void ObjLoader::LoadReferencedContainersForZone(ISearchPath& searchPath, Zone& z
 
 void ObjLoader::UnloadContainersOfZone(Zone& zone) const {}
 
+bool ObjLoader::HasContainersOfZone(Zone& zone) const
+{
+    return false;
+}
+
 namespace
 {
     void ConfigureDefaultCreators(AssetCreatorCollection& collection, Zone& zone)
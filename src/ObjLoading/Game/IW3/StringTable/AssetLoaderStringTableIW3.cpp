@@ -18,6 +18,11 @@ namespace
         {
         }
 
+        [[nodiscard]] std::vector<std::string> GetProbedFileNames(const std::string& assetName) const override
+        {
+            return {assetName};
+        }
+
         AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) override
         {
             const auto file = m_search_path.Open(assetName);
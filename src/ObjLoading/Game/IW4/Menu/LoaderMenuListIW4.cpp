@@ -5,15 +5,35 @@
 #include "Game/IW4/Menu/MenuConverterIW4.h"
 #include "ObjLoading.h"
 #include "Parsing/Menu/MenuFileReader.h"
+#include "SearchPath/SearchPathSynchronized.h"
+#include "Utils/Parallel.h"
+#include "Utils/StringUtils.h"
 
+#include <algorithm>
 #include <cstring>
 #include <format>
 #include <iostream>
+#include <sstream>
+#include <unordered_set>
 
 using namespace IW4;
 
 namespace
 {
+    /**
+     * \brief The result of parsing a menu file ahead of time, concurrently with the other menu files of a menu list.
+     */
+    class PreParsedMenuFile
+    {
+    public:
+        bool m_parsed = false;
+        bool m_opened = false;
+        std::unique_ptr<menu::ParsingResult> m_result;
+
+        // Printed once the file is loaded to not interleave the output of files that are parsed at the same time
+        std::string m_diagnostics;
+    };
+
     class MenuListLoader final : public AssetCreator<AssetMenuList>
     {
     public:
@@ -40,7 +60,7 @@ namespace
                 if (!file.IsOpen())
                     return AssetCreationResult::NoAction();
 
-                const auto menuListResult = ParseMenuFile(*file.m_stream, assetName, zoneState);
+                const auto menuListResult = ParseMenuFile(*file.m_stream, assetName, zoneState, m_search_path, false, std::cerr);
                 if (menuListResult)
                 {
                     ProcessParsedResults(assetName, context, *menuListResult, zoneState, conversionState, menus, registration);
@@ -54,14 +74,9 @@ namespace
                     return AssetCreationResult::Failure();
             }
 
-            while (!menuLoadQueue.empty())
-            {
-                const auto& menuFileToLoad = menuLoadQueue.front();
-
-                LoadMenuFileFromQueue(menuFileToLoad, context, zoneState, conversionState, menus, registration);
-
-                menuLoadQueue.pop_front();
-            }
+            auto preParsedMenuFiles = PreParseMenuFiles(menuLoadQueue, zoneState, conversionState);
+            for (auto i = 0uz; i < menuLoadQueue.size(); i++)
+                LoadMenuFileFromQueue(menuLoadQueue[i], preParsedMenuFiles[i], context, zoneState, conversionState, menus, registration);
 
             auto* menuListAsset = m_memory.Alloc<MenuList>();
             menuListAsset->name = m_memory.Dup(assetName.c_str());
@@ -72,13 +87,92 @@ namespace
             return AssetCreationResult::Success(context.AddAsset(std::move(registration)));
         }
 
-        void FinalizeZone(AssetCreationContext& context) override
+        bool FinalizeZone(AssetCreationContext& context) override
         {
             context.GetZoneAssetCreationState<MenuConversionZoneState>().FinalizeSupportingData();
+            return true;
         }
 
     private:
+        /**
+         * \brief Parses all menu files of the queue that were not loaded yet concurrently.
+         * Menu files are parsed against the current zone state and may call functions they do not know yet.
+         * Results are only used when they are identical to parsing the files one after another, see \c CanUsePreParsedResult.
+         */
+        std::vector<PreParsedMenuFile> PreParseMenuFiles(const std::deque<std::string>& menuLoadQueue,
+                                                         const menu::MenuAssetZoneState& zoneState,
+                                                         const MenuConversionZoneState& conversionState) const
+        {
+            std::vector<PreParsedMenuFile> preParsedMenuFiles(menuLoadQueue.size());
+
+            std::vector<size_t> indicesToParse;
+            std::unordered_set<std::string> filesToParse;
+            for (auto i = 0uz; i < menuLoadQueue.size(); i++)
+            {
+                if (!conversionState.m_menus_by_filename.contains(menuLoadQueue[i]) && filesToParse.emplace(menuLoadQueue[i]).second)
+                    indicesToParse.emplace_back(i);
+            }
+
+            // Search paths are not necessarily thread-safe
+            SearchPathSynchronized searchPath(m_search_path);
+
+            utils::ParallelFor(indicesToParse.size(),
+                               [&](const size_t index)
+                               {
+                                   const auto& menuFilePath = menuLoadQueue[indicesToParse[index]];
+                                   auto& preParsedMenuFile = preParsedMenuFiles[indicesToParse[index]];
+                                   preParsedMenuFile.m_parsed = true;
+
+                                   const auto file = searchPath.Open(menuFilePath);
+                                   if (!file.IsOpen())
+                                       return;
+
+                                   preParsedMenuFile.m_opened = true;
+
+                                   std::ostringstream diagnostics;
+                                   preParsedMenuFile.m_result = ParseMenuFile(*file.m_stream, menuFilePath, zoneState, searchPath, true, diagnostics);
+                                   preParsedMenuFile.m_diagnostics = std::move(diagnostics).str();
+                               });
+
+            return preParsedMenuFiles;
+        }
+
+        /**
+         * \brief Checks whether a menu file that was parsed ahead of time has the same result as parsing it now.
+         * This is not the case when it depends on functions or menus of menu files that were loaded since.
+         */
+        static bool CanUsePreParsedResult(const menu::ParsingResult& parsingResult, const menu::MenuAssetZoneState& zoneState)
+        {
+            for (const auto& functionName : parsingResult.m_deferred_function_names)
+            {
+                if (!zoneState.m_functions_by_name.contains(functionName))
+                    return false;
+            }
+
+            for (const auto& function : parsingResult.m_functions)
+            {
+                auto lowerCaseName = function->m_name;
+                utils::MakeStringLowerCase(lowerCaseName);
+                if (zoneState.m_functions_by_name.contains(lowerCaseName))
+                    return false;
+            }
+
+            for (const auto& menu : parsingResult.m_menus)
+            {
+                const auto menuAlreadyExists = std::ranges::any_of(zoneState.m_menus,
+                                                                   [&menu](const std::unique_ptr<menu::CommonMenuDef>& existingMenu)
+                                                                   {
+                                                                       return existingMenu->m_name == menu->m_name;
+                                                                   });
+                if (menuAlreadyExists)
+                    return false;
+            }
+
+            return true;
+        }
+
         bool LoadMenuFileFromQueue(const std::string& menuFilePath,
+                                   PreParsedMenuFile& preParsedMenuFile,
                                    AssetCreationContext& context,
                                    menu::MenuAssetZoneState& zoneState,
                                    MenuConversionZoneState& conversionState,
@@ -97,14 +191,31 @@ namespace
                 return true;
             }
 
-            const auto file = m_search_path.Open(menuFilePath);
-            if (!file.IsOpen())
+            std::unique_ptr<menu::ParsingResult> menuFileResult;
+            if (preParsedMenuFile.m_parsed && !preParsedMenuFile.m_opened)
             {
                 std::cerr << std::format("Could not open menu file \"{}\"\n", menuFilePath);
                 return false;
             }
 
-            const auto menuFileResult = ParseMenuFile(*file.m_stream, menuFilePath, zoneState);
+            // Failing to parse ahead of time means failing now as well since the zone state only grew in the meantime
+            if (preParsedMenuFile.m_parsed && (!preParsedMenuFile.m_result || CanUsePreParsedResult(*preParsedMenuFile.m_result, zoneState)))
+            {
+                std::cerr << preParsedMenuFile.m_diagnostics;
+                menuFileResult = std::move(preParsedMenuFile.m_result);
+            }
+            else
+            {
+                const auto file = m_search_path.Open(menuFilePath);
+                if (!file.IsOpen())
+                {
+                    std::cerr << std::format("Could not open menu file \"{}\"\n", menuFilePath);
+                    return false;
+                }
+
+                menuFileResult = ParseMenuFile(*file.m_stream, menuFilePath, zoneState, m_search_path, false, std::cerr);
+            }
+
             if (menuFileResult)
             {
                 ProcessParsedResults(menuFilePath, context, *menuFileResult, zoneState, conversionState, menus, registration);
@@ -197,12 +308,19 @@ namespace
         }
 
         std::unique_ptr<menu::ParsingResult>
-            ParseMenuFile(std::istream& stream, const std::string& menuFileName, const menu::MenuAssetZoneState& zoneState) const
+            ParseMenuFile(std::istream& stream,
+                          const std::string& menuFileName,
+                          const menu::MenuAssetZoneState& zoneState,
+                          ISearchPath& searchPath,
+                          const bool deferUnknownFunctions,
+                          std::ostream& diagnosticStream) const
         {
-            menu::MenuFileReader reader(stream, menuFileName, menu::FeatureLevel::IW4, m_search_path);
+            menu::MenuFileReader reader(stream, menuFileName, menu::FeatureLevel::IW4, searchPath);
 
             reader.IncludeZoneState(zoneState);
             reader.SetPermissiveMode(ObjLoading::Configuration.MenuPermissiveParsing);
+            reader.SetDeferUnknownFunctions(deferUnknownFunctions);
+            reader.SetDiagnosticStream(diagnosticStream);
 
             return reader.ReadMenuFile();
         }
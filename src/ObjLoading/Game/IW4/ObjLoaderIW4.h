@@ -11,6 +11,7 @@ namespace IW4
     public:
         void LoadReferencedContainersForZone(ISearchPath& searchPath, Zone& zone) const override;
         void UnloadContainersOfZone(Zone& zone) const override;
+        bool HasContainersOfZone(Zone& zone) const override;
 
         void ConfigureCreatorCollection(AssetCreatorCollection& collection, Zone& zone, ISearchPath& searchPath, IGdtQueryable& gdt) const override;
     };
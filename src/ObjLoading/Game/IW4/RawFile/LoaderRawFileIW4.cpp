@@ -1,19 +1,17 @@
 #include "LoaderRawFileIW4.h"
 
 #include "Game/IW4/IW4.h"
+#include "RawFile/RawFileCompressor.h"
 
 #include <cstring>
 #include <filesystem>
-#include <format>
-#include <iostream>
+#include <span>
 #include <zlib.h>
 
 using namespace IW4;
 
 namespace
 {
-    constexpr size_t COMPRESSED_BUFFER_SIZE_PADDING = 64u;
-
     class RawFileLoader final : public AssetCreator<AssetRawFile>
     {
     public:
@@ -23,59 +21,48 @@ namespace
         {
         }
 
+        [[nodiscard]] std::vector<std::string> GetProbedFileNames(const std::string& assetName) const override
+        {
+            return {assetName};
+        }
+
         AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) override
         {
             const auto file = m_search_path.Open(assetName);
             if (!file.IsOpen())
                 return AssetCreationResult::NoAction();
 
-            const auto uncompressedBuffer = std::make_unique<char[]>(static_cast<size_t>(file.m_length));
-            file.m_stream->read(uncompressedBuffer.get(), file.m_length);
+            std::string uncompressedData(static_cast<size_t>(file.m_length), '\0');
+            file.m_stream->read(uncompressedData.data(), file.m_length);
             if (file.m_stream->gcount() != file.m_length)
                 return AssetCreationResult::Failure();
 
-            const auto compressionBufferSize = static_cast<size_t>(file.m_length + COMPRESSED_BUFFER_SIZE_PADDING);
-            auto* compressedBuffer = m_memory.Alloc<char>(compressionBufferSize);
-
-            z_stream_s zs{};
-
-            zs.zalloc = Z_NULL;
-            zs.zfree = Z_NULL;
-            zs.opaque = Z_NULL;
-            zs.avail_in = static_cast<uInt>(file.m_length);
-            zs.avail_out = static_cast<unsigned>(compressionBufferSize);
-            zs.next_in = reinterpret_cast<const Bytef*>(uncompressedBuffer.get());
-            zs.next_out = reinterpret_cast<Bytef*>(compressedBuffer);
-
-            int ret = deflateInit(&zs, Z_DEFAULT_COMPRESSION);
-
-            if (ret != Z_OK)
-            {
-                throw std::runtime_error("Initializing deflate failed");
-            }
-
-            ret = deflate(&zs, Z_FINISH);
-
-            if (ret != Z_STREAM_END)
-            {
-                std::cerr << std::format("Deflate failed for loading rawfile \"{}\"\n", assetName);
-                deflateEnd(&zs);
-                return AssetCreationResult::Failure();
-            }
-
-            const auto compressedSize = compressionBufferSize - zs.avail_out;
-
             auto* rawFile = m_memory.Alloc<RawFile>();
             rawFile->name = m_memory.Dup(assetName.c_str());
-            rawFile->compressedLen = static_cast<int>(compressedSize);
             rawFile->len = static_cast<int>(file.m_length);
-            rawFile->data.compressedBuffer = static_cast<const char*>(compressedBuffer);
 
-            deflateEnd(&zs);
+            // The compressed data is filled in before the zone is written
+            auto& compressor = context.GetZoneAssetCreationState<RawFileCompressor>();
+            compressor.Enqueue(assetName,
+                               std::move(uncompressedData),
+                               MAX_WBITS,
+                               [this, rawFile](const std::span<const char> compressedData)
+                               {
+                                   auto* compressedBuffer = m_memory.Alloc<char>(compressedData.size());
+                                   std::memcpy(compressedBuffer, compressedData.data(), compressedData.size());
+
+                                   rawFile->compressedLen = static_cast<int>(compressedData.size());
+                                   rawFile->data.compressedBuffer = compressedBuffer;
+                               });
 
             return AssetCreationResult::Success(context.AddAsset<AssetRawFile>(assetName, rawFile));
         }
 
+        bool FinalizeZone(AssetCreationContext& context) override
+        {
+            return context.GetZoneAssetCreationState<RawFileCompressor>().CompressQueued();
+        }
+
     private:
         MemoryManager& m_memory;
         ISearchPath& m_search_path;
@@ -4,6 +4,7 @@
 #include "Game/IW4/Shader/LoaderPixelShaderIW4.h"
 #include "Game/IW4/Shader/LoaderVertexShaderIW4.h"
 #include "Game/IW4/TechsetConstantsIW4.h"
+#include "Parsing/ParsedFileCache.h"
 #include "Shader/D3D9ShaderAnalyser.h"
 #include "StateMap/StateMapReader.h"
 #include "Techset/TechniqueFileReader.h"
@@ -28,6 +29,11 @@ using namespace std::string_literals;
 
 namespace
 {
+    // Parsing results only depend on the file content, so they are shared by all zones built by this process
+    ParsedFileCache<const techset::TechsetDefinition> sharedTechsetDefinitions;
+    ParsedFileCache<const state_map::StateMapDefinition> sharedStateMapDefinitions;
+    ParsedFileCache<const d3d9::ShaderInfo> sharedShaderInfos;
+
     class LoadedTechnique
     {
     public:
@@ -92,22 +98,22 @@ namespace
             if (cachedShaderInfo != m_cached_shader_info.end())
                 return cachedShaderInfo->second.get();
 
-            const auto file = searchPath.Open(fileName);
-            if (!file.IsOpen())
+            const auto shaderData = searchPath.ReadFile(fileName);
+            if (!shaderData)
                 return nullptr;
 
-            const auto shaderSize = static_cast<size_t>(file.m_length);
-
-            if (shaderSize % sizeof(uint32_t) != 0)
+            if (shaderData->size() % sizeof(uint32_t) != 0)
             {
                 std::cerr << std::format("Invalid shader \"{}\": Size must be dividable by {}\n", fileName, sizeof(uint32_t));
                 return nullptr;
             }
 
-            const auto shaderData = std::make_unique<char[]>(shaderSize);
-            file.m_stream->read(shaderData.get(), static_cast<std::streamsize>(shaderSize));
-
-            auto shaderInfo = d3d9::ShaderAnalyser::GetShaderInfo(shaderData.get(), shaderSize);
+            auto shaderInfo = sharedShaderInfos.GetOrParse(fileName,
+                                                           *shaderData,
+                                                           [](const std::string& content)
+                                                           {
+                                                               return d3d9::ShaderAnalyser::GetShaderInfo(content.data(), content.size());
+                                                           });
             if (!shaderInfo)
                 return nullptr;
 
@@ -117,7 +123,7 @@ namespace
         }
 
     private:
-        std::unordered_map<std::string, std::unique_ptr<d3d9::ShaderInfo>> m_cached_shader_info;
+        std::unordered_map<std::string, std::shared_ptr<const d3d9::ShaderInfo>> m_cached_shader_info;
     };
 
     class TechniqueCreator final : public techset::ITechniqueDefinitionAcceptor
@@ -1309,28 +1315,37 @@ namespace
             return AssetCreationResult::Success(context.AddAsset(std::move(registration)));
         }
 
-        techset::TechsetDefinition* LoadTechsetDefinition(const std::string& assetName, AssetCreationContext& context, bool& failure) override
+        const techset::TechsetDefinition* LoadTechsetDefinition(const std::string& assetName, AssetCreationContext& context, bool& failure) override
         {
             failure = false;
             auto& definitionCache = context.GetZoneAssetCreationState<techset::TechsetDefinitionCache>();
-            auto* cachedTechsetDefinition = definitionCache.GetCachedTechsetDefinition(assetName);
+            const auto* cachedTechsetDefinition = definitionCache.GetCachedTechsetDefinition(assetName);
             if (cachedTechsetDefinition)
                 return cachedTechsetDefinition;
 
             const auto techsetFileName = GetTechsetFileName(assetName);
-            const auto file = m_search_path.Open(techsetFileName);
-            if (!file.IsOpen())
+            const auto techsetData = m_search_path.ReadFile(techsetFileName);
+            if (!techsetData)
                 return nullptr;
 
-            const techset::TechsetFileReader reader(*file.m_stream, techsetFileName, techniqueTypeNames, std::extent_v<decltype(techniqueTypeNames)>);
-            auto techsetDefinition = reader.ReadTechsetDefinition();
+            auto techsetDefinition = sharedTechsetDefinitions.GetOrParse(techsetFileName,
+                                                                         *techsetData,
+                                                                         [&techsetFileName](const std::string& content)
+                                                                         {
+                                                                             std::istringstream stream(content);
+                                                                             const techset::TechsetFileReader reader(stream,
+                                                                                                                     techsetFileName,
+                                                                                                                     techniqueTypeNames,
+                                                                                                                     std::extent_v<decltype(techniqueTypeNames)>);
+                                                                             return reader.ReadTechsetDefinition();
+                                                                         });
             if (!techsetDefinition)
             {
                 failure = true;
                 return nullptr;
             }
 
-            auto* techsetDefinitionPtr = techsetDefinition.get();
+            const auto* techsetDefinitionPtr = techsetDefinition.get();
 
             definitionCache.AddTechsetDefinitionToCache(assetName, std::move(techsetDefinition));
 
@@ -1345,12 +1360,18 @@ namespace
                 return cachedStateMap;
 
             const auto stateMapFileName = GetStateMapFileName(stateMapName);
-            const auto file = m_search_path.Open(stateMapFileName);
-            if (!file.IsOpen())
+            const auto stateMapData = m_search_path.ReadFile(stateMapFileName);
+            if (!stateMapData)
                 return nullptr;
 
-            const state_map::StateMapReader reader(*file.m_stream, stateMapFileName, stateMapName, stateMapLayout);
-            auto stateMapDefinition = reader.ReadStateMapDefinition();
+            auto stateMapDefinition = sharedStateMapDefinitions.GetOrParse(stateMapFileName,
+                                                                           *stateMapData,
+                                                                           [&stateMapFileName, &stateMapName](const std::string& content)
+                                                                           {
+                                                                               std::istringstream stream(content);
+                                                                               const state_map::StateMapReader reader(stream, stateMapFileName, stateMapName, stateMapLayout);
+                                                                               return reader.ReadStateMapDefinition();
+                                                                           });
             if (!stateMapDefinition)
                 return nullptr;
 
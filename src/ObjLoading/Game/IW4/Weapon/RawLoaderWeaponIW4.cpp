@@ -22,9 +22,14 @@ namespace
         {
         }
 
+        [[nodiscard]] std::vector<std::string> GetProbedFileNames(const std::string& assetName) const override
+        {
+            return {GetFileNameForAsset(assetName)};
+        }
+
         AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) override
         {
-            const auto fileName = std::format("weapons/{}", assetName);
+            const auto fileName = GetFileNameForAsset(assetName);
             const auto file = m_search_path.Open(fileName);
             if (!file.IsOpen())
                 return AssetCreationResult::NoAction();
@@ -40,6 +45,11 @@ namespace
         }
 
     private:
+        static std::string GetFileNameForAsset(const std::string& assetName)
+        {
+            return std::format("weapons/{}", assetName);
+        }
+
         ISearchPath& m_search_path;
         InfoStringLoaderWeapon m_info_string_loader;
     };
@@ -23,9 +23,14 @@ namespace
         {
         }
 
+        [[nodiscard]] std::vector<std::string> GetProbedFileNames(const std::string& assetName) const override
+        {
+            return {GetFileNameForAsset(assetName)};
+        }
+
         AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) override
         {
-            const auto fileName = std::format("images/{}.iwi", assetName);
+            const auto fileName = GetFileNameForAsset(assetName);
             const auto file = m_search_path.Open(fileName);
             if (!file.IsOpen())
                 return AssetCreationResult::NoAction();
@@ -55,6 +60,11 @@ namespace
         }
 
     private:
+        static std::string GetFileNameForAsset(const std::string& assetName)
+        {
+            return std::format("images/{}.iwi", assetName);
+        }
+
         MemoryManager& m_memory;
         ISearchPath& m_search_path;
     };
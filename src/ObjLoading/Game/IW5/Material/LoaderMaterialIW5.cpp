@@ -21,6 +21,11 @@ namespace
         {
         }
 
+        [[nodiscard]] std::vector<std::string> GetProbedFileNames(const std::string& assetName) const override
+        {
+            return {GetFileNameForAsset(assetName)};
+        }
+
         AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) override
         {
             const auto file = m_search_path.Open(GetFileNameForAsset(assetName));
@@ -41,7 +46,7 @@ namespace
         }
 
     private:
-        std::string GetFileNameForAsset(const std::string& assetName)
+        static std::string GetFileNameForAsset(const std::string& assetName)
         {
             std::string sanitizedFileName(assetName);
             if (sanitizedFileName[0] == '*')
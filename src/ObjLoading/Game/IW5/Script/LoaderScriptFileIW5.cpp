@@ -21,10 +21,15 @@ namespace
         {
         }
 
+        [[nodiscard]] std::vector<std::string> GetProbedFileNames(const std::string& assetName) const override
+        {
+            return {GetFileNameForAsset(assetName)};
+        }
+
         AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) override
         {
             // See https://github.com/xensik/gsc-tool#file-format for an in-depth explanation about the .gscbin format
-            const auto file = m_search_path.Open(std::format("{}.gscbin", assetName));
+            const auto file = m_search_path.Open(GetFileNameForAsset(assetName));
             if (!file.IsOpen())
                 return AssetCreationResult::NoAction();
 
@@ -74,6 +79,11 @@ namespace
         }
 
     private:
+        static std::string GetFileNameForAsset(const std::string& assetName)
+        {
+            return std::format("{}.gscbin", assetName);
+        }
+
         MemoryManager& m_memory;
         ISearchPath& m_search_path;
     };
@@ -20,9 +20,14 @@ namespace
         {
         }
 
+        [[nodiscard]] std::vector<std::string> GetProbedFileNames(const std::string& assetName) const override
+        {
+            return {GetFileNameForAsset(assetName)};
+        }
+
         AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) override
         {
-            const auto file = m_search_path.Open(std::format("attachment/{}.json", assetName));
+            const auto file = m_search_path.Open(GetFileNameForAsset(assetName));
             if (!file.IsOpen())
                 return AssetCreationResult::NoAction();
 
@@ -40,6 +45,11 @@ namespace
         }
 
     private:
+        static std::string GetFileNameForAsset(const std::string& assetName)
+        {
+            return std::format("attachment/{}.json", assetName);
+        }
+
         MemoryManager& m_memory;
         ISearchPath& m_search_path;
     };
@@ -15,6 +15,11 @@ namespace
         {
         }
 
+        void PrepareAssets(const std::vector<std::string>& assetNames) override
+        {
+            PrepareLocalizeAssets(assetNames);
+        }
+
         AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) override
         {
             return CreateLocalizeAsset(assetName, context);
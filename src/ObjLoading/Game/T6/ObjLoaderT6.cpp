@@ -280,6 +280,11 @@ namespace T6
         IIPak::Repository.RemoveContainerReferences(&zone);
     }
 
+    bool ObjLoader::HasContainersOfZone(Zone& zone) const
+    {
+        return IIPak::Repository.HasContainerReferences(&zone) || SoundBank::Repository.HasContainerReferences(&zone);
+    }
+
     namespace
     {
         void ConfigureDefaultCreators(AssetCreatorCollection& collection, Zone& zone)
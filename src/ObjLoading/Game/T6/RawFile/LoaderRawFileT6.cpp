@@ -2,11 +2,11 @@
 
 #include "Game/T6/T6.h"
 #include "Pool/GlobalAssetPool.h"
+#include "RawFile/RawFileCompressor.h"
 
 #include <cstring>
 #include <filesystem>
-#include <format>
-#include <iostream>
+#include <span>
 #include <zlib.h>
 #include <zutil.h>
 
@@ -15,8 +15,6 @@ namespace fs = std::filesystem;
 
 namespace
 {
-    constexpr size_t COMPRESSED_BUFFER_SIZE_PADDING = 64;
-
     class RawFileLoader final : public AssetCreator<AssetRawFile>
     {
     public:
@@ -26,6 +24,11 @@ namespace
         {
         }
 
+        [[nodiscard]] std::vector<std::string> GetProbedFileNames(const std::string& assetName) const override
+        {
+            return {assetName};
+        }
+
         AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) override
         {
             const auto file = m_search_path.Open(assetName);
@@ -41,53 +44,38 @@ namespace
             return LoadDefault(file, assetName, context);
         }
 
+        bool FinalizeZone(AssetCreationContext& context) override
+        {
+            return context.GetZoneAssetCreationState<RawFileCompressor>().CompressQueued();
+        }
+
     private:
         AssetCreationResult LoadAnimtree(const SearchPathOpenFile& file, const std::string& assetName, AssetCreationContext& context)
         {
-            const auto uncompressedBuffer = std::make_unique<char[]>(static_cast<size_t>(file.m_length));
-            file.m_stream->read(uncompressedBuffer.get(), file.m_length);
+            std::string uncompressedData(static_cast<size_t>(file.m_length), '\0');
+            file.m_stream->read(uncompressedData.data(), file.m_length);
             if (file.m_stream->gcount() != file.m_length)
                 return AssetCreationResult::Failure();
 
-            const auto compressionBufferSize = static_cast<size_t>(file.m_length + sizeof(uint32_t) + COMPRESSED_BUFFER_SIZE_PADDING);
-            auto* compressedBuffer = m_memory.Alloc<char>(compressionBufferSize);
-
-            z_stream_s zs{};
-
-            zs.zalloc = Z_NULL;
-            zs.zfree = Z_NULL;
-            zs.opaque = Z_NULL;
-            zs.avail_in = static_cast<uInt>(file.m_length);
-            zs.avail_out = static_cast<unsigned>(compressionBufferSize);
-            zs.next_in = reinterpret_cast<const Bytef*>(uncompressedBuffer.get());
-            zs.next_out = reinterpret_cast<Bytef*>(&compressedBuffer[sizeof(uint32_t)]);
-
-            int ret = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -DEF_WBITS, DEF_MEM_LEVEL, Z_DEFAULT_STRATEGY);
-
-            if (ret != Z_OK)
-            {
-                throw std::runtime_error("Initializing deflate failed");
-            }
-
-            ret = deflate(&zs, Z_FINISH);
-
-            if (ret != Z_STREAM_END)
-            {
-                std::cerr << std::format("Deflate failed for loading animtree file \"{}\"\n", assetName);
-                deflateEnd(&zs);
-                return AssetCreationResult::Failure();
-            }
-
-            const auto compressedSize = compressionBufferSize + sizeof(uint32_t) - zs.avail_out;
-
-            reinterpret_cast<uint32_t*>(compressedBuffer)[0] = static_cast<uint32_t>(file.m_length); // outLen
-
             auto* rawFile = m_memory.Alloc<RawFile>();
             rawFile->name = m_memory.Dup(assetName.c_str());
-            rawFile->len = static_cast<int>(compressedSize);
-            rawFile->buffer = static_cast<const char*>(compressedBuffer);
 
-            deflateEnd(&zs);
+            // The compressed data is filled in before the zone is written
+            auto& compressor = context.GetZoneAssetCreationState<RawFileCompressor>();
+            compressor.Enqueue(assetName,
+                               std::move(uncompressedData),
+                               -DEF_WBITS,
+                               [this, rawFile, uncompressedSize = file.m_length](const std::span<const char> compressedData)
+                               {
+                                   const auto bufferSize = compressedData.size() + sizeof(uint32_t);
+                                   auto* buffer = m_memory.Alloc<char>(bufferSize);
+
+                                   reinterpret_cast<uint32_t*>(buffer)[0] = static_cast<uint32_t>(uncompressedSize); // outLen
+                                   std::memcpy(&buffer[sizeof(uint32_t)], compressedData.data(), compressedData.size());
+
+                                   rawFile->len = static_cast<int>(bufferSize);
+                                   rawFile->buffer = buffer;
+                               });
 
             return AssetCreationResult::Success(context.AddAsset<AssetRawFile>(assetName, rawFile));
         }
@@ -28,6 +28,13 @@ public:
      */
     virtual void UnloadContainersOfZone(Zone& zone) const = 0;
 
+    /**
+     * \brief Checks whether a specified zone references any loaded containers.
+     * \param zone The zone to check for referenced containers.
+     * \return \c true if at least one container is loaded for the zone, otherwise \c false
+     */
+    virtual bool HasContainersOfZone(Zone& zone) const = 0;
+
     virtual void ConfigureCreatorCollection(AssetCreatorCollection& collection, Zone& zone, ISearchPath& searchPath, IGdtQueryable& gdt) const = 0;
 
     static const IObjLoader* GetObjLoaderForGame(GameId game);
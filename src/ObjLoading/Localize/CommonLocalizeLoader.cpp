@@ -1,9 +1,29 @@
 #include "CommonLocalizeLoader.h"
 
 #include "Localize/LocalizeCommon.h"
-#include "Localize/Parsing/LocalizeFileReader.h"
+#include "Utils/Parallel.h"
 
 #include <format>
+#include <iostream>
+#include <optional>
+#include <sstream>
+
+namespace
+{
+    // Parsed localize files only depend on their content, so they are shared by all zones built by this process.
+    // The store only keeps a hash of the content of each file, not the content itself.
+    LocalizeStore sharedLocalizeStore;
+
+    class PreparedLocalizeFile
+    {
+    public:
+        std::string m_asset_name;
+        std::string m_file_name;
+        std::string m_content;
+        std::shared_ptr<const LocalizeStore::File> m_file;
+        std::string m_diagnostics;
+    };
+} // namespace
 
 CommonLocalizeLoader::CommonLocalizeLoader(ISearchPath& searchPath, Zone& zone)
     : m_search_path(searchPath),
@@ -16,23 +36,70 @@ std::string CommonLocalizeLoader::GetFileName(const std::string& assetName) cons
     return std::format("{}/localizedstrings/{}.str", LocalizeCommon::GetNameOfLanguage(m_zone.m_language), assetName);
 }
 
+void CommonLocalizeLoader::PrepareLocalizeAssets(const std::vector<std::string>& assetNames)
+{
+    // Search paths are not thread-safe, so read all files before parsing them concurrently
+    std::vector<PreparedLocalizeFile> preparedFiles;
+    for (const auto& assetName : assetNames)
+    {
+        auto fileName = GetFileName(assetName);
+        auto content = m_search_path.ReadFile(fileName);
+        if (content)
+            preparedFiles.emplace_back(assetName, std::move(fileName), std::move(*content), nullptr, std::string());
+    }
+
+    const auto language = m_zone.m_language;
+    utils::ParallelFor(preparedFiles.size(),
+                       [&preparedFiles, language](const size_t index)
+                       {
+                           auto& preparedFile = preparedFiles[index];
+
+                           // Collect parsing errors per file to print them in order afterwards instead of interleaving them
+                           std::ostringstream diagnostics;
+                           preparedFile.m_file = sharedLocalizeStore.GetOrParse(
+                               preparedFile.m_file_name, preparedFile.m_asset_name, language, preparedFile.m_content, diagnostics);
+                           preparedFile.m_diagnostics = std::move(diagnostics).str();
+                       });
+
+    // Failed files are remembered as well to not parse them again
+    for (auto& preparedFile : preparedFiles)
+    {
+        std::cerr << preparedFile.m_diagnostics;
+        m_prepared_files.emplace(std::move(preparedFile.m_asset_name), std::move(preparedFile.m_file));
+    }
+}
+
 AssetCreationResult CommonLocalizeLoader::CreateLocalizeAsset(const std::string& assetName, AssetCreationContext& context)
 {
-    std::string fileName = GetFileName(assetName);
+    std::shared_ptr<const LocalizeStore::File> localizeFile;
 
-    const auto file = m_search_path.Open(fileName);
-    if (!file.IsOpen())
-        return AssetCreationResult::NoAction();
+    const auto preparedFile = m_prepared_files.find(assetName);
+    if (preparedFile != m_prepared_files.end())
+    {
+        localizeFile = std::move(preparedFile->second);
+        m_prepared_files.erase(preparedFile);
+    }
+    else
+    {
+        const auto fileName = GetFileName(assetName);
+        const auto content = m_search_path.ReadFile(fileName);
+        if (!content)
+            return AssetCreationResult::NoAction();
 
-    LocalizeFileReader reader(*file.m_stream, assetName, m_zone.m_language, *this);
+        localizeFile = sharedLocalizeStore.GetOrParse(fileName, assetName, m_zone.m_language, *content, std::cerr);
+    }
 
-    std::vector<CommonLocalizeEntry> localizeEntries;
-    if (!reader.ReadLocalizeFile(localizeEntries))
+    if (!localizeFile)
         return AssetCreationResult::Failure();
 
     auto lastResult = AssetCreationResult::Failure();
-    for (const auto& entry : localizeEntries)
+    const auto entryCount = localizeFile->m_entries.size();
+    for (auto i = 0uz; i < entryCount; i++)
     {
+        const auto& entry = localizeFile->m_entries[i];
+        if (!CheckLocalizeEntryForDuplicates(localizeFile->m_interned_keys[i]))
+            std::cout << std::format("Localize: a value for reference \"{}\" was already defined\n", entry.m_key);
+
         lastResult = CreateAssetFromCommonAsset(entry, context);
         if (!lastResult.HasBeenSuccessful())
             return lastResult;
@@ -41,12 +108,8 @@ AssetCreationResult CommonLocalizeLoader::CreateLocalizeAsset(const std::string&
     return lastResult;
 }
 
-bool CommonLocalizeLoader::CheckLocalizeEntryForDuplicates(const std::string& key)
+bool CommonLocalizeLoader::CheckLocalizeEntryForDuplicates(const std::string* internedKey)
 {
-    const auto existingEntry = m_keys.find(key);
-    if (existingEntry != m_keys.end())
-        return false;
-
-    m_keys.emplace(key);
-    return true;
+    // Keys are interned by the store, so comparing their addresses is enough
+    return m_keys.emplace(internedKey).second;
 }
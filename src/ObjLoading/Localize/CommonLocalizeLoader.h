@@ -2,18 +2,26 @@
 
 #include "Asset/IAssetCreator.h"
 #include "Localize/CommonLocalizeEntry.h"
-#include "Localize/Parsing/ILocalizeFileDuplicationChecker.h"
+#include "Localize/LocalizeStore.h"
 #include "SearchPath/ISearchPath.h"
 #include "Zone/Zone.h"
 
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
-class CommonLocalizeLoader : ILocalizeFileDuplicationChecker
+class CommonLocalizeLoader
 {
 public:
     CommonLocalizeLoader(ISearchPath& searchPath, Zone& zone);
 
+    /**
+     * \brief Parses the localize files of all specified assets in parallel.
+     */
+    void PrepareLocalizeAssets(const std::vector<std::string>& assetNames);
+
     AssetCreationResult CreateLocalizeAsset(const std::string& assetName, AssetCreationContext& context);
 
 protected:
@@ -22,10 +30,11 @@ protected:
 private:
     std::string GetFileName(const std::string& assetName) const;
 
-    bool CheckLocalizeEntryForDuplicates(const std::string& key) override;
+    bool CheckLocalizeEntryForDuplicates(const std::string* internedKey);
 
     ISearchPath& m_search_path;
     Zone& m_zone;
 
-    std::unordered_set<std::string> m_keys;
+    std::unordered_map<std::string, std::shared_ptr<const LocalizeStore::File>> m_prepared_files;
+    std::unordered_set<const std::string*> m_keys;
 };
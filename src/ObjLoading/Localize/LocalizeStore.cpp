@@ -0,0 +1,49 @@
+#include "LocalizeStore.h"
+
+#include "Localize/Parsing/LocalizeFileReader.h"
+
+#include <sstream>
+
+namespace
+{
+    class NoDuplicationChecker final : public ILocalizeFileDuplicationChecker
+    {
+    public:
+        bool CheckLocalizeEntryForDuplicates(const std::string& key) override
+        {
+            return true;
+        }
+    };
+} // namespace
+
+std::shared_ptr<const LocalizeStore::File> LocalizeStore::GetOrParse(
+    const std::string& fileName, const std::string& assetName, const GameLanguage language, const std::string& content, std::ostream& diagnosticStream)
+{
+    return m_files.GetOrParse(fileName,
+                              content,
+                              [this, &assetName, language, &diagnosticStream](const std::string& fileContent) -> std::unique_ptr<const File>
+                              {
+                                  std::istringstream stream(fileContent);
+                                  NoDuplicationChecker duplicationChecker;
+                                  LocalizeFileReader reader(stream, assetName, language, duplicationChecker);
+                                  reader.SetDiagnosticStream(diagnosticStream);
+
+                                  auto file = std::make_unique<File>();
+                                  if (!reader.ReadLocalizeFile(file->m_entries))
+                                      return nullptr;
+
+                                  file->m_interned_keys.reserve(file->m_entries.size());
+                                  for (const auto& entry : file->m_entries)
+                                      file->m_interned_keys.emplace_back(InternKey(entry.m_key));
+
+                                  return file;
+                              });
+}
+
+const std::string* LocalizeStore::InternKey(const std::string& key)
+{
+    std::lock_guard lock(m_keys_mutex);
+
+    // Elements of unordered sets are never moved, so their address stays valid
+    return &*m_keys.emplace(key).first;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Game/GameLanguage.h"
+#include "Localize/CommonLocalizeEntry.h"
+#include "Parsing/ParsedFileCache.h"
+
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * \brief A thread-safe store of parsed localize files that can be shared by all zones of a process.
+ * Every distinct file is only parsed once.
+ * The keys of all files are interned, so equal keys share the same address and can be compared without looking at their content.
+ */
+class LocalizeStore
+{
+public:
+    class File
+    {
+    public:
+        std::vector<CommonLocalizeEntry> m_entries;
+
+        // The interned key of each entry in the same order as the entries
+        std::vector<const std::string*> m_interned_keys;
+    };
+
+    /**
+     * \brief Returns the parsed localize file for the content or parses and stores it.
+     * Duplicate keys are not reported since they depend on the other files loaded by a zone.
+     * \param fileName The name of the file in the search path. It must be unique for each language.
+     * \param diagnosticStream The stream parsing errors are printed to.
+     * \return The parsed file or \c nullptr if parsing failed.
+     */
+    std::shared_ptr<const File> GetOrParse(
+        const std::string& fileName, const std::string& assetName, GameLanguage language, const std::string& content, std::ostream& diagnosticStream);
+
+    const std::string* InternKey(const std::string& key);
+
+private:
+    ParsedFileCache<const File> m_files;
+
+    std::mutex m_keys_mutex;
+    std::unordered_set<std::string> m_keys;
+};
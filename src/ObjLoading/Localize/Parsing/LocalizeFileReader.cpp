@@ -8,7 +8,8 @@ LocalizeFileReader::LocalizeFileReader(std::istream& stream, std::string fileNam
     : m_file_name(std::move(fileName)),
       m_stream(nullptr),
       m_language(language),
-      m_duplication_checker(duplicationChecker)
+      m_duplication_checker(duplicationChecker),
+      m_diagnostic_stream(&std::cerr)
 {
     OpenBaseStream(stream);
     SetupStreamProxies();
@@ -28,6 +29,11 @@ void LocalizeFileReader::SetupStreamProxies()
     m_stream = m_open_streams.back().get();
 }
 
+void LocalizeFileReader::SetDiagnosticStream(std::ostream& diagnosticStream)
+{
+    m_diagnostic_stream = &diagnosticStream;
+}
+
 bool LocalizeFileReader::ReadLocalizeFile(std::vector<CommonLocalizeEntry>& entries)
 {
     SimpleLexer::Config lexerConfig;
@@ -39,6 +45,7 @@ bool LocalizeFileReader::ReadLocalizeFile(std::vector<CommonLocalizeEntry>& entr
     const auto lexer = std::make_unique<SimpleLexer>(m_stream, std::move(lexerConfig));
 
     const auto parser = std::make_unique<LocalizeFileParser>(lexer.get(), m_language, m_duplication_checker);
+    parser->SetErrorStream(*m_diagnostic_stream);
 
     if (parser->Parse())
     {
@@ -46,6 +53,6 @@ bool LocalizeFileReader::ReadLocalizeFile(std::vector<CommonLocalizeEntry>& entr
         return true;
     }
 
-    std::cerr << "Parsing localization file failed!\n";
+    *m_diagnostic_stream << "Parsing localization file failed!\n";
     return false;
 }
@@ -7,6 +7,7 @@
 
 #include <map>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -17,6 +18,7 @@ class LocalizeFileReader
     std::vector<std::unique_ptr<IParserLineStream>> m_open_streams;
     GameLanguage m_language;
     ILocalizeFileDuplicationChecker& m_duplication_checker;
+    std::ostream* m_diagnostic_stream;
 
     bool OpenBaseStream(std::istream& stream);
     void SetupStreamProxies();
@@ -24,5 +26,10 @@ class LocalizeFileReader
 public:
     LocalizeFileReader(std::istream& stream, std::string fileName, GameLanguage language, ILocalizeFileDuplicationChecker& duplicationChecker);
 
+    /**
+     * \brief Sets the stream parsing errors are printed to instead of \c std::cerr.
+     */
+    void SetDiagnosticStream(std::ostream& diagnosticStream);
+
     bool ReadLocalizeFile(std::vector<CommonLocalizeEntry>& entries);
 };
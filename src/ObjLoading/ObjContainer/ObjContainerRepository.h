@@ -84,6 +84,16 @@ public:
         }
     }
 
+    bool HasContainerReferences(ReferencerType* referencer) const
+    {
+        return std::any_of(m_containers.begin(),
+                           m_containers.end(),
+                           [referencer](const ObjContainerEntry& entry)
+                           {
+                               return entry.m_references.find(referencer) != entry.m_references.end();
+                           });
+    }
+
     ContainerType* GetContainerByName(const std::string& name)
     {
         auto foundEntry = std::find_if(m_containers.begin(),
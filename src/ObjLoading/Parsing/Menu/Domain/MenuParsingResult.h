@@ -4,6 +4,7 @@
 #include "CommonMenuDef.h"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace menu
@@ -14,5 +15,9 @@ namespace menu
         std::vector<std::unique_ptr<CommonMenuDef>> m_menus;
         std::vector<std::unique_ptr<CommonFunctionDef>> m_functions;
         std::vector<std::string> m_menus_to_load;
+
+        // Lowercase names of called custom functions that were not known while parsing.
+        // Only filled when unknown functions were deferred.
+        std::vector<std::string> m_deferred_function_names;
     };
 } // namespace menu
@@ -15,7 +15,7 @@ static constexpr int TAG_EXPRESSION_FUNCTION_CALL_END = SimpleExpressionMatchers
 
 static constexpr int CAPTURE_FUNCTION_NAME = SimpleExpressionMatchers::CAPTURE_OFFSET_EXPRESSION_EXT + 1;
 
-MenuExpressionMatchers::MenuExpressionMatchers(const MenuFileParserState* state)
+MenuExpressionMatchers::MenuExpressionMatchers(MenuFileParserState* state)
     : SimpleExpressionMatchers(true, true, true, true, true),
       m_state(state)
 {
@@ -52,35 +52,36 @@ const std::map<std::string, size_t>& MenuExpressionMatchers::GetBaseFunctionMapF
 {
     if (featureLevel == FeatureLevel::IW4)
     {
-        static std::map<std::string, size_t> iw4FunctionMap;
-        static bool iw4FunctionMapInitialized = false;
-
-        if (!iw4FunctionMapInitialized)
+        // Initialized only once in a thread-safe manner since menu files may be parsed concurrently
+        static const auto iw4FunctionMap = []
         {
+            std::map<std::string, size_t> functionMap;
             for (size_t i = IW4::expressionFunction_e::EXP_FUNC_DYN_START; i < std::extent_v<decltype(IW4::g_expFunctionNames)>; i++)
             {
                 std::string functionName(IW4::g_expFunctionNames[i]);
                 utils::MakeStringLowerCase(functionName);
-                iw4FunctionMap.emplace(std::make_pair(functionName, i));
+                functionMap.emplace(std::make_pair(functionName, i));
             }
-        }
+
+            return functionMap;
+        }();
 
         return iw4FunctionMap;
     }
     if (featureLevel == FeatureLevel::IW5)
     {
-        static std::map<std::string, size_t> iw5FunctionMap;
-        static bool iw5FunctionMapInitialized = false;
-
-        if (!iw5FunctionMapInitialized)
+        static const auto iw5FunctionMap = []
         {
+            std::map<std::string, size_t> functionMap;
             for (size_t i = IW5::expressionFunction_e::EXP_FUNC_DYN_START; i < std::extent_v<decltype(IW5::g_expFunctionNames)>; i++)
             {
                 std::string functionName(IW5::g_expFunctionNames[i]);
                 utils::MakeStringLowerCase(functionName);
-                iw5FunctionMap.emplace(std::make_pair(std::move(functionName), i));
+                functionMap.emplace(std::make_pair(std::move(functionName), i));
             }
-        }
+
+            return functionMap;
+        }();
 
         return iw5FunctionMap;
     }
@@ -125,5 +126,14 @@ std::unique_ptr<ISimpleExpression> MenuExpressionMatchers::ProcessOperandExtensi
         return std::move(functionCall);
     }
 
+    if (m_state->m_defer_unknown_functions)
+    {
+        if (result.PeekAndRemoveIfTag(TAG_EXPRESSION_FUNCTION_CALL_END) != TAG_EXPRESSION_FUNCTION_CALL_END)
+            throw ParsingException(functionCallToken.GetPos(), "Custom functions cannot be called with arguments");
+
+        m_state->m_deferred_function_names.emplace(functionCallName);
+        return std::make_unique<CommonExpressionCustomFunctionCall>(std::move(functionCallName));
+    }
+
     throw ParsingException(functionCallToken.GetPos(), "Unknown function");
 }
@@ -9,13 +9,13 @@ namespace menu
 {
     class MenuExpressionMatchers final : public SimpleExpressionMatchers
     {
-        const MenuFileParserState* m_state;
+        MenuFileParserState* m_state;
 
         static const std::map<std::string, size_t>& GetBaseFunctionMapForFeatureLevel(FeatureLevel featureLevel);
 
     public:
         MenuExpressionMatchers();
-        explicit MenuExpressionMatchers(const MenuFileParserState* state);
+        explicit MenuExpressionMatchers(MenuFileParserState* state);
 
     protected:
         std::unique_ptr<matcher_t> ParseOperandExtension(const supplier_t* labelSupplier) const override;
@@ -19,6 +19,7 @@ MenuFileParserState::EventHandlerConditionState::EventHandlerConditionState(Comm
 MenuFileParserState::MenuFileParserState(const FeatureLevel featureLevel, const bool permissiveMode)
     : m_feature_level(featureLevel),
       m_permissive_mode(permissiveMode),
+      m_defer_unknown_functions(false),
       m_in_global_scope(false),
       m_current_function(nullptr),
       m_current_menu(nullptr),
@@ -9,6 +9,7 @@
 
 #include <map>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <stack>
 #include <vector>
@@ -41,6 +42,11 @@ namespace menu
 
         std::map<std::string, CommonMenuDef*> m_menus_by_name;
 
+        // When set, calls to unknown custom functions are accepted and their lowercase names are remembered
+        // so they can be validated once all functions the file may depend on are known
+        bool m_defer_unknown_functions;
+        std::set<std::string> m_deferred_function_names;
+
         bool m_in_global_scope;
         CommonFunctionDef* m_current_function;
         CommonMenuDef* m_current_menu;
@@ -17,7 +17,9 @@ MenuFileReader::MenuFileReader(std::istream& stream, std::string fileName, const
       m_file_name(std::move(fileName)),
       m_stream(nullptr),
       m_zone_state(nullptr),
-      m_permissive_mode(false)
+      m_permissive_mode(false),
+      m_defer_unknown_functions(false),
+      m_diagnostic_stream(&std::cerr)
 {
     OpenBaseStream(stream);
     SetupStreamProxies();
@@ -65,25 +67,25 @@ bool MenuFileReader::IsValidEndState(const MenuFileParserState* state) const
 {
     if (state->m_current_item)
     {
-        std::cerr << "In \"" << m_file_name << "\": Unclosed item at end of file!\n";
+        *m_diagnostic_stream << "In \"" << m_file_name << "\": Unclosed item at end of file!\n";
         return false;
     }
 
     if (state->m_current_menu)
     {
-        std::cerr << "In \"" << m_file_name << "\": Unclosed menu at end of file!\n";
+        *m_diagnostic_stream << "In \"" << m_file_name << "\": Unclosed menu at end of file!\n";
         return false;
     }
 
     if (state->m_current_function)
     {
-        std::cerr << "In \"" << m_file_name << "\": Unclosed function at end of file!\n";
+        *m_diagnostic_stream << "In \"" << m_file_name << "\": Unclosed function at end of file!\n";
         return false;
     }
 
     if (state->m_in_global_scope)
     {
-        std::cerr << "In \"" << m_file_name << "\": Did not close global scope!\n";
+        *m_diagnostic_stream << "In \"" << m_file_name << "\": Did not close global scope!\n";
         return false;
     }
 
@@ -96,6 +98,7 @@ std::unique_ptr<ParsingResult> MenuFileReader::CreateParsingResult(MenuFileParse
     result->m_menus = std::move(state->m_menus);
     result->m_functions = std::move(state->m_functions);
     result->m_menus_to_load = std::move(state->m_menus_to_load);
+    result->m_deferred_function_names.assign(state->m_deferred_function_names.begin(), state->m_deferred_function_names.end());
 
     return result;
 }
@@ -110,6 +113,16 @@ void MenuFileReader::SetPermissiveMode(const bool usePermissiveMode)
     m_permissive_mode = usePermissiveMode;
 }
 
+void MenuFileReader::SetDeferUnknownFunctions(const bool deferUnknownFunctions)
+{
+    m_defer_unknown_functions = deferUnknownFunctions;
+}
+
+void MenuFileReader::SetDiagnosticStream(std::ostream& diagnosticStream)
+{
+    m_diagnostic_stream = &diagnosticStream;
+}
+
 std::unique_ptr<ParsingResult> MenuFileReader::ReadMenuFile()
 {
     SimpleLexer::Config lexerConfig;
@@ -122,14 +135,16 @@ std::unique_ptr<ParsingResult> MenuFileReader::ReadMenuFile()
 
     const auto lexer = std::make_unique<SimpleLexer>(m_stream, std::move(lexerConfig));
     const auto parser = std::make_unique<MenuFileParser>(lexer.get(), m_feature_level, m_permissive_mode, m_zone_state);
+    parser->GetState()->m_defer_unknown_functions = m_defer_unknown_functions;
+    parser->SetErrorStream(*m_diagnostic_stream);
 
     if (!parser->Parse())
     {
-        std::cerr << "Parsing menu file failed!\n";
+        *m_diagnostic_stream << "Parsing menu file failed!\n";
 
         const auto* parserEndState = parser->GetState();
         if (parserEndState->m_current_event_handler_set && !parserEndState->m_permissive_mode)
-            std::cerr << "You can use the --menu-permissive option to try to compile the event handler script anyway.\n";
+            *m_diagnostic_stream << "You can use the --menu-permissive option to try to compile the event handler script anyway.\n";
         return nullptr;
     }
 
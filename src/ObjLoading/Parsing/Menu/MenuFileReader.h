@@ -9,6 +9,7 @@
 #include "SearchPath/SearchPathMultiInputStream.h"
 
 #include <memory>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -22,6 +23,17 @@ namespace menu
         void IncludeZoneState(const MenuAssetZoneState& zoneState);
         void SetPermissiveMode(bool usePermissiveMode);
 
+        /**
+         * \brief Accepts calls to custom functions that are unknown while parsing instead of failing.
+         * The names of these functions are part of the parsing result and must be validated by the caller.
+         */
+        void SetDeferUnknownFunctions(bool deferUnknownFunctions);
+
+        /**
+         * \brief Sets the stream parsing errors are printed to instead of \c std::cerr.
+         */
+        void SetDiagnosticStream(std::ostream& diagnosticStream);
+
         std::unique_ptr<ParsingResult> ReadMenuFile();
 
     private:
@@ -40,5 +52,7 @@ namespace menu
 
         const MenuAssetZoneState* m_zone_state;
         bool m_permissive_mode;
+        bool m_defer_unknown_functions;
+        std::ostream* m_diagnostic_stream;
     };
 } // namespace menu
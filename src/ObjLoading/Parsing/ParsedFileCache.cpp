@@ -0,0 +1,15 @@
+#include "ParsedFileCache.h"
+
+#include "Algorithms/AlgorithmSha256.h"
+
+std::string HashParsedFileContent(const std::string& content)
+{
+    const auto sha256 = cryptography::CreateSha256();
+
+    std::string hash(sha256->GetHashSize(), '\0');
+    sha256->Init();
+    sha256->Process(content.data(), content.size());
+    sha256->Finish(hash.data());
+
+    return hash;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief Hashes the content of a parsed file with a cryptographic hash, so equal hashes can be treated as equal content.
+ */
+std::string HashParsedFileContent(const std::string& content);
+
+/**
+ * \brief A thread-safe cache for the results of parsing files that can be shared by all zones of a process.
+ * Results are keyed by the name and the content of the parsed file,
+ * so zones reading different files with the same name from different search paths never share a result.
+ * Only a hash of the content is kept, so the cache does not hold on to the content of every file it has seen.
+ * Parsed results must not be modified after they were added to the cache.
+ */
+template<typename T> class ParsedFileCache
+{
+public:
+    using parse_func_t = std::function<std::unique_ptr<T>(const std::string& content)>;
+
+    /**
+     * \brief Returns the cached result for the file content or parses and caches it.
+     * Parse failures are not cached.
+     * \return The parsed result or \c nullptr if parsing failed.
+     */
+    std::shared_ptr<T> GetOrParse(const std::string& fileName, const std::string& content, const parse_func_t& parse)
+    {
+        const auto contentHash = HashParsedFileContent(content);
+
+        {
+            std::lock_guard lock(m_mutex);
+            if (auto cachedValue = Find(fileName, contentHash))
+                return cachedValue;
+        }
+
+        // Parse without holding the lock so different files can be parsed concurrently
+        std::shared_ptr<T> parsedValue = parse(content);
+        if (!parsedValue)
+            return nullptr;
+
+        std::lock_guard lock(m_mutex);
+
+        // Another thread may have parsed the same file in the meantime, prefer its result so everyone shares the same instance
+        if (auto cachedValue = Find(fileName, contentHash))
+            return cachedValue;
+
+        m_entries[fileName].emplace_back(contentHash, parsedValue);
+        return parsedValue;
+    }
+
+private:
+    class Entry
+    {
+    public:
+        std::string m_content_hash;
+        std::shared_ptr<T> m_value;
+
+        Entry(std::string contentHash, std::shared_ptr<T> value)
+            : m_content_hash(std::move(contentHash)),
+              m_value(std::move(value))
+        {
+        }
+    };
+
+    std::shared_ptr<T> Find(const std::string& fileName, const std::string& contentHash) const
+    {
+        const auto foundFile = m_entries.find(fileName);
+        if (foundFile == m_entries.end())
+            return nullptr;
+
+        for (const auto& entry : foundFile->second)
+        {
+            if (entry.m_content_hash == contentHash)
+                return entry.m_value;
+        }
+
+        return nullptr;
+    }
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::vector<Entry>> m_entries;
+};
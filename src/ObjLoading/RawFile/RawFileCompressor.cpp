@@ -0,0 +1,290 @@
+#include "RawFileCompressor.h"
+
+#include "Algorithms/AlgorithmSha256.h"
+#include "Utils/FileUtils.h"
+#include "Utils/Parallel.h"
+#include "Utils/Tracing.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <zlib.h>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr auto COMPRESSION_LEVEL = Z_DEFAULT_COMPRESSION;
+    constexpr auto MEMORY_LEVEL = 8;
+    constexpr auto CACHE_FOLDER_NAME = "rawfile";
+    constexpr auto CACHE_FILE_EXTENSION = ".zlib";
+    constexpr uint32_t CACHE_FILE_MAGIC = FileUtils::MakeMagic32('R', 'F', 'C', 'C');
+    constexpr uint32_t CACHE_FILE_VERSION = 1u;
+
+    class CacheFileHeader
+    {
+    public:
+        uint32_t m_magic;
+        uint32_t m_version;
+        uint64_t m_compressed_size;
+        uint64_t m_checksum;
+    };
+
+    class CacheFileInfo
+    {
+    public:
+        fs::path m_path;
+        uintmax_t m_size;
+        fs::file_time_type m_last_write_time;
+    };
+
+    uint64_t ChecksumData(const std::vector<char>& data)
+    {
+        return crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<const Bytef*>(data.data()), static_cast<uInt>(data.size()));
+    }
+
+    std::string HashData(const std::string& data)
+    {
+        const auto sha256 = cryptography::CreateSha256();
+        const auto hashSize = sha256->GetHashSize();
+        std::vector<uint8_t> hash(hashSize);
+
+        sha256->Init();
+        sha256->Process(data.data(), data.size());
+        sha256->Finish(hash.data());
+
+        std::string hashString;
+        hashString.reserve(hashSize * 2u);
+        for (const auto hashByte : hash)
+            hashString += std::format("{:02x}", hashByte);
+
+        return hashString;
+    }
+} // namespace
+
+RawFileCompressor::QueuedCompression::QueuedCompression(std::string assetName, std::string data, const int windowBits, compressed_callback_t onCompressed)
+    : m_asset_name(std::move(assetName)),
+      m_data(std::move(data)),
+      m_window_bits(windowBits),
+      m_on_compressed(std::move(onCompressed)),
+      m_success(false)
+{
+}
+
+RawFileCompressor::RawFileCompressor()
+    : m_cache_size_limit(DEFAULT_CACHE_SIZE_LIMIT)
+{
+}
+
+void RawFileCompressor::SetCacheDirectory(fs::path cacheDirectory)
+{
+    if (cacheDirectory.empty())
+        m_cache_directory = std::nullopt;
+    else
+        m_cache_directory = std::move(cacheDirectory) / CACHE_FOLDER_NAME;
+}
+
+void RawFileCompressor::SetCacheSizeLimit(const size_t cacheSizeLimit)
+{
+    m_cache_size_limit = cacheSizeLimit;
+}
+
+void RawFileCompressor::Enqueue(std::string assetName, std::string data, const int windowBits, compressed_callback_t onCompressed)
+{
+    m_queue.emplace_back(std::move(assetName), std::move(data), windowBits, std::move(onCompressed));
+}
+
+bool RawFileCompressor::CompressQueued()
+{
+    if (m_queue.empty())
+        return true;
+
+    const utils::TraceScope trace("rawfile", "CompressQueued");
+
+    if (m_cache_directory)
+    {
+        std::error_code ec;
+        fs::create_directories(*m_cache_directory, ec);
+        if (ec)
+        {
+            std::cerr << std::format("Could not create rawfile cache directory \"{}\": {}\n", m_cache_directory->string(), ec.message());
+            m_cache_directory = std::nullopt;
+        }
+    }
+
+    utils::ParallelFor(m_queue.size(),
+                       [this](const size_t index)
+                       {
+                           Compress(m_queue[index]);
+                       });
+
+    if (m_cache_directory)
+        TrimCache();
+
+    // Take the queue before calling any callbacks so the compressor is in a clean state even if compressing failed
+    auto queue = std::move(m_queue);
+    m_queue = std::vector<QueuedCompression>();
+
+    auto success = true;
+    for (const auto& compression : queue)
+    {
+        if (!compression.m_success)
+        {
+            std::cerr << std::format("Deflate failed for loading rawfile \"{}\"\n", compression.m_asset_name);
+            success = false;
+        }
+    }
+
+    if (!success)
+        return false;
+
+    for (auto& compression : queue)
+        compression.m_on_compressed(compression.m_compressed_data);
+
+    return true;
+}
+
+fs::path RawFileCompressor::GetCacheFilePath(const QueuedCompression& compression) const
+{
+    return *m_cache_directory / std::format("{}_{}_{}{}", HashData(compression.m_data), COMPRESSION_LEVEL, compression.m_window_bits, CACHE_FILE_EXTENSION);
+}
+
+std::optional<std::vector<char>> RawFileCompressor::ReadFromCache(const fs::path& cacheFilePath) const
+{
+    std::ifstream stream(cacheFilePath, std::ios::in | std::ios::binary);
+    if (!stream.is_open())
+        return std::nullopt;
+
+    CacheFileHeader header{};
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (stream.gcount() != sizeof(header) || header.m_magic != CACHE_FILE_MAGIC || header.m_version != CACHE_FILE_VERSION)
+        return std::nullopt;
+
+    // Compare against the file size to not trust files that were only partially written
+    std::error_code ec;
+    const auto fileSize = fs::file_size(cacheFilePath, ec);
+    if (ec || fileSize != sizeof(header) + header.m_compressed_size)
+        return std::nullopt;
+
+    std::vector<char> compressedData(static_cast<size_t>(header.m_compressed_size));
+    stream.read(compressedData.data(), static_cast<std::streamsize>(compressedData.size()));
+    if (stream.gcount() != static_cast<std::streamsize>(compressedData.size()) || ChecksumData(compressedData) != header.m_checksum)
+        return std::nullopt;
+
+    // Mark the file as recently used so it is not removed when trimming the cache
+    fs::last_write_time(cacheFilePath, fs::file_time_type::clock::now(), ec);
+
+    return compressedData;
+}
+
+void RawFileCompressor::WriteToCache(const fs::path& cacheFilePath, const std::vector<char>& compressedData) const
+{
+    // Write to a temporary file first so other builds never read a partially written cache file
+    const auto temporaryPath = FileUtils::MakeTemporaryFilePath(cacheFilePath);
+
+    {
+        std::ofstream stream(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!stream.is_open())
+            return;
+
+        const CacheFileHeader header{
+            .m_magic = CACHE_FILE_MAGIC,
+            .m_version = CACHE_FILE_VERSION,
+            .m_compressed_size = compressedData.size(),
+            .m_checksum = ChecksumData(compressedData),
+        };
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(compressedData.data(), static_cast<std::streamsize>(compressedData.size()));
+    }
+
+    std::error_code ec;
+    fs::rename(temporaryPath, cacheFilePath, ec);
+    if (ec)
+        fs::remove(temporaryPath, ec);
+}
+
+void RawFileCompressor::TrimCache() const
+{
+    std::vector<CacheFileInfo> cacheFiles;
+    uintmax_t cacheSize = 0u;
+
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(*m_cache_directory, ec))
+    {
+        if (!entry.is_regular_file(ec) || entry.path().extension() != CACHE_FILE_EXTENSION)
+            continue;
+
+        const auto fileSize = entry.file_size(ec);
+        if (ec)
+            continue;
+
+        const auto lastWriteTime = entry.last_write_time(ec);
+        if (ec)
+            continue;
+
+        cacheFiles.emplace_back(entry.path(), fileSize, lastWriteTime);
+        cacheSize += fileSize;
+    }
+
+    if (cacheSize <= m_cache_size_limit)
+        return;
+
+    std::ranges::sort(cacheFiles,
+                      [](const CacheFileInfo& file0, const CacheFileInfo& file1)
+                      {
+                          return file0.m_last_write_time < file1.m_last_write_time;
+                      });
+
+    // Other builds may remove the same files at the same time, so failing to remove a file is not an error
+    for (const auto& cacheFile : cacheFiles)
+    {
+        if (cacheSize <= m_cache_size_limit)
+            break;
+
+        fs::remove(cacheFile.m_path, ec);
+        cacheSize -= cacheFile.m_size;
+    }
+}
+
+void RawFileCompressor::Compress(QueuedCompression& compression) const
+{
+    std::optional<fs::path> cacheFilePath;
+    if (m_cache_directory)
+    {
+        cacheFilePath = GetCacheFilePath(compression);
+        if (auto cachedData = ReadFromCache(*cacheFilePath))
+        {
+            compression.m_compressed_data = std::move(*cachedData);
+            compression.m_success = true;
+            return;
+        }
+    }
+
+    z_stream_s zs{};
+    zs.zalloc = Z_NULL;
+    zs.zfree = Z_NULL;
+    zs.opaque = Z_NULL;
+
+    if (deflateInit2(&zs, COMPRESSION_LEVEL, Z_DEFLATED, compression.m_window_bits, MEMORY_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK)
+        return;
+
+    compression.m_compressed_data.resize(deflateBound(&zs, static_cast<uLong>(compression.m_data.size())));
+    zs.avail_in = static_cast<uInt>(compression.m_data.size());
+    zs.avail_out = static_cast<uInt>(compression.m_compressed_data.size());
+    zs.next_in = reinterpret_cast<const Bytef*>(compression.m_data.data());
+    zs.next_out = reinterpret_cast<Bytef*>(compression.m_compressed_data.data());
+
+    const auto ret = deflate(&zs, Z_FINISH);
+    deflateEnd(&zs);
+
+    if (ret != Z_STREAM_END)
+        return;
+
+    compression.m_compressed_data.resize(compression.m_compressed_data.size() - zs.avail_out);
+    compression.m_success = true;
+
+    if (cacheFilePath)
+        WriteToCache(*cacheFilePath, compression.m_compressed_data);
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Asset/IZoneAssetCreationState.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Deflates the data of rawfiles of a zone in parallel once all assets have been created.
+ * When a cache directory is set, compressed data is persisted in it keyed by the hash of the uncompressed data and the compression parameters,
+ * so rawfiles that did not change since the last build are not compressed again.
+ * Cache files are validated with a checksum and the least recently used files are removed once the cache exceeds its size limit.
+ */
+class RawFileCompressor final : public IZoneAssetCreationState
+{
+public:
+    using compressed_callback_t = std::function<void(std::span<const char> compressedData)>;
+
+    static constexpr auto DEFAULT_CACHE_SIZE_LIMIT = 256uz * 1024uz * 1024uz;
+
+    RawFileCompressor();
+
+    void SetCacheDirectory(std::filesystem::path cacheDirectory);
+
+    /**
+     * \brief Sets the amount of bytes the cache files may use in total before the least recently used files are removed.
+     */
+    void SetCacheSizeLimit(size_t cacheSizeLimit);
+
+    /**
+     * \brief Queues data to be compressed when calling \c CompressQueued.
+     * \param assetName The name of the asset the data belongs to, used for error messages.
+     * \param data The uncompressed data.
+     * \param windowBits The window bits to initialize deflate with. Positive values produce a zlib stream, negative values a raw deflate stream.
+     * \param onCompressed Called with the compressed data on the thread calling \c CompressQueued.
+     */
+    void Enqueue(std::string assetName, std::string data, int windowBits, compressed_callback_t onCompressed);
+
+    /**
+     * \brief Compresses all queued data in parallel and calls the callbacks in the order the data was queued.
+     * Callbacks are only called when all data could be compressed.
+     * \return \c true if all data was compressed, \c false if compressing any data failed.
+     */
+    [[nodiscard]] bool CompressQueued();
+
+private:
+    class QueuedCompression
+    {
+    public:
+        std::string m_asset_name;
+        std::string m_data;
+        int m_window_bits;
+        compressed_callback_t m_on_compressed;
+        std::vector<char> m_compressed_data;
+        bool m_success;
+
+        QueuedCompression(std::string assetName, std::string data, int windowBits, compressed_callback_t onCompressed);
+    };
+
+    [[nodiscard]] std::filesystem::path GetCacheFilePath(const QueuedCompression& compression) const;
+    [[nodiscard]] std::optional<std::vector<char>> ReadFromCache(const std::filesystem::path& cacheFilePath) const;
+    void WriteToCache(const std::filesystem::path& cacheFilePath, const std::vector<char>& compressedData) const;
+    void TrimCache() const;
+    void Compress(QueuedCompression& compression) const;
+
+    std::optional<std::filesystem::path> m_cache_directory;
+    size_t m_cache_size_limit;
+    std::vector<QueuedCompression> m_queue;
+};
@@ -12,7 +12,7 @@ const state_map::StateMapDefinition* TechniqueStateMapCache::GetCachedStateMap(c
     return nullptr;
 }
 
-void TechniqueStateMapCache::AddStateMapToCache(std::unique_ptr<state_map::StateMapDefinition> stateMap)
+void TechniqueStateMapCache::AddStateMapToCache(std::shared_ptr<const state_map::StateMapDefinition> stateMap)
 {
     m_state_map_cache.emplace(std::make_pair(stateMap->m_name, std::move(stateMap)));
 }
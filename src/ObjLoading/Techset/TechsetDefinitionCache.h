@@ -13,10 +13,10 @@ namespace techset
     class TechsetDefinitionCache final : public IZoneAssetCreationState
     {
     public:
-        _NODISCARD TechsetDefinition* GetCachedTechsetDefinition(const std::string& techsetName) const;
-        void AddTechsetDefinitionToCache(std::string name, std::unique_ptr<TechsetDefinition> definition);
+        _NODISCARD const TechsetDefinition* GetCachedTechsetDefinition(const std::string& techsetName) const;
+        void AddTechsetDefinitionToCache(std::string name, std::shared_ptr<const TechsetDefinition> definition);
 
     private:
-        std::unordered_map<std::string, std::unique_ptr<TechsetDefinition>> m_cache;
+        std::unordered_map<std::string, std::shared_ptr<const TechsetDefinition>> m_cache;
     };
 } // namespace techset
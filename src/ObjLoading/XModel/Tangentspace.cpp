@@ -1,13 +1,20 @@
 #include "Tangentspace.h"
 
+#include "Utils/Parallel.h"
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <numbers>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TANGENT_SPACE_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace tangent_space
 {
-    constexpr float NULL_VEC3[3]{0, 0, 0};
-
     typedef float tvec2[2];
     typedef float tvec3[3];
 
@@ -21,11 +28,6 @@ namespace tangent_space
         return *reinterpret_cast<const tvec3*>(static_cast<const char*>(dest) + stride * index);
     }
 
-    tvec3& GetVec3(void* dest, const size_t index, const size_t stride)
-    {
-        return *reinterpret_cast<tvec3*>(static_cast<char*>(dest) + stride * index);
-    }
-
     void SetVec3(void* dest, const size_t index, const size_t stride, const tvec3& data)
     {
         auto* out = reinterpret_cast<float(*)[3]>(static_cast<char*>(dest) + stride * index);
@@ -60,9 +62,8 @@ namespace tangent_space
         cross[2] = v0[0] * v1[1] - v1[0] * v0[1];
     }
 
-    float AngleBetweenOriginVectors(const tvec3& a1, const tvec3& a2)
+    float AngleFromCosine(const float v4)
     {
-        const auto v4 = a1[0] * a2[0] + a1[1] * a2[1] + a1[2] * a2[2];
         if (v4 <= -1.0)
             return -std::numbers::pi_v<float>;
         if (v4 >= 1.0)
@@ -71,6 +72,12 @@ namespace tangent_space
         return acos(v4);
     }
 
+    float AngleBetweenOriginVectors(const tvec3& a1, const tvec3& a2)
+    {
+        const auto v4 = a1[0] * a2[0] + a1[1] * a2[1] + a1[2] * a2[2];
+        return AngleFromCosine(v4);
+    }
+
     void sub_10022E80(const VertexData& vertexData, const uint16_t i0, const uint16_t i1, const uint16_t i2, tvec3& outVector, tvec3& outCross)
     {
         const auto& i0_uv = GetVec2(vertexData.uvData, i0, vertexData.uvDataStride);
@@ -141,14 +148,6 @@ namespace tangent_space
         outExteriorAngles[2] = AngleBetweenOriginVectors(L02, L21);
     }
 
-    void sub_10022CA0(const uint16_t index, void* sourcesDest, const tvec3& ecx0, const float exteriorAngle, const size_t stride)
-    {
-        auto& vec = GetVec3(sourcesDest, index, stride);
-        vec[0] = ecx0[0] * exteriorAngle + vec[0];
-        vec[1] = ecx0[1] * exteriorAngle + vec[1];
-        vec[2] = ecx0[2] * exteriorAngle + vec[2];
-    }
-
     void sub_10014EE0(const tvec3& src, tvec3& a2)
     {
         assert(Vec3_IsNormalized(src));
@@ -167,65 +166,309 @@ namespace tangent_space
         Vec3_Normalize(a2);
     }
 
-    void CalculateTangentSpace(const VertexData& vertexData, const size_t triCount, const size_t vertexCount)
+    /**
+     * \brief The tangent and binormal direction of every triangle and its exterior angle at each of its corners,
+     * stored as structure of arrays so multiple triangles can be processed at once.
+     */
+    class TriangleTangents
+    {
+    public:
+        std::vector<float> m_tangent_x;
+        std::vector<float> m_tangent_y;
+        std::vector<float> m_tangent_z;
+        std::vector<float> m_binormal_x;
+        std::vector<float> m_binormal_y;
+        std::vector<float> m_binormal_z;
+
+        // Three angles per triangle in the order of its corners
+        std::vector<float> m_exterior_angles;
+
+        explicit TriangleTangents(const size_t triCount)
+            : m_tangent_x(triCount),
+              m_tangent_y(triCount),
+              m_tangent_z(triCount),
+              m_binormal_x(triCount),
+              m_binormal_y(triCount),
+              m_binormal_z(triCount),
+              m_exterior_angles(triCount * 3u)
+        {
+        }
+    };
+
+    // Amount of triangles or vertices that are processed by a single parallel task
+    constexpr auto ELEMENTS_PER_TASK = 4096uz;
+
+    void CalculateTriangleTangents(const VertexData& vertexData, const size_t triIndex, TriangleTangents& triangleTangents)
+    {
+        const auto i0 = vertexData.triData[triIndex * 3u + 0u];
+        const auto i1 = vertexData.triData[triIndex * 3u + 1u];
+        const auto i2 = vertexData.triData[triIndex * 3u + 2u];
+
+        tvec3 vector, cross, exteriorAngles;
+        sub_10022E80(vertexData, i0, i1, i2, vector, cross);
+        GetExteriorAnglesOfTri(vertexData, exteriorAngles, i0, i1, i2);
+
+        triangleTangents.m_tangent_x[triIndex] = vector[0];
+        triangleTangents.m_tangent_y[triIndex] = vector[1];
+        triangleTangents.m_tangent_z[triIndex] = vector[2];
+        triangleTangents.m_binormal_x[triIndex] = cross[0];
+        triangleTangents.m_binormal_y[triIndex] = cross[1];
+        triangleTangents.m_binormal_z[triIndex] = cross[2];
+        triangleTangents.m_exterior_angles[triIndex * 3u + 0u] = exteriorAngles[0];
+        triangleTangents.m_exterior_angles[triIndex * 3u + 1u] = exteriorAngles[1];
+        triangleTangents.m_exterior_angles[triIndex * 3u + 2u] = exteriorAngles[2];
+    }
+
+#ifdef TANGENT_SPACE_SSE2
+    constexpr auto SSE2_TRIANGLE_COUNT = 4uz;
+
+    class Vec3x4
+    {
+    public:
+        __m128 x;
+        __m128 y;
+        __m128 z;
+    };
+
+    // Same operations in the same order as Vec3_Normalize, for 4 vectors at once
+    void Vec3x4_Normalize(Vec3x4& vector)
+    {
+        auto length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vector.x, vector.x), _mm_mul_ps(vector.y, vector.y)), _mm_mul_ps(vector.z, vector.z)));
+        const auto negatedLength = _mm_xor_ps(length, _mm_set1_ps(-0.0f));
+        const auto useOne = _mm_cmpge_ps(negatedLength, _mm_setzero_ps());
+        length = _mm_or_ps(_mm_and_ps(useOne, _mm_set1_ps(1.0f)), _mm_andnot_ps(useOne, length));
+
+        const auto lengthInv = _mm_div_ps(_mm_set1_ps(1.0f), length);
+        vector.x = _mm_mul_ps(lengthInv, vector.x);
+        vector.y = _mm_mul_ps(lengthInv, vector.y);
+        vector.z = _mm_mul_ps(lengthInv, vector.z);
+    }
+
+    __m128 Vec3x4_Dot(const Vec3x4& a1, const Vec3x4& a2)
+    {
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a1.x, a2.x), _mm_mul_ps(a1.y, a2.y)), _mm_mul_ps(a1.z, a2.z));
+    }
+
+    Vec3x4 Vec3x4_Sub(const Vec3x4& a, const Vec3x4& b)
+    {
+        return Vec3x4{_mm_sub_ps(a.x, b.x), _mm_sub_ps(a.y, b.y), _mm_sub_ps(a.z, b.z)};
+    }
+
+    __m128 Select(const __m128 mask, const __m128 ifTrue, const __m128 ifFalse)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+    }
+
+    /**
+     * \brief Calculates the same results as \c CalculateTriangleTangents for 4 consecutive triangles at once.
+     * Only the angles themselves are calculated per triangle.
+     */
+    void CalculateTriangleTangentsSse2(const VertexData& vertexData, const size_t firstTriIndex, TriangleTangents& triangleTangents)
     {
-        // Set tangents and binormals to 0
-        for (auto vertexIndex = 0u; vertexIndex < vertexCount; vertexIndex++)
+        float uv[3][2][SSE2_TRIANGLE_COUNT];
+        float position[3][3][SSE2_TRIANGLE_COUNT];
+        for (auto triOffset = 0uz; triOffset < SSE2_TRIANGLE_COUNT; triOffset++)
         {
-            SetVec3(vertexData.tangentData, vertexIndex, vertexData.tangentDataStride, NULL_VEC3);
-            SetVec3(vertexData.binormalData, vertexIndex, vertexData.binormalDataStride, NULL_VEC3);
+            for (auto corner = 0uz; corner < 3uz; corner++)
+            {
+                const auto vertexIndex = vertexData.triData[(firstTriIndex + triOffset) * 3u + corner];
+                const auto& vertexUv = GetVec2(vertexData.uvData, vertexIndex, vertexData.uvDataStride);
+                const auto& vertexPosition = GetVec3(vertexData.positionData, vertexIndex, vertexData.positionDataStride);
+
+                uv[corner][0][triOffset] = vertexUv[0];
+                uv[corner][1][triOffset] = vertexUv[1];
+                position[corner][0][triOffset] = vertexPosition[0];
+                position[corner][1][triOffset] = vertexPosition[1];
+                position[corner][2][triOffset] = vertexPosition[2];
+            }
         }
 
-        for (auto triIndex = 0u; triIndex < triCount; triIndex++)
+        const Vec3x4 p0{_mm_loadu_ps(position[0][0]), _mm_loadu_ps(position[0][1]), _mm_loadu_ps(position[0][2])};
+        const Vec3x4 p1{_mm_loadu_ps(position[1][0]), _mm_loadu_ps(position[1][1]), _mm_loadu_ps(position[1][2])};
+        const Vec3x4 p2{_mm_loadu_ps(position[2][0]), _mm_loadu_ps(position[2][1]), _mm_loadu_ps(position[2][2])};
+
+        // See sub_10022E80
+        const auto uv0_1m0 = _mm_sub_ps(_mm_loadu_ps(uv[1][0]), _mm_loadu_ps(uv[0][0]));
+        const auto uv0_2m0 = _mm_sub_ps(_mm_loadu_ps(uv[2][0]), _mm_loadu_ps(uv[0][0]));
+        const auto uv1_1m0 = _mm_sub_ps(_mm_loadu_ps(uv[1][1]), _mm_loadu_ps(uv[0][1]));
+        const auto uv1_2m0 = _mm_sub_ps(_mm_loadu_ps(uv[2][1]), _mm_loadu_ps(uv[0][1]));
+
+        const auto p_1m0 = Vec3x4_Sub(p1, p0);
+        const auto p_2m0 = Vec3x4_Sub(p2, p0);
+
+        const auto isPositive = _mm_cmpge_ps(_mm_mul_ps(uv1_2m0, uv0_1m0), _mm_mul_ps(uv1_1m0, uv0_2m0));
+
+        Vec3x4 vector{
+            Select(isPositive,
+                   _mm_sub_ps(_mm_mul_ps(p_1m0.x, uv1_2m0), _mm_mul_ps(p_2m0.x, uv1_1m0)),
+                   _mm_sub_ps(_mm_mul_ps(p_2m0.x, uv1_1m0), _mm_mul_ps(p_1m0.x, uv1_2m0))),
+            Select(isPositive,
+                   _mm_sub_ps(_mm_mul_ps(p_1m0.y, uv1_2m0), _mm_mul_ps(p_2m0.y, uv1_1m0)),
+                   _mm_sub_ps(_mm_mul_ps(p_2m0.y, uv1_1m0), _mm_mul_ps(p_1m0.y, uv1_2m0))),
+            Select(isPositive,
+                   _mm_sub_ps(_mm_mul_ps(uv1_2m0, p_1m0.z), _mm_mul_ps(uv1_1m0, p_2m0.z)),
+                   _mm_sub_ps(_mm_mul_ps(uv1_1m0, p_2m0.z), _mm_mul_ps(uv1_2m0, p_1m0.z))),
+        };
+        Vec3x4 cross{
+            Select(isPositive,
+                   _mm_sub_ps(_mm_mul_ps(p_2m0.x, uv0_1m0), _mm_mul_ps(p_1m0.x, uv0_2m0)),
+                   _mm_sub_ps(_mm_mul_ps(p_1m0.x, uv0_2m0), _mm_mul_ps(p_2m0.x, uv0_1m0))),
+            Select(isPositive,
+                   _mm_sub_ps(_mm_mul_ps(p_2m0.y, uv0_1m0), _mm_mul_ps(p_1m0.y, uv0_2m0)),
+                   _mm_sub_ps(_mm_mul_ps(p_1m0.y, uv0_2m0), _mm_mul_ps(p_2m0.y, uv0_1m0))),
+            Select(isPositive,
+                   _mm_sub_ps(_mm_mul_ps(uv0_1m0, p_2m0.z), _mm_mul_ps(uv0_2m0, p_1m0.z)),
+                   _mm_sub_ps(_mm_mul_ps(uv0_2m0, p_1m0.z), _mm_mul_ps(p_2m0.z, uv0_1m0))),
+        };
+        Vec3x4_Normalize(vector);
+        Vec3x4_Normalize(cross);
+
+        _mm_storeu_ps(&triangleTangents.m_tangent_x[firstTriIndex], vector.x);
+        _mm_storeu_ps(&triangleTangents.m_tangent_y[firstTriIndex], vector.y);
+        _mm_storeu_ps(&triangleTangents.m_tangent_z[firstTriIndex], vector.z);
+        _mm_storeu_ps(&triangleTangents.m_binormal_x[firstTriIndex], cross.x);
+        _mm_storeu_ps(&triangleTangents.m_binormal_y[firstTriIndex], cross.y);
+        _mm_storeu_ps(&triangleTangents.m_binormal_z[firstTriIndex], cross.z);
+
+        // See GetExteriorAnglesOfTri
+        auto L10 = Vec3x4_Sub(p0, p1);
+        auto L21 = Vec3x4_Sub(p1, p2);
+        auto L02 = Vec3x4_Sub(p2, p0);
+        Vec3x4_Normalize(L10);
+        Vec3x4_Normalize(L21);
+        Vec3x4_Normalize(L02);
+
+        float cosines[3][SSE2_TRIANGLE_COUNT];
+        _mm_storeu_ps(cosines[0], Vec3x4_Dot(L10, L02));
+        _mm_storeu_ps(cosines[1], Vec3x4_Dot(L21, L10));
+        _mm_storeu_ps(cosines[2], Vec3x4_Dot(L02, L21));
+
+        for (auto triOffset = 0uz; triOffset < SSE2_TRIANGLE_COUNT; triOffset++)
         {
-            const auto i0 = vertexData.triData[triIndex * 3u + 0u];
-            const auto i1 = vertexData.triData[triIndex * 3u + 1u];
-            const auto i2 = vertexData.triData[triIndex * 3u + 2u];
-
-            tvec3 vector, cross, exteriorAngles;
-            sub_10022E80(vertexData, i0, i1, i2, vector, cross);
-            GetExteriorAnglesOfTri(vertexData, exteriorAngles, i0, i1, i2);
-            sub_10022CA0(i0, vertexData.tangentData, vector, exteriorAngles[0], vertexData.tangentDataStride);
-            sub_10022CA0(i1, vertexData.tangentData, vector, exteriorAngles[1], vertexData.tangentDataStride);
-            sub_10022CA0(i2, vertexData.tangentData, vector, exteriorAngles[2], vertexData.tangentDataStride);
-            sub_10022CA0(i0, vertexData.binormalData, cross, exteriorAngles[0], vertexData.binormalDataStride);
-            sub_10022CA0(i1, vertexData.binormalData, cross, exteriorAngles[1], vertexData.binormalDataStride);
-            sub_10022CA0(i2, vertexData.binormalData, cross, exteriorAngles[2], vertexData.binormalDataStride);
+            for (auto corner = 0uz; corner < 3uz; corner++)
+                triangleTangents.m_exterior_angles[(firstTriIndex + triOffset) * 3u + corner] = AngleFromCosine(cosines[corner][triOffset]);
         }
+    }
+#endif
 
-        for (auto vertexIndex = 0u; vertexIndex < vertexCount; vertexIndex++)
+    void CalculateTriangleTangentsForRange(const VertexData& vertexData, size_t triIndex, const size_t triEnd, TriangleTangents& triangleTangents)
+    {
+#ifdef TANGENT_SPACE_SSE2
+        for (; triIndex + SSE2_TRIANGLE_COUNT <= triEnd; triIndex += SSE2_TRIANGLE_COUNT)
+            CalculateTriangleTangentsSse2(vertexData, triIndex, triangleTangents);
+#endif
+
+        for (; triIndex < triEnd; triIndex++)
+            CalculateTriangleTangents(vertexData, triIndex, triangleTangents);
+    }
+
+    /**
+     * \brief Sums the tangents and binormals of all triangles using a vertex, weighted by its exterior angle in the triangle,
+     * and orthonormalizes them with the vertex normal.
+     * \param vertexCorners The indices of all triangle corners using the vertex in ascending order.
+     */
+    void CalculateVertexTangents(const VertexData& vertexData,
+                                 const size_t vertexIndex,
+                                 const uint32_t* vertexCorners,
+                                 const size_t vertexCornerCount,
+                                 const TriangleTangents& triangleTangents)
+    {
+        tvec3 tangent{0, 0, 0};
+        tvec3 binormal{0, 0, 0};
+
+        // Summing up in the order of the triangles always yields the same result regardless of how the work is split
+        for (auto cornerOffset = 0uz; cornerOffset < vertexCornerCount; cornerOffset++)
         {
-            const auto& normal = GetVec3(vertexData.normalData, vertexIndex, vertexData.normalDataStride);
-            auto& tangent = GetVec3(vertexData.tangentData, vertexIndex, vertexData.tangentDataStride);
-            auto& binormal = GetVec3(vertexData.binormalData, vertexIndex, vertexData.binormalDataStride);
+            const auto corner = vertexCorners[cornerOffset];
+            const auto triIndex = corner / 3u;
+            const auto exteriorAngle = triangleTangents.m_exterior_angles[corner];
 
-            const auto dot_normal_tangent = normal[0] * tangent[0] + normal[1] * tangent[1] + normal[2] * tangent[2];
+            tangent[0] = triangleTangents.m_tangent_x[triIndex] * exteriorAngle + tangent[0];
+            tangent[1] = triangleTangents.m_tangent_y[triIndex] * exteriorAngle + tangent[1];
+            tangent[2] = triangleTangents.m_tangent_z[triIndex] * exteriorAngle + tangent[2];
+            binormal[0] = triangleTangents.m_binormal_x[triIndex] * exteriorAngle + binormal[0];
+            binormal[1] = triangleTangents.m_binormal_y[triIndex] * exteriorAngle + binormal[1];
+            binormal[2] = triangleTangents.m_binormal_z[triIndex] * exteriorAngle + binormal[2];
+        }
 
-            tangent[0] = normal[0] * -dot_normal_tangent + tangent[0];
-            tangent[1] = normal[1] * -dot_normal_tangent + tangent[1];
-            tangent[2] = normal[2] * -dot_normal_tangent + tangent[2];
-            if (Vec3_Normalize(tangent) < 0.001f)
-            {
-                Vec3_Cross(binormal, normal, tangent);
-                if (Vec3_Normalize(tangent) < 0.001)
-                    sub_10014EE0(normal, tangent);
-            }
+        const auto& normal = GetVec3(vertexData.normalData, vertexIndex, vertexData.normalDataStride);
 
-            tvec3 cross;
-            Vec3_Cross(normal, tangent, cross);
-            const auto sourcesc = binormal[0] * cross[0] + cross[1] * binormal[1] + cross[2] * binormal[2];
-            if (sourcesc >= 0.0)
-            {
-                binormal[0] = cross[0];
-                binormal[1] = cross[1];
-                binormal[2] = cross[2];
-            }
-            else
-            {
-                binormal[0] = -cross[0];
-                binormal[1] = -cross[1];
-                binormal[2] = -cross[2];
-            }
+        const auto dot_normal_tangent = normal[0] * tangent[0] + normal[1] * tangent[1] + normal[2] * tangent[2];
+
+        tangent[0] = normal[0] * -dot_normal_tangent + tangent[0];
+        tangent[1] = normal[1] * -dot_normal_tangent + tangent[1];
+        tangent[2] = normal[2] * -dot_normal_tangent + tangent[2];
+        if (Vec3_Normalize(tangent) < 0.001f)
+        {
+            Vec3_Cross(binormal, normal, tangent);
+            if (Vec3_Normalize(tangent) < 0.001)
+                sub_10014EE0(normal, tangent);
+        }
+
+        tvec3 cross;
+        Vec3_Cross(normal, tangent, cross);
+        const auto sourcesc = binormal[0] * cross[0] + cross[1] * binormal[1] + cross[2] * binormal[2];
+        if (sourcesc >= 0.0)
+        {
+            binormal[0] = cross[0];
+            binormal[1] = cross[1];
+            binormal[2] = cross[2];
+        }
+        else
+        {
+            binormal[0] = -cross[0];
+            binormal[1] = -cross[1];
+            binormal[2] = -cross[2];
+        }
+
+        SetVec3(vertexData.tangentData, vertexIndex, vertexData.tangentDataStride, tangent);
+        SetVec3(vertexData.binormalData, vertexIndex, vertexData.binormalDataStride, binormal);
+    }
+
+    void CalculateTangentSpace(const VertexData& vertexData, const size_t triCount, const size_t vertexCount)
+    {
+        const auto cornerCount = triCount * 3u;
+
+        // Calculate the tangent space of all triangles
+        TriangleTangents triangleTangents(triCount);
+        utils::ParallelFor((triCount + ELEMENTS_PER_TASK - 1u) / ELEMENTS_PER_TASK,
+                           [&vertexData, &triangleTangents, triCount](const size_t taskIndex)
+                           {
+                               const auto triStart = taskIndex * ELEMENTS_PER_TASK;
+                               CalculateTriangleTangentsForRange(vertexData, triStart, std::min(triStart + ELEMENTS_PER_TASK, triCount), triangleTangents);
+                           });
+
+        // Group the triangle corners by the vertex they use, keeping them in ascending order
+        std::vector<uint32_t> vertexCornerOffsets(vertexCount + 1u, 0u);
+        for (auto corner = 0uz; corner < cornerCount; corner++)
+        {
+            assert(vertexData.triData[corner] < vertexCount);
+            vertexCornerOffsets[vertexData.triData[corner] + 1u]++;
         }
+
+        for (auto vertexIndex = 0uz; vertexIndex < vertexCount; vertexIndex++)
+            vertexCornerOffsets[vertexIndex + 1u] += vertexCornerOffsets[vertexIndex];
+
+        std::vector<uint32_t> vertexCorners(cornerCount);
+        std::vector<uint32_t> vertexCornerInsertOffsets(vertexCornerOffsets.begin(), vertexCornerOffsets.end() - 1);
+        for (auto corner = 0uz; corner < cornerCount; corner++)
+            vertexCorners[vertexCornerInsertOffsets[vertexData.triData[corner]]++] = static_cast<uint32_t>(corner);
+
+        // Every vertex only depends on the triangles using it
+        utils::ParallelFor((vertexCount + ELEMENTS_PER_TASK - 1u) / ELEMENTS_PER_TASK,
+                           [&vertexData, &vertexCornerOffsets, &vertexCorners, &triangleTangents, vertexCount](const size_t taskIndex)
+                           {
+                               const auto vertexStart = taskIndex * ELEMENTS_PER_TASK;
+                               const auto vertexEnd = std::min(vertexStart + ELEMENTS_PER_TASK, vertexCount);
+                               for (auto vertexIndex = vertexStart; vertexIndex < vertexEnd; vertexIndex++)
+                               {
+                                   const auto firstCorner = vertexCornerOffsets[vertexIndex];
+                                   CalculateVertexTangents(vertexData,
+                                                           vertexIndex,
+                                                           &vertexCorners[firstCorner],
+                                                           vertexCornerOffsets[vertexIndex + 1u] - firstCorner,
+                                                           triangleTangents);
+                               }
+                           });
     }
 } // namespace tangent_space
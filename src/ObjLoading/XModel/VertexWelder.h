@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Utils/ClassUtils.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+/**
+ * \brief Finds vertices that are identical to a previously added vertex using an open addressing hash table.
+ * Keys are compared by their object representation, so they must not contain padding or floating point members.
+ * All buffers are kept when resetting, so a single welder can be reused for many surfaces without reallocating.
+ */
+template<typename TKey> class VertexWelder
+{
+    static_assert(std::has_unique_object_representations_v<TKey>);
+
+public:
+    VertexWelder()
+        : m_mask(0u)
+    {
+    }
+
+    /**
+     * \brief Removes all vertices and prepares the table for the specified amount of vertices.
+     */
+    void Reset(const size_t expectedVertexCount)
+    {
+        m_entries.clear();
+        m_entries.reserve(expectedVertexCount);
+
+        const auto slotCount = std::bit_ceil(std::max(expectedVertexCount * 2u, MIN_SLOT_COUNT));
+        m_slots.assign(slotCount, EMPTY_SLOT);
+        m_mask = slotCount - 1u;
+    }
+
+    /**
+     * \brief Returns the value of a previously added vertex with the same key or adds the vertex with the specified value.
+     * \param key The key of the vertex.
+     * \param value The value to associate with the vertex if it was not added yet.
+     * \return The value associated with the key.
+     */
+    uint32_t FindOrAdd(const TKey& key, const uint32_t value)
+    {
+        const auto hash = Hash(key);
+        for (auto slotIndex = hash & m_mask;; slotIndex = (slotIndex + 1u) & m_mask)
+        {
+            const auto entryIndex = m_slots[slotIndex];
+            if (entryIndex == EMPTY_SLOT)
+            {
+                m_slots[slotIndex] = static_cast<uint32_t>(m_entries.size());
+                m_entries.emplace_back(key, value);
+
+                // Keep the table at most half full to keep probe sequences short
+                if (m_entries.size() * 2u > m_slots.size())
+                    Grow();
+
+                return value;
+            }
+
+            const auto& entry = m_entries[entryIndex];
+            if (std::memcmp(&entry.m_key, &key, sizeof(TKey)) == 0)
+                return entry.m_value;
+        }
+    }
+
+    _NODISCARD size_t GetVertexCount() const
+    {
+        return m_entries.size();
+    }
+
+private:
+    static constexpr auto EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+    static constexpr auto MIN_SLOT_COUNT = 16uz;
+
+    class Entry
+    {
+    public:
+        TKey m_key;
+        uint32_t m_value;
+
+        Entry(const TKey& key, const uint32_t value)
+            : m_key(key),
+              m_value(value)
+        {
+        }
+    };
+
+    static size_t Hash(const TKey& key)
+    {
+        const auto* data = reinterpret_cast<const unsigned char*>(&key);
+
+        uint64_t hash = 0x9E3779B97F4A7C15u;
+        auto offset = 0uz;
+        for (; offset + sizeof(uint64_t) <= sizeof(TKey); offset += sizeof(uint64_t))
+        {
+            uint64_t chunk;
+            std::memcpy(&chunk, &data[offset], sizeof(chunk));
+            hash = (hash ^ chunk) * 0xBF58476D1CE4E5B9u;
+            hash ^= hash >> 31u;
+        }
+
+        for (; offset < sizeof(TKey); offset++)
+            hash = (hash ^ data[offset]) * 0x100000001B3u;
+
+        hash ^= hash >> 29u;
+        return static_cast<size_t>(hash);
+    }
+
+    void Grow()
+    {
+        const auto slotCount = m_slots.size() * 2u;
+        m_slots.assign(slotCount, EMPTY_SLOT);
+        m_mask = slotCount - 1u;
+
+        for (auto entryIndex = 0uz; entryIndex < m_entries.size(); entryIndex++)
+        {
+            auto slotIndex = Hash(m_entries[entryIndex].m_key) & m_mask;
+            while (m_slots[slotIndex] != EMPTY_SLOT)
+                slotIndex = (slotIndex + 1u) & m_mask;
+
+            m_slots[slotIndex] = static_cast<uint32_t>(entryIndex);
+        }
+    }
+
+    std::vector<uint32_t> m_slots;
+    std::vector<Entry> m_entries;
+    size_t m_mask;
+};
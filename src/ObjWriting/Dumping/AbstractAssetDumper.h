@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IAssetDumper.h"
+#include "Utils/Tracing.h"
 
 template<class T> class AbstractAssetDumper : public IAssetDumper<T>
 {
@@ -22,6 +23,8 @@ public:
                 continue;
             }
 
+            const utils::TraceScope assetTrace(
+                "dump_asset", utils::IsTracingEnabled() ? context.m_zone.m_pools->GetAssetTypeName(assetInfo->m_type).value_or("unknown") : "", assetInfo->m_name);
             DumpAsset(context, assetInfo);
         }
     }
@@ -0,0 +1,113 @@
+#include "BufferedTextWriter.h"
+
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cstring>
+
+FixedFloat::FixedFloat(const float value, const int precision)
+    : m_value(value),
+      m_precision(precision)
+{
+}
+
+BufferedTextWriter::BufferedTextWriter(std::ostream& stream)
+    : m_stream(stream),
+      m_buffer(BUFFER_SIZE),
+      m_buffer_size(0u)
+{
+}
+
+BufferedTextWriter::~BufferedTextWriter()
+{
+    Flush();
+}
+
+template<typename... Args> void BufferedTextWriter::WriteChars(Args... args)
+{
+    auto result = std::to_chars(&m_buffer[m_buffer_size], m_buffer.data() + m_buffer.size(), args...);
+    if (result.ec == std::errc::value_too_large)
+    {
+        Flush();
+        result = std::to_chars(m_buffer.data(), m_buffer.data() + m_buffer.size(), args...);
+    }
+
+    assert(result.ec == std::errc());
+    m_buffer_size = static_cast<size_t>(result.ptr - m_buffer.data());
+}
+
+BufferedTextWriter& BufferedTextWriter::operator<<(const char c)
+{
+    if (m_buffer_size >= m_buffer.size())
+        Flush();
+
+    m_buffer[m_buffer_size++] = c;
+    return *this;
+}
+
+BufferedTextWriter& BufferedTextWriter::operator<<(const std::string_view str)
+{
+    if (m_buffer_size + str.size() > m_buffer.size())
+    {
+        Flush();
+
+        // Do not copy strings into the buffer that would not fit anyway
+        if (str.size() > m_buffer.size())
+        {
+            m_stream.write(str.data(), static_cast<std::streamsize>(str.size()));
+            return *this;
+        }
+    }
+
+    std::memcpy(&m_buffer[m_buffer_size], str.data(), str.size());
+    m_buffer_size += str.size();
+    return *this;
+}
+
+void BufferedTextWriter::WriteInteger(const long long value)
+{
+    WriteChars(value);
+}
+
+void BufferedTextWriter::WriteInteger(const unsigned long long value)
+{
+    WriteChars(value);
+}
+
+BufferedTextWriter& BufferedTextWriter::operator<<(const float value)
+{
+    WriteChars(value);
+    return *this;
+}
+
+BufferedTextWriter& BufferedTextWriter::operator<<(const double value)
+{
+    WriteChars(value);
+    return *this;
+}
+
+BufferedTextWriter& BufferedTextWriter::operator<<(const FixedFloat& value)
+{
+    WriteChars(value.m_value, std::chars_format::fixed, value.m_precision);
+    return *this;
+}
+
+void BufferedTextWriter::Flush()
+{
+    if (m_buffer_size == 0u)
+        return;
+
+    m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer_size));
+    m_buffer_size = 0u;
+}
+
+std::string BufferedTextWriter::FormatFloat(const float value)
+{
+    // Large enough for the longest shortest representation of a float like "-1.17549435e-38"
+    std::array<char, 32> buffer;
+
+    const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    assert(result.ec == std::errc());
+
+    return std::string(buffer.data(), result.ptr);
+}
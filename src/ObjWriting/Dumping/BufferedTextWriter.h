@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Utils/ClassUtils.h"
+
+#include <concepts>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * \brief A floating point value that is written in fixed notation with a specified amount of decimal places, like \c {:.6f} does with \c std::format.
+ */
+class FixedFloat
+{
+public:
+    explicit FixedFloat(float value, int precision = 6);
+
+    float m_value;
+    int m_precision;
+};
+
+/**
+ * \brief Writes text to a stream through an internal buffer.
+ * Numbers are formatted with \c std::to_chars, which does not depend on the locale of the stream and is a lot faster than stream formatting.
+ * Floating point values are written in their shortest representation that parses back to exactly the same value.
+ * The buffer is flushed to the stream when it is full, when calling Flush and when the writer is destroyed.
+ */
+class BufferedTextWriter
+{
+public:
+    static constexpr auto BUFFER_SIZE = 0x10000uz;
+
+    explicit BufferedTextWriter(std::ostream& stream);
+    ~BufferedTextWriter();
+    BufferedTextWriter(const BufferedTextWriter& other) = delete;
+    BufferedTextWriter(BufferedTextWriter&& other) noexcept = delete;
+    BufferedTextWriter& operator=(const BufferedTextWriter& other) = delete;
+    BufferedTextWriter& operator=(BufferedTextWriter&& other) noexcept = delete;
+
+    BufferedTextWriter& operator<<(char c);
+    BufferedTextWriter& operator<<(std::string_view str);
+    BufferedTextWriter& operator<<(float value);
+    BufferedTextWriter& operator<<(double value);
+    BufferedTextWriter& operator<<(const FixedFloat& value);
+
+    template<std::integral T> BufferedTextWriter& operator<<(const T value)
+    {
+        if constexpr (std::is_signed_v<T>)
+            WriteInteger(static_cast<long long>(value));
+        else
+            WriteInteger(static_cast<unsigned long long>(value));
+
+        return *this;
+    }
+
+    /**
+     * \brief Writes all buffered text to the stream.
+     */
+    void Flush();
+
+    /**
+     * \brief Formats a floating point value the same way the writer does.
+     */
+    _NODISCARD static std::string FormatFloat(float value);
+
+private:
+    void WriteInteger(long long value);
+    void WriteInteger(unsigned long long value);
+    template<typename... Args> void WriteChars(Args... args);
+
+    std::ostream& m_stream;
+    std::vector<char> m_buffer;
+    size_t m_buffer_size;
+};
@@ -2,7 +2,6 @@
 
 #include "Image/DdsWriter.h"
 #include "Image/Dx9TextureLoader.h"
-#include "Image/IwiLoader.h"
 #include "Image/IwiTypes.h"
 #include "Image/IwiWriter6.h"
 #include "Image/Texture.h"
@@ -36,43 +35,24 @@ namespace
         return textureLoader.LoadTexture(loadDef.data);
     }
 
-    std::unique_ptr<Texture> LoadImageFromIwi(const GfxImage& image, ISearchPath& searchPath)
+    std::unique_ptr<IImageWriter> CreateImageWriter()
     {
-        const auto imageFileName = std::format("images/{}.iwi", image.name);
-        const auto filePathImage = searchPath.Open(imageFileName);
-        if (!filePathImage.IsOpen())
+        switch (ObjWriting::Configuration.ImageOutputFormat)
         {
-            std::cerr << std::format("Could not find data for image \"{}\"\n", image.name);
+        case ObjWriting::Configuration_t::ImageOutputFormat_e::DDS:
+            return std::make_unique<DdsWriter>();
+        case ObjWriting::Configuration_t::ImageOutputFormat_e::IWI:
+            return std::make_unique<iwi6::IwiWriter>();
+        default:
+            assert(false);
             return nullptr;
         }
-
-        return iwi::LoadIwi(*filePathImage.m_stream);
-    }
-
-    std::unique_ptr<Texture> LoadImageData(ISearchPath& searchPath, const GfxImage& image)
-    {
-        if (image.texture.loadDef && image.texture.loadDef->resourceSize > 0)
-            return LoadImageFromLoadDef(image);
-
-        return LoadImageFromIwi(image, searchPath);
     }
 } // namespace
 
 AssetDumperGfxImage::AssetDumperGfxImage()
+    : m_image_dumper(CreateImageWriter())
 {
-    switch (ObjWriting::Configuration.ImageOutputFormat)
-    {
-    case ObjWriting::Configuration_t::ImageOutputFormat_e::DDS:
-        m_writer = std::make_unique<DdsWriter>();
-        break;
-    case ObjWriting::Configuration_t::ImageOutputFormat_e::IWI:
-        m_writer = std::make_unique<iwi6::IwiWriter>();
-        break;
-    default:
-        assert(false);
-        m_writer = nullptr;
-        break;
-    }
 }
 
 bool AssetDumperGfxImage::ShouldDump(XAssetInfo<GfxImage>* asset)
@@ -85,21 +65,29 @@ std::string AssetDumperGfxImage::GetAssetFileName(const XAssetInfo<GfxImage>& as
     auto cleanAssetName = asset.m_name;
     std::ranges::replace(cleanAssetName, '*', '_');
 
-    return std::format("images/{}{}", cleanAssetName, m_writer->GetFileExtension());
+    return std::format("images/{}{}", cleanAssetName, m_image_dumper.GetFileExtension());
 }
 
 void AssetDumperGfxImage::DumpAsset(AssetDumpingContext& context, XAssetInfo<GfxImage>* asset)
 {
     const auto* image = asset->Asset();
-    const auto texture = LoadImageData(context.m_obj_search_path, *image);
-    if (!texture)
-        return;
+    if (image->texture.loadDef && image->texture.loadDef->resourceSize > 0)
+    {
+        const auto texture = LoadImageFromLoadDef(*image);
+        if (texture)
+            m_image_dumper.DumpTexture(context, GetAssetFileName(*asset), *texture);
 
-    const auto assetFile = context.OpenAssetFile(GetAssetFileName(*asset));
+        return;
+    }
 
-    if (!assetFile)
+    const auto imageFileName = std::format("images/{}.iwi", image->name);
+    const auto filePathImage = context.m_obj_search_path.Open(imageFileName);
+    if (!filePathImage.IsOpen())
+    {
+        std::cerr << std::format("Could not find data for image \"{}\"\n", image->name);
         return;
+    }
 
-    auto& stream = *assetFile;
-    m_writer->DumpImage(stream, texture.get());
+    if (!m_image_dumper.DumpIwi(context, GetAssetFileName(*asset), *filePathImage.m_stream))
+        std::cerr << std::format("Failed to dump image \"{}\"\n", image->name);
 }
@@ -2,15 +2,13 @@
 
 #include "Dumping/AbstractAssetDumper.h"
 #include "Game/IW3/IW3.h"
-#include "Image/IImageWriter.h"
-
-#include <memory>
+#include "Image/ImageDumper.h"
 
 namespace IW3
 {
     class AssetDumperGfxImage final : public AbstractAssetDumper<GfxImage>
     {
-        std::unique_ptr<IImageWriter> m_writer;
+        ImageDumper m_image_dumper;
 
         [[nodiscard]] std::string GetAssetFileName(const XAssetInfo<GfxImage>& asset) const;
 
@@ -24,6 +24,7 @@
 #include "AssetDumpers/AssetDumperXModel.h"
 #include "Game/IW4/GameAssetPoolIW4.h"
 #include "ObjWriting.h"
+#include "Utils/Tracing.h"
 
 using namespace IW4;
 
@@ -32,6 +33,7 @@ bool ObjWriter::DumpZone(AssetDumpingContext& context) const
 #define DUMP_ASSET_POOL(dumperType, poolName, assetType)                                                                                                       \
     if (assetPools->poolName && ObjWriting::ShouldHandleAssetType(assetType))                                                                                  \
     {                                                                                                                                                          \
+        const utils::TraceScope poolTrace("dump_pool", #assetType);                                                                                            \
         dumperType dumper;                                                                                                                                     \
         dumper.DumpPool(context, assetPools->poolName.get());                                                                                                  \
     }
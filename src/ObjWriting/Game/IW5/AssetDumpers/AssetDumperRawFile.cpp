@@ -1,7 +1,10 @@
 #include "AssetDumperRawFile.h"
 
+#include "RawFile/RawFileDecompressor.h"
+
+#include <algorithm>
 #include <format>
-#include <stdexcept>
+#include <span>
 #include <zlib.h>
 
 using namespace IW5;
@@ -23,40 +26,15 @@ void AssetDumperRawFile::DumpAsset(AssetDumpingContext& context, XAssetInfo<RawF
     if (rawFile->compressedLen <= 0)
         return;
 
-    z_stream_s zs{};
-    zs.zalloc = Z_NULL;
-    zs.zfree = Z_NULL;
-    zs.opaque = Z_NULL;
-    zs.avail_in = 0;
-    zs.next_in = Z_NULL;
-
-    int ret = inflateInit(&zs);
-
-    if (ret != Z_OK)
-    {
-        throw std::runtime_error("Initializing inflate failed");
-    }
-
-    zs.next_in = reinterpret_cast<const Bytef*>(rawFile->buffer);
-    zs.avail_in = rawFile->compressedLen;
+    auto* decompressor = context.GetZoneAssetDumperState<RawFileDecompressor>();
+    const auto data = decompressor->Decompress(
+        std::span(rawFile->buffer, static_cast<size_t>(rawFile->compressedLen)), static_cast<size_t>(std::max(rawFile->len, 0)), MAX_WBITS);
 
-    Bytef buffer[0x1000];
-
-    while (zs.avail_in > 0)
+    if (!data)
     {
-        zs.next_out = buffer;
-        zs.avail_out = sizeof(buffer);
-        ret = inflate(&zs, Z_SYNC_FLUSH);
-
-        if (ret < 0)
-        {
-            std::cerr << std::format("Inflate failed when attempting to dump rawfile '{}'\n", rawFile->name);
-            inflateEnd(&zs);
-            return;
-        }
-
-        stream.write(reinterpret_cast<char*>(buffer), sizeof(buffer) - zs.avail_out);
+        std::cerr << std::format("Inflate failed when attempting to dump rawfile '{}'\n", rawFile->name);
+        return;
     }
 
-    inflateEnd(&zs);
+    stream.write(data->data(), static_cast<std::streamsize>(data->size()));
 }
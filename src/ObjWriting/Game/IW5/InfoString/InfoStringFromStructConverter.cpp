@@ -1,5 +1,7 @@
 #include "InfoStringFromStructConverter.h"
 
+#include "Dumping/BufferedTextWriter.h"
+
 #include <cassert>
 
 using namespace IW5;
@@ -43,7 +45,7 @@ void InfoStringFromStructConverter::FillFromBaseField(const cspField_t& field)
     case CSPFT_MPH_TO_INCHES_PER_SEC:
     {
         const auto* num = reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset);
-        m_info_string.SetValueForKey(std::string(field.szName), std::to_string(*num / 17.6f));
+        m_info_string.SetValueForKey(std::string(field.szName), BufferedTextWriter::FormatFloat(*num / 17.6f));
         break;
     }
 
@@ -1,7 +1,10 @@
 #include "AssetDumperRawFile.h"
 
+#include "RawFile/RawFileDecompressor.h"
+
 #include <cassert>
 #include <filesystem>
+#include <span>
 #include <zlib.h>
 
 using namespace T5;
@@ -35,55 +38,18 @@ void AssetDumperRawFile::DumpGsc(AssetDumpingContext& context, XAssetInfo<RawFil
         return;
     }
 
-    z_stream_s zs{};
-
-    zs.zalloc = Z_NULL;
-    zs.zfree = Z_NULL;
-    zs.opaque = Z_NULL;
-    zs.avail_in = 0;
-    zs.next_in = Z_NULL;
-
-    int ret = inflateInit(&zs);
+    auto* decompressor = context.GetZoneAssetDumperState<RawFileDecompressor>();
+    const auto data = decompressor->Decompress(std::span(&rawFile->buffer[8], inLen), outLen, MAX_WBITS);
 
-    if (ret != Z_OK)
+    if (!data)
     {
-        throw std::runtime_error("Initializing inflate failed");
-    }
-
-    zs.next_in = reinterpret_cast<const Bytef*>(&rawFile->buffer[8]);
-    zs.avail_in = inLen;
-
-    Bytef buffer[0x1000];
-
-    size_t writtenSize = 0;
-    while (zs.avail_in > 0)
-    {
-        zs.next_out = buffer;
-        zs.avail_out = sizeof(buffer);
-        ret = inflate(&zs, Z_SYNC_FLUSH);
-
-        if (ret < 0)
-        {
-            std::cout << "Inflate failed for dumping gsc file \"" << rawFile->name << "\"\n";
-            inflateEnd(&zs);
-            return;
-        }
-
-        const auto inflateOutSize = sizeof(buffer) - zs.avail_out;
-
-        if (writtenSize + inflateOutSize >= outLen)
-        {
-            // Last byte is a \0 byte. Skip it.
-            stream.write(reinterpret_cast<char*>(buffer), inflateOutSize - 1);
-        }
-        else
-        {
-            stream.write(reinterpret_cast<char*>(buffer), inflateOutSize);
-        }
-        writtenSize += inflateOutSize;
+        std::cout << "Inflate failed for dumping gsc file \"" << rawFile->name << "\"\n";
+        return;
     }
 
-    inflateEnd(&zs);
+    // Last byte is a \0 byte. Skip it.
+    const auto writtenSize = !data->empty() && data->size() >= outLen ? data->size() - 1u : data->size();
+    stream.write(data->data(), static_cast<std::streamsize>(writtenSize));
 }
 
 bool AssetDumperRawFile::ShouldDump(XAssetInfo<RawFile>* asset)
@@ -11,6 +11,7 @@
 #include "AssetDumpers/AssetDumperXModel.h"
 #include "Game/T5/GameAssetPoolT5.h"
 #include "ObjWriting.h"
+#include "Utils/Tracing.h"
 
 using namespace T5;
 
@@ -19,6 +20,7 @@ bool ObjWriter::DumpZone(AssetDumpingContext& context) const
 #define DUMP_ASSET_POOL(dumperType, poolName, assetType)                                                                                                       \
     if (assetPools->poolName && ObjWriting::ShouldHandleAssetType(assetType))                                                                                  \
     {                                                                                                                                                          \
+        const utils::TraceScope poolTrace("dump_pool", #assetType);                                                                                            \
         dumperType dumper;                                                                                                                                     \
         dumper.DumpPool(context, assetPools->poolName.get());                                                                                                  \
     }
@@ -2,15 +2,13 @@
 
 #include "Dumping/AbstractAssetDumper.h"
 #include "Game/T6/T6.h"
-#include "Image/IImageWriter.h"
-
-#include <memory>
+#include "Image/ImageDumper.h"
 
 namespace T6
 {
     class AssetDumperGfxImage final : public AbstractAssetDumper<GfxImage>
     {
-        std::unique_ptr<IImageWriter> m_writer;
+        ImageDumper m_image_dumper;
 
         std::string GetAssetFileName(const XAssetInfo<GfxImage>& asset) const;
 
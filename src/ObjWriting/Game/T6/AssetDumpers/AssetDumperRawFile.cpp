@@ -1,6 +1,9 @@
 #include "AssetDumperRawFile.h"
 
+#include "RawFile/RawFileDecompressor.h"
+
 #include <filesystem>
+#include <span>
 #include <zlib.h>
 #include <zutil.h>
 
@@ -32,45 +35,16 @@ void AssetDumperRawFile::DumpAnimtree(AssetDumpingContext& context, XAssetInfo<R
         return;
     }
 
-    z_stream_s zs{};
-
-    zs.zalloc = Z_NULL;
-    zs.zfree = Z_NULL;
-    zs.opaque = Z_NULL;
-    zs.avail_in = 0;
-    zs.next_in = Z_NULL;
-
-    int ret = inflateInit2(&zs, -DEF_WBITS);
-
-    if (ret != Z_OK)
-    {
-        throw std::runtime_error("Initializing inflate failed");
-    }
-
-    zs.next_in = reinterpret_cast<const Bytef*>(&rawFile->buffer[4]);
-    zs.avail_in = inLen - sizeof(uint32_t);
-
-    Bytef buffer[0x1000];
+    auto* decompressor = context.GetZoneAssetDumperState<RawFileDecompressor>();
+    const auto data = decompressor->Decompress(std::span(&rawFile->buffer[4], static_cast<size_t>(inLen) - sizeof(uint32_t)), outLen, -DEF_WBITS);
 
-    while (zs.avail_in > 0)
+    if (!data)
     {
-        zs.next_out = buffer;
-        zs.avail_out = sizeof(buffer);
-        ret = inflate(&zs, Z_SYNC_FLUSH);
-
-        if (ret < 0)
-        {
-            std::cerr << "Inflate failed for dumping animtree file \"" << rawFile->name << "\"\n";
-            inflateEnd(&zs);
-            return;
-        }
-
-        const auto inflateOutSize = sizeof(buffer) - zs.avail_out;
-
-        stream.write(reinterpret_cast<char*>(buffer), inflateOutSize);
+        std::cerr << "Inflate failed for dumping animtree file \"" << rawFile->name << "\"\n";
+        return;
     }
 
-    inflateEnd(&zs);
+    stream.write(data->data(), static_cast<std::streamsize>(data->size()));
 }
 
 void AssetDumperRawFile::DumpAsset(AssetDumpingContext& context, XAssetInfo<RawFile>* asset)
@@ -1,5 +1,6 @@
 #include "AssetDumperVehicle.h"
 
+#include "Dumping/BufferedTextWriter.h"
 #include "Game/T6/InfoString/InfoStringFromStructConverter.h"
 #include "Game/T6/ObjConstantsT6.h"
 #include "Game/T6/Vehicle/VehicleFields.h"
@@ -33,14 +34,14 @@ namespace T6
             case VFT_MPH_TO_INCHES_PER_SECOND:
             {
                 const auto* num = reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset);
-                m_info_string.SetValueForKey(std::string(field.szName), std::to_string(*num / 17.6f));
+                m_info_string.SetValueForKey(std::string(field.szName), BufferedTextWriter::FormatFloat(*num / 17.6f));
                 break;
             }
 
             case VFT_POUNDS_TO_GAME_MASS:
             {
                 const auto* num = reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset);
-                m_info_string.SetValueForKey(std::string(field.szName), std::to_string(*num / 0.001f));
+                m_info_string.SetValueForKey(std::string(field.szName), BufferedTextWriter::FormatFloat(*num / 0.001f));
                 break;
             }
 
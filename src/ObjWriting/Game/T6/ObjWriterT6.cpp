@@ -26,6 +26,7 @@
 #include "AssetDumpers/AssetDumperZBarrier.h"
 #include "Game/T6/GameAssetPoolT6.h"
 #include "ObjWriting.h"
+#include "Utils/Tracing.h"
 
 using namespace T6;
 
@@ -34,6 +35,7 @@ bool ObjWriter::DumpZone(AssetDumpingContext& context) const
 #define DUMP_ASSET_POOL(dumperType, poolName, assetType)                                                                                                       \
     if (assetPools->poolName && ObjWriting::ShouldHandleAssetType(assetType))                                                                                  \
     {                                                                                                                                                          \
+        const utils::TraceScope poolTrace("dump_pool", #assetType);                                                                                            \
         dumperType dumper;                                                                                                                                     \
         dumper.DumpPool(context, assetPools->poolName.get());                                                                                                  \
     }
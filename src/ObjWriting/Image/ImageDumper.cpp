@@ -0,0 +1,105 @@
+#include "ImageDumper.h"
+
+#include "Image/IwiLoader.h"
+
+#include <cassert>
+#include <iostream>
+#include <optional>
+#include <sstream>
+
+namespace
+{
+    std::optional<size_t> GetRemainingStreamSize(std::istream& stream)
+    {
+        const auto position = stream.tellg();
+        if (position < 0)
+            return std::nullopt;
+
+        stream.seekg(0, std::ios::end);
+        const auto endPosition = stream.tellg();
+        stream.clear();
+        stream.seekg(position);
+
+        if (endPosition < position)
+            return std::nullopt;
+
+        return static_cast<size_t>(endPosition - position);
+    }
+} // namespace
+
+ImageDumper::ImageDumper(std::unique_ptr<IImageWriter> writer)
+    : m_writer(std::move(writer))
+{
+    assert(m_writer);
+}
+
+std::string ImageDumper::GetFileExtension() const
+{
+    return m_writer->GetFileExtension();
+}
+
+void ImageDumper::DumpTexture(const AssetDumpingContext& context, const std::string& fileName, const Texture& texture) const
+{
+    const auto assetFile = context.OpenAssetFile(fileName);
+
+    if (!assetFile)
+        return;
+
+    auto& stream = *assetFile;
+    m_writer->DumpImage(stream, &texture);
+}
+
+bool ImageDumper::DumpIwi(const AssetDumpingContext& context, const std::string& fileName, std::istream& iwiStream) const
+{
+    const auto texture = iwi::LoadIwiHeader(iwiStream);
+    if (!texture)
+        return false;
+
+    // Copy the mip levels directly when the writer does not change them instead of loading the whole texture first.
+    // This is only possible when the stream is known to contain all mip level data, since an incomplete iwi would leave a partial file.
+    const auto remainingSize = GetRemainingStreamSize(iwiStream);
+    if (remainingSize && *remainingSize < iwi::GetIwiMipLevelDataSize(*texture))
+    {
+        std::cerr << "Unexpected eof of iwi\n";
+        return false;
+    }
+
+    if (remainingSize && m_writer->SupportsIwiPassthrough(texture->GetFormat()))
+    {
+        const auto assetFile = context.OpenAssetFile(fileName);
+
+        if (!assetFile)
+            return false;
+
+        return m_writer->DumpIwiPassthrough(*assetFile, texture.get(), iwiStream);
+    }
+
+    // The output is only opened once all mip levels were loaded, so an incomplete iwi does not leave a partial file
+    if (!iwi::LoadIwiMipLevels(iwiStream, *texture))
+        return false;
+
+    DumpTexture(context, fileName, *texture);
+    return true;
+}
+
+std::unique_ptr<std::istream> ImageDumper::ReadCompleteIwi(std::istream& iwiStream)
+{
+    auto iwiData = std::make_unique<std::stringstream>();
+    *iwiData << iwiStream.rdbuf();
+
+    const auto texture = iwi::LoadIwiHeader(*iwiData);
+    if (!texture)
+        return nullptr;
+
+    const auto headerSize = iwiData->tellg();
+    iwiData->seekg(0, std::ios::end);
+    const auto iwiSize = iwiData->tellg();
+    if (static_cast<size_t>(iwiSize - headerSize) < iwi::GetIwiMipLevelDataSize(*texture))
+    {
+        std::cerr << "Unexpected eof of iwi\n";
+        return nullptr;
+    }
+
+    iwiData->seekg(0);
+    return iwiData;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Dumping/AssetDumpingContext.h"
+#include "Image/IImageWriter.h"
+#include "Image/Texture.h"
+
+#include <istream>
+#include <memory>
+#include <string>
+
+/**
+ * \brief Dumps the images of image assets of all games with an image writer.
+ */
+class ImageDumper
+{
+public:
+    explicit ImageDumper(std::unique_ptr<IImageWriter> writer);
+
+    [[nodiscard]] std::string GetFileExtension() const;
+
+    void DumpTexture(const AssetDumpingContext& context, const std::string& fileName, const Texture& texture) const;
+
+    /**
+     * \brief Dumps the image of an iwi.
+     * Mip levels are copied directly from the iwi when the writer does not change them and the stream can seek to check that it contains all mip level data.
+     * Otherwise the whole texture is loaded first. No file is written for iwis that are invalid or incomplete.
+     * \return \c false if the image could not be dumped, e.g. because the iwi is invalid or incomplete.
+     */
+    bool DumpIwi(const AssetDumpingContext& context, const std::string& fileName, std::istream& iwiStream) const;
+
+    /**
+     * \brief Reads a whole iwi into memory and checks that it contains all of its mip level data.
+     * This allows checking whether an iwi is complete before trying the next source and copying its mip levels even when the source stream cannot seek.
+     * \return A stream of the iwi data or \c nullptr if the iwi is invalid or incomplete.
+     */
+    static std::unique_ptr<std::istream> ReadCompleteIwi(std::istream& iwiStream);
+
+private:
+    std::unique_ptr<IImageWriter> m_writer;
+};
@@ -1,8 +1,9 @@
 #include "InfoStringFromStructConverterBase.h"
 
+#include "Dumping/BufferedTextWriter.h"
+
 #include <cassert>
 #include <cstring>
-#include <sstream>
 
 InfoStringFromStructConverterBase::InfoStringFromStructConverterBase(const void* structure)
     : m_structure(structure),
@@ -79,11 +80,7 @@ void InfoStringFromStructConverterBase::FillFromQBoolean(const std::string& key,
 void InfoStringFromStructConverterBase::FillFromFloat(const std::string& key, const size_t offset)
 {
     const auto* num = reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + offset);
-
-    std::ostringstream ss;
-    ss << *num;
-
-    m_info_string.SetValueForKey(key, ss.str());
+    m_info_string.SetValueForKey(key, BufferedTextWriter::FormatFloat(*num));
 }
 
 void InfoStringFromStructConverterBase::FillFromMilliseconds(const std::string& key, const size_t offset)
@@ -91,11 +88,7 @@ void InfoStringFromStructConverterBase::FillFromMilliseconds(const std::string&
     const auto* millis = reinterpret_cast<unsigned int*>(reinterpret_cast<uintptr_t>(m_structure) + offset);
 
     const auto value = static_cast<float>(*millis) / 1000.0f;
-
-    std::ostringstream ss;
-    ss << value;
-
-    m_info_string.SetValueForKey(key, ss.str());
+    m_info_string.SetValueForKey(key, BufferedTextWriter::FormatFloat(value));
 }
 
 void InfoStringFromStructConverterBase::FillFromScriptString(const std::string& key, const size_t offset)
@@ -0,0 +1,93 @@
+#include "RawFileDecompressor.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <zlib.h>
+
+class RawFileDecompressor::InflateStream
+{
+public:
+    explicit InflateStream(const int windowBits)
+        : m_window_bits(windowBits),
+          m_stream{}
+    {
+        m_stream.zalloc = Z_NULL;
+        m_stream.zfree = Z_NULL;
+        m_stream.opaque = Z_NULL;
+        m_stream.avail_in = 0;
+        m_stream.next_in = Z_NULL;
+
+        if (inflateInit2(&m_stream, windowBits) != Z_OK)
+            throw std::runtime_error("Initializing inflate failed");
+    }
+
+    ~InflateStream()
+    {
+        inflateEnd(&m_stream);
+    }
+
+    InflateStream(const InflateStream& other) = delete;
+    InflateStream(InflateStream&& other) noexcept = delete;
+    InflateStream& operator=(const InflateStream& other) = delete;
+    InflateStream& operator=(InflateStream&& other) noexcept = delete;
+
+    int m_window_bits;
+    z_stream m_stream;
+};
+
+RawFileDecompressor::RawFileDecompressor() = default;
+
+RawFileDecompressor::~RawFileDecompressor() = default;
+
+RawFileDecompressor::InflateStream& RawFileDecompressor::GetStream(const int windowBits)
+{
+    for (const auto& stream : m_streams)
+    {
+        if (stream->m_window_bits == windowBits)
+        {
+            inflateReset(&stream->m_stream);
+            return *stream;
+        }
+    }
+
+    return *m_streams.emplace_back(std::make_unique<InflateStream>(windowBits));
+}
+
+std::optional<std::span<const char>> RawFileDecompressor::Decompress(const std::span<const char> compressedData, const size_t expectedSize, const int windowBits)
+{
+    auto& zs = GetStream(windowBits).m_stream;
+
+    // Leave room for one more byte so that the end of the stream is reached without growing the buffer
+    if (m_buffer.size() < expectedSize + 1u)
+        m_buffer.resize(expectedSize + 1u);
+
+    zs.next_in = reinterpret_cast<const Bytef*>(compressedData.data());
+    zs.avail_in = static_cast<uInt>(compressedData.size());
+
+    auto outSize = 0uz;
+    while (true)
+    {
+        if (outSize == m_buffer.size())
+            m_buffer.resize(std::max(m_buffer.size() * 2u, static_cast<size_t>(0x1000)));
+
+        zs.next_out = reinterpret_cast<Bytef*>(&m_buffer[outSize]);
+        zs.avail_out = static_cast<uInt>(m_buffer.size() - outSize);
+
+        const auto availOutBefore = zs.avail_out;
+        const auto ret = inflate(&zs, Z_FINISH);
+        outSize += availOutBefore - zs.avail_out;
+
+        if (ret == Z_STREAM_END)
+            break;
+
+        // Z_BUF_ERROR only signals that more input or output space is needed
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+            return std::nullopt;
+
+        // All input has been consumed without reaching the end of the stream
+        if (zs.avail_in == 0 && zs.avail_out > 0)
+            break;
+    }
+
+    return std::span<const char>(m_buffer.data(), outSize);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Dumping/IZoneAssetDumperState.h"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+/**
+ * \brief Inflates the data of rawfiles while dumping a zone.
+ * The inflate state of each window size is initialized once per zone and reset for every rawfile,
+ * and the data is inflated into a single buffer that is reused for all rawfiles, so it can be written at once.
+ */
+class RawFileDecompressor final : public IZoneAssetDumperState
+{
+public:
+    RawFileDecompressor();
+    ~RawFileDecompressor() override;
+    RawFileDecompressor(const RawFileDecompressor& other) = delete;
+    RawFileDecompressor(RawFileDecompressor&& other) noexcept = delete;
+    RawFileDecompressor& operator=(const RawFileDecompressor& other) = delete;
+    RawFileDecompressor& operator=(RawFileDecompressor&& other) noexcept = delete;
+
+    /**
+     * \brief Inflates the specified data.
+     * Throws when inflate could not be initialized.
+     * \param compressedData The compressed data.
+     * \param expectedSize The size of the data when inflated. It is used to size the output buffer, which still grows if the data turns out to be larger.
+     * \param windowBits The window bits to initialize inflate with. Positive values expect a zlib stream, negative values a raw deflate stream.
+     * \return The inflated data that stays valid until the next call or \c std::nullopt if the data is corrupt.
+     * If the compressed data ends before the end of the stream, the data that could be inflated is returned.
+     */
+    std::optional<std::span<const char>> Decompress(std::span<const char> compressedData, size_t expectedSize, int windowBits);
+
+private:
+    class InflateStream;
+
+    InflateStream& GetStream(int windowBits);
+
+    std::vector<std::unique_ptr<InflateStream>> m_streams;
+    std::vector<char> m_buffer;
+};
@@ -1,12 +1,14 @@
 #include "XModelExportWriter.h"
 
+#include "Dumping/BufferedTextWriter.h"
+
 #pragma warning(push, 0)
 #include <Eigen>
 #pragma warning(pop)
 
-#include <chrono>
-#include <iomanip>
-#include <iostream>
+#include <initializer_list>
+#include <string_view>
+
 
 class XModelExportWriterBase : public XModelWriter
 {
@@ -33,57 +35,74 @@ protected:
         }
     }
 
-    void WriteHeader(const int version) const
+    /**
+     * \brief Writes a line consisting of a keyword followed by floats with the fixed precision all XMODEL_EXPORT values use.
+     */
+    void WriteFloatLine(const std::string_view keyword, const std::initializer_list<float> values, const std::string_view separator = " ")
+    {
+        m_writer << keyword;
+
+        auto first = true;
+        for (const auto value : values)
+        {
+            m_writer << (first ? " " : separator) << FixedFloat(value);
+            first = false;
+        }
+
+        m_writer << '\n';
+    }
+
+    void WriteHeader(const int version)
     {
-        m_stream << "// OpenAssetTools XMODEL_EXPORT File\n";
-        m_stream << "// Game Origin: " << m_game_name << "\n";
-        m_stream << "// Zone Origin: " << m_zone_name << "\n";
-        m_stream << "MODEL\n";
-        m_stream << "VERSION " << version << "\n";
-        m_stream << "\n";
+        m_writer << "// OpenAssetTools XMODEL_EXPORT File\n";
+        m_writer << "// Game Origin: " << m_game_name << "\n";
+        m_writer << "// Zone Origin: " << m_zone_name << "\n";
+        m_writer << "MODEL\n";
+        m_writer << "VERSION " << version << "\n";
+        m_writer << "\n";
     }
 
-    void WriteBones(const XModelCommon& xmodel) const
+    void WriteBones(const XModelCommon& xmodel)
     {
-        m_stream << "NUMBONES " << xmodel.m_bones.size() << "\n";
+        m_writer << "NUMBONES " << xmodel.m_bones.size() << "\n";
         size_t boneNum = 0u;
         for (const auto& bone : xmodel.m_bones)
         {
-            m_stream << "BONE " << boneNum << " ";
+            m_writer << "BONE " << boneNum << " ";
             if (bone.parentIndex)
-                m_stream << *bone.parentIndex;
+                m_writer << *bone.parentIndex;
             else
-                m_stream << "-1";
+                m_writer << "-1";
 
-            m_stream << " \"" << bone.name << "\"\n";
+            m_writer << " \"" << bone.name << "\"\n";
             boneNum++;
         }
-        m_stream << "\n";
+        m_writer << "\n";
 
         boneNum = 0u;
         for (const auto& bone : xmodel.m_bones)
         {
-            m_stream << "BONE " << boneNum << "\n";
-            m_stream << std::format("OFFSET {:.6f}, {:.6f}, {:.6f}\n", bone.globalOffset[0], bone.globalOffset[1], bone.globalOffset[2]);
-            m_stream << std::format("SCALE {:.6f}, {:.6f}, {:.6f}\n", bone.scale[0], bone.scale[1], bone.scale[2]);
+            m_writer << "BONE " << boneNum << "\n";
+            WriteFloatLine("OFFSET", {bone.globalOffset[0], bone.globalOffset[1], bone.globalOffset[2]}, ", ");
+            WriteFloatLine("SCALE", {bone.scale[0], bone.scale[1], bone.scale[2]}, ", ");
 
             const auto mat = Eigen::Quaternionf(bone.globalRotation.w, bone.globalRotation.x, bone.globalRotation.y, bone.globalRotation.z).matrix();
-            m_stream << std::format("X {:.6f}, {:.6f}, {:.6f}\n", mat(0, 0), mat(1, 0), mat(2, 0));
-            m_stream << std::format("Y {:.6f}, {:.6f}, {:.6f}\n", mat(0, 1), mat(1, 1), mat(2, 1));
-            m_stream << std::format("Z {:.6f}, {:.6f}, {:.6f}\n", mat(0, 2), mat(1, 2), mat(2, 2));
-            m_stream << '\n';
+            WriteFloatLine("X", {mat(0, 0), mat(1, 0), mat(2, 0)}, ", ");
+            WriteFloatLine("Y", {mat(0, 1), mat(1, 1), mat(2, 1)}, ", ");
+            WriteFloatLine("Z", {mat(0, 2), mat(1, 2), mat(2, 2)}, ", ");
+            m_writer << '\n';
             boneNum++;
         }
     }
 
     XModelExportWriterBase(std::ostream& stream, std::string gameName, std::string zoneName)
-        : m_stream(stream),
+        : m_writer(stream),
           m_game_name(std::move(gameName)),
           m_zone_name(std::move(zoneName))
     {
     }
 
-    std::ostream& m_stream;
+    BufferedTextWriter m_writer;
     std::string m_game_name;
     std::string m_zone_name;
     VertexMerger m_vertex_merger;
@@ -91,42 +110,42 @@ protected:
 
 class XModelExportWriter6 final : public XModelExportWriterBase
 {
-    void WriteVertices(const XModelCommon& xmodel) const
+    void WriteVertices(const XModelCommon& xmodel)
     {
         const auto& distinctVertexValues = m_vertex_merger.GetDistinctValues();
-        m_stream << "NUMVERTS " << distinctVertexValues.size() << "\n";
+        m_writer << "NUMVERTS " << distinctVertexValues.size() << "\n";
         size_t vertexNum = 0u;
         for (const auto& vertexPos : distinctVertexValues)
         {
-            m_stream << "VERT " << vertexNum << "\n";
-            m_stream << std::format("OFFSET {:.6f}, {:.6f}, {:.6f}\n", vertexPos.x, vertexPos.y, vertexPos.z);
-            m_stream << "BONES " << vertexPos.weightCount << "\n";
+            m_writer << "VERT " << vertexNum << "\n";
+            WriteFloatLine("OFFSET", {vertexPos.x, vertexPos.y, vertexPos.z}, ", ");
+            m_writer << "BONES " << vertexPos.weightCount << "\n";
 
             for (auto weightIndex = 0u; weightIndex < vertexPos.weightCount; weightIndex++)
             {
                 const auto& weight = vertexPos.weights[weightIndex];
-                m_stream << std::format("BONE {} {:.6f}\n", weight.boneIndex, weight.weight);
+                m_writer << "BONE " << weight.boneIndex << ' ' << FixedFloat(weight.weight) << '\n';
             }
-            m_stream << "\n";
+            m_writer << "\n";
             vertexNum++;
         }
     }
 
-    void WriteFaceVertex(const size_t index, const XModelVertex& vertex) const
+    void WriteFaceVertex(const size_t index, const XModelVertex& vertex)
     {
-        m_stream << "VERT " << index << "\n";
-        m_stream << std::format("NORMAL {:.6f} {:.6f} {:.6f}\n", vertex.normal[0], vertex.normal[1], vertex.normal[2]);
-        m_stream << std::format("COLOR {:.6f} {:.6f} {:.6f} {:.6f}\n", vertex.color[0], vertex.color[1], vertex.color[2], vertex.color[3]);
-        m_stream << std::format("UV 1 {:.6f} {:.6f}\n", vertex.uv[0], vertex.uv[1]);
+        m_writer << "VERT " << index << "\n";
+        WriteFloatLine("NORMAL", {vertex.normal[0], vertex.normal[1], vertex.normal[2]});
+        WriteFloatLine("COLOR", {vertex.color[0], vertex.color[1], vertex.color[2], vertex.color[3]});
+        WriteFloatLine("UV 1", {vertex.uv[0], vertex.uv[1]});
     }
 
-    void WriteFaces(const XModelCommon& xmodel) const
+    void WriteFaces(const XModelCommon& xmodel)
     {
         auto totalFaceCount = 0uz;
         for (const auto& object : xmodel.m_objects)
             totalFaceCount += object.m_faces.size();
 
-        m_stream << std::format("NUMFACES {}\n", totalFaceCount);
+        m_writer << "NUMFACES " << totalFaceCount << '\n';
 
         auto objectIndex = 0u;
         for (const auto& object : xmodel.m_objects)
@@ -143,70 +162,50 @@ class XModelExportWriter6 final : public XModelExportWriterBase
                 const XModelVertex& v1 = xmodel.m_vertices[face.vertexIndex[1]];
                 const XModelVertex& v2 = xmodel.m_vertices[face.vertexIndex[2]];
 
-                m_stream << "TRI " << objectIndex << " " << object.materialIndex << " 0 0\n";
+                m_writer << "TRI " << objectIndex << " " << object.materialIndex << " 0 0\n";
                 WriteFaceVertex(distinctPositions[0], v0);
                 WriteFaceVertex(distinctPositions[1], v1);
                 WriteFaceVertex(distinctPositions[2], v2);
-                m_stream << "\n";
+                m_writer << "\n";
             }
 
             objectIndex++;
         }
     }
 
-    void WriteObjects(const XModelCommon& xmodel) const
+    void WriteObjects(const XModelCommon& xmodel)
     {
-        m_stream << "NUMOBJECTS " << xmodel.m_objects.size() << "\n";
+        m_writer << "NUMOBJECTS " << xmodel.m_objects.size() << "\n";
         size_t objectNum = 0u;
         for (const auto& object : xmodel.m_objects)
         {
-            m_stream << "OBJECT " << objectNum << " \"" << object.name << "\"\n";
+            m_writer << "OBJECT " << objectNum << " \"" << object.name << "\"\n";
             objectNum++;
         }
-        m_stream << "\n";
+        m_writer << "\n";
     }
 
-    void WriteMaterials(const XModelCommon& xmodel) const
+    void WriteMaterials(const XModelCommon& xmodel)
     {
-        m_stream << "NUMMATERIALS " << xmodel.m_materials.size() << "\n";
+        m_writer << "NUMMATERIALS " << xmodel.m_materials.size() << "\n";
         size_t materialNum = 0u;
         for (const auto& material : xmodel.m_materials)
         {
             const auto colorMapPath = "../images/" + material.colorMapName + ".dds";
-            m_stream << "MATERIAL " << materialNum << " \"" << material.name << "\" \"" << material.materialTypeName << "\" \"" << colorMapPath << "\"\n";
-            m_stream << std::format("COLOR {:.6f} {:.6f} {:.6f} {:.6f}\n", material.color[0], material.color[1], material.color[2], material.color[3]);
-            m_stream << std::format("TRANSPARENCY {:.6f} {:.6f} {:.6f} {:.6f}\n",
-                                    material.transparency[0],
-                                    material.transparency[1],
-                                    material.transparency[2],
-                                    material.transparency[3]);
-            m_stream << std::format("AMBIENTCOLOR {:.6f} {:.6f} {:.6f} {:.6f}\n",
-                                    material.ambientColor[0],
-                                    material.ambientColor[1],
-                                    material.ambientColor[2],
-                                    material.ambientColor[3]);
-            m_stream << std::format("INCANDESCENCE {:.6f} {:.6f} {:.6f} {:.6f}\n",
-                                    material.incandescence[0],
-                                    material.incandescence[1],
-                                    material.incandescence[2],
-                                    material.incandescence[3]);
-            m_stream << std::format("COEFFS {:.6f} {:.6f}\n", material.coeffs[0], material.coeffs[1]);
-            m_stream << std::format("GLOW {:.6f} {}\n", material.glow.x, material.glow.y);
-            m_stream << std::format("REFRACTIVE {} {:.6f}\n", material.refractive.x, material.refractive.y);
-            m_stream << std::format("SPECULARCOLOR {:.6f} {:.6f} {:.6f} {:.6f}\n",
-                                    material.specularColor[0],
-                                    material.specularColor[1],
-                                    material.specularColor[2],
-                                    material.specularColor[3]);
-            m_stream << std::format("REFLECTIVECOLOR {:.6f} {:.6f} {:.6f} {:.6f}\n",
-                                    material.reflectiveColor[0],
-                                    material.reflectiveColor[1],
-                                    material.reflectiveColor[2],
-                                    material.reflectiveColor[3]);
-            m_stream << std::format("REFLECTIVE {} {:.6f}\n", material.reflective.x, material.reflective.y);
-            m_stream << std::format("BLINN {:.6f} {:.6f}\n", material.blinn[0], material.blinn[1]);
-            m_stream << std::format("PHONG {:.6f}\n", material.phong);
-            m_stream << '\n';
+            m_writer << "MATERIAL " << materialNum << " \"" << material.name << "\" \"" << material.materialTypeName << "\" \"" << colorMapPath << "\"\n";
+            WriteFloatLine("COLOR", {material.color[0], material.color[1], material.color[2], material.color[3]});
+            WriteFloatLine("TRANSPARENCY", {material.transparency[0], material.transparency[1], material.transparency[2], material.transparency[3]});
+            WriteFloatLine("AMBIENTCOLOR", {material.ambientColor[0], material.ambientColor[1], material.ambientColor[2], material.ambientColor[3]});
+            WriteFloatLine("INCANDESCENCE", {material.incandescence[0], material.incandescence[1], material.incandescence[2], material.incandescence[3]});
+            WriteFloatLine("COEFFS", {material.coeffs[0], material.coeffs[1]});
+            m_writer << "GLOW " << FixedFloat(material.glow.x) << ' ' << material.glow.y << '\n';
+            m_writer << "REFRACTIVE " << material.refractive.x << ' ' << FixedFloat(material.refractive.y) << '\n';
+            WriteFloatLine("SPECULARCOLOR", {material.specularColor[0], material.specularColor[1], material.specularColor[2], material.specularColor[3]});
+            WriteFloatLine("REFLECTIVECOLOR", {material.reflectiveColor[0], material.reflectiveColor[1], material.reflectiveColor[2], material.reflectiveColor[3]});
+            m_writer << "REFLECTIVE " << material.reflective.x << ' ' << FixedFloat(material.reflective.y) << '\n';
+            WriteFloatLine("BLINN", {material.blinn[0], material.blinn[1]});
+            WriteFloatLine("PHONG", {material.phong});
+            m_writer << '\n';
             materialNum++;
         }
     }
@@ -226,6 +225,7 @@ public:
         WriteFaces(xmodel);
         WriteObjects(xmodel);
         WriteMaterials(xmodel);
+        m_writer.Flush();
     }
 };
 
@@ -3,11 +3,18 @@
 #include "Utils/Alignment.h"
 #include "XModel/Gltf/GltfConstants.h"
 
+#include <cassert>
 #include <cstdint>
 #include <nlohmann/json.hpp>
 
 using namespace gltf;
 
+namespace
+{
+    constexpr auto GLTF_HEADER_SIZE = sizeof(GLTF_MAGIC) + sizeof(GLTF_VERSION) + sizeof(uint32_t);
+    constexpr auto CHUNK_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint32_t);
+} // namespace
+
 BinOutput::BinOutput(std::ostream& stream)
     : m_stream(stream)
 {
@@ -18,69 +25,56 @@ void BinOutput::Write(const void* data, const size_t dataSize) const
     m_stream.write(static_cast<const char*>(data), dataSize);
 }
 
-void BinOutput::AlignToFour(const char value) const
+void BinOutput::WritePadding(const size_t paddingSize, const char value) const
 {
-    const auto offset = m_stream.tellp();
-    if (offset % 4 > 0)
-    {
-        const uint32_t alignmentValue = FileUtils::MakeMagic32(value, value, value, value);
-        Write(&alignmentValue, 4u - (offset % 4u));
-    }
+    assert(paddingSize < 4u);
+
+    const uint32_t alignmentValue = FileUtils::MakeMagic32(value, value, value, value);
+    Write(&alignmentValue, paddingSize);
 }
 
-std::optional<std::string> BinOutput::CreateBufferUri(const void* buffer, size_t bufferSize) const
+std::optional<std::string> BinOutput::CreateBufferUri(size_t bufferSize) const
 {
     return std::nullopt;
 }
 
-void BinOutput::EmitJson(const nlohmann::json& json) const
+void BinOutput::Emit(const nlohmann::json& json, const size_t bufferSize, const buffer_data_func_t& writeBufferData) const
 {
-    static constexpr uint32_t ZERO = 0u;
+    // All sizes are known before writing anything, so the stream never has to seek back to fill in lengths
+    const auto jsonData = json.dump();
+    const auto jsonChunkLength = utils::Align<size_t>(jsonData.size(), 4u);
+    const auto binChunkLength = utils::Align<size_t>(bufferSize, 4u);
+
+    auto fileSize = GLTF_HEADER_SIZE + CHUNK_HEADER_SIZE + jsonChunkLength;
+    if (bufferSize > 0u)
+        fileSize += CHUNK_HEADER_SIZE + binChunkLength;
 
+    const auto fileSize32 = static_cast<uint32_t>(fileSize);
     Write(&GLTF_MAGIC, sizeof(GLTF_MAGIC));
     Write(&GLTF_VERSION, sizeof(GLTF_VERSION));
+    Write(&fileSize32, sizeof(fileSize32));
 
-    // File length will be filled later
-    Write(&ZERO, sizeof(ZERO));
-
-    // Chunk length will be filled after writing json
-    Write(&ZERO, sizeof(ZERO));
+    const auto jsonChunkLength32 = static_cast<uint32_t>(jsonChunkLength);
+    Write(&jsonChunkLength32, sizeof(jsonChunkLength32));
     Write(&CHUNK_MAGIC_JSON, sizeof(CHUNK_MAGIC_JSON));
+    Write(jsonData.data(), jsonData.size());
+    WritePadding(jsonChunkLength - jsonData.size(), ' ');
 
-    m_stream << json;
-
-    AlignToFour(' ');
-
-    const auto offsetAfterData = m_stream.tellp();
-    const auto jsonDataLength = static_cast<uint32_t>(static_cast<unsigned>(offsetAfterData) - GLTF_JSON_CHUNK_DATA_OFFSET);
-
-    // Fill chunk length now
-    m_stream.seekp(GLTF_JSON_CHUNK_LENGTH_OFFSET, std::ios::beg);
-    Write(&jsonDataLength, sizeof(jsonDataLength));
+    if (bufferSize == 0u)
+        return;
 
-    // Return to previous pos
-    m_stream.seekp(offsetAfterData, std::ios::beg);
-}
-
-void BinOutput::EmitBuffer(const void* buffer, const size_t bufferSize) const
-{
-    const auto chunkLength = utils::Align<uint32_t>(static_cast<uint32_t>(bufferSize), 4u);
-    Write(&chunkLength, sizeof(chunkLength));
+    const auto binChunkLength32 = static_cast<uint32_t>(binChunkLength);
+    Write(&binChunkLength32, sizeof(binChunkLength32));
     Write(&CHUNK_MAGIC_BIN, sizeof(CHUNK_MAGIC_BIN));
 
-    Write(buffer, bufferSize);
-    AlignToFour('\0');
-}
-
-void BinOutput::Finalize() const
-{
-    const auto fileEndOffset = m_stream.tellp();
-    const auto fileSize = static_cast<uint32_t>(fileEndOffset);
-
-    // Fill chunk length now
-    m_stream.seekp(GLTF_LENGTH_OFFSET, std::ios::beg);
-    Write(&fileSize, sizeof(fileSize));
+    auto writtenBufferSize = 0uz;
+    writeBufferData(
+        [this, &writtenBufferSize](const void* data, const size_t dataSize)
+        {
+            Write(data, dataSize);
+            writtenBufferSize += dataSize;
+        });
 
-    // Return to file end
-    m_stream.seekp(fileEndOffset, std::ios::beg);
+    assert(writtenBufferSize == bufferSize);
+    WritePadding(binChunkLength - bufferSize, '\0');
 }
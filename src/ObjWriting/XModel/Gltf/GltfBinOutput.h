@@ -11,14 +11,12 @@ namespace gltf
     public:
         explicit BinOutput(std::ostream& stream);
 
-        std::optional<std::string> CreateBufferUri(const void* buffer, size_t bufferSize) const override;
-        void EmitJson(const nlohmann::json& json) const override;
-        void EmitBuffer(const void* buffer, size_t bufferSize) const override;
-        void Finalize() const override;
+        std::optional<std::string> CreateBufferUri(size_t bufferSize) const override;
+        void Emit(const nlohmann::json& json, size_t bufferSize, const buffer_data_func_t& writeBufferData) const override;
 
     private:
         void Write(const void* data, size_t dataSize) const;
-        void AlignToFour(char value) const;
+        void WritePadding(size_t paddingSize, char value) const;
 
         std::ostream& m_stream;
     };
@@ -1,11 +1,23 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 #include <string>
 
 namespace gltf
 {
+    /**
+     * \brief Receives a chunk of the buffer data. Consecutive calls continue where the previous chunk ended.
+     */
+    using buffer_chunk_func_t = std::function<void(const void* data, size_t dataSize)>;
+
+    /**
+     * \brief Writes the complete buffer data by passing it to the specified function in chunks.
+     */
+    using buffer_data_func_t = std::function<void(const buffer_chunk_func_t& writeChunk)>;
+
     class Output
     {
     protected:
@@ -17,9 +29,15 @@ namespace gltf
         Output& operator=(Output&& other) noexcept = default;
 
     public:
-        virtual std::optional<std::string> CreateBufferUri(const void* buffer, size_t bufferSize) const = 0;
-        virtual void EmitJson(const nlohmann::json& json) const = 0;
-        virtual void EmitBuffer(const void* buffer, size_t bufferSize) const = 0;
-        virtual void Finalize() const = 0;
+        virtual std::optional<std::string> CreateBufferUri(size_t bufferSize) const = 0;
+
+        /**
+         * \brief Emits the json and the buffer data of a gltf file.
+         * The buffer data is requested while emitting and written to the output as it comes in, so it never needs to be in memory as a whole.
+         * \param json The json of the gltf file.
+         * \param bufferSize The size of the buffer data. Exactly this amount of bytes must be written by \p writeBufferData.
+         * \param writeBufferData Writes the buffer data. Not called when the buffer is empty.
+         */
+        virtual void Emit(const nlohmann::json& json, size_t bufferSize, const buffer_data_func_t& writeBufferData) const = 0;
     };
 } // namespace gltf
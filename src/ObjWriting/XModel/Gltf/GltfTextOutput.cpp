@@ -2,8 +2,13 @@
 
 #include "XModel/Gltf/GltfConstants.h"
 
-#include <iomanip>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <format>
 #include <nlohmann/json.hpp>
+#include <vector>
 
 #define LTC_NO_PROTOTYPES
 #include "Base64.h"
@@ -12,37 +17,120 @@
 
 using namespace gltf;
 
-TextOutput::TextOutput(std::ostream& stream)
-    : m_stream(stream)
+namespace
 {
-}
+    // Stands in for the base64 data in the serialized json until the buffer data is streamed into its place.
+    // Buffers are serialized before any user provided strings since json object keys are sorted, so the first occurrence is always the right one.
+    constexpr auto BUFFER_DATA_PLACEHOLDER = "<buffer-data>";
 
-std::optional<std::string> TextOutput::CreateBufferUri(const void* buffer, const size_t bufferSize) const
-{
-    const auto base64Length = base64::GetBase64EncodeOutputLength(bufferSize);
-    const auto base64BufferSize = URI_PREFIX_LENGTH + base64Length;
+    // Base64 encodes groups of three bytes into four characters
+    constexpr auto BASE64_GROUP_SIZE = 3uz;
 
-    std::string output(base64BufferSize, '\0');
+    /**
+     * \brief Base64 encodes data that is passed to it in chunks of arbitrary size.
+     */
+    class Base64StreamEncoder
+    {
+    public:
+        explicit Base64StreamEncoder(std::ostream& stream)
+            : m_stream(stream),
+              m_output_buffer(base64::GetBase64EncodeOutputLength(INPUT_CHUNK_SIZE) + 1u),
+              m_pending{},
+              m_pending_count(0u)
+        {
+        }
 
-    std::memcpy(output.data(), GLTF_DATA_URI_PREFIX, URI_PREFIX_LENGTH);
+        void Write(const void* data, size_t dataSize)
+        {
+            const auto* bytes = static_cast<const uint8_t*>(data);
 
-    auto result = base64::EncodeBase64(buffer, bufferSize, &output[URI_PREFIX_LENGTH], base64Length + 1u);
-    assert(result);
+            // Complete the group left over from the previous chunk first
+            if (m_pending_count > 0u)
+            {
+                while (m_pending_count < BASE64_GROUP_SIZE && dataSize > 0u)
+                {
+                    m_pending[m_pending_count++] = *bytes++;
+                    dataSize--;
+                }
 
-    return output;
-}
+                if (m_pending_count < BASE64_GROUP_SIZE)
+                    return;
+
+                Encode(m_pending, m_pending_count);
+                m_pending_count = 0u;
+            }
+
+            while (dataSize >= BASE64_GROUP_SIZE)
+            {
+                const auto encodeSize = std::min(dataSize - dataSize % BASE64_GROUP_SIZE, INPUT_CHUNK_SIZE);
+                Encode(bytes, encodeSize);
+
+                bytes += encodeSize;
+                dataSize -= encodeSize;
+            }
+
+            std::memcpy(m_pending, bytes, dataSize);
+            m_pending_count = dataSize;
+        }
+
+        void Finalize()
+        {
+            if (m_pending_count > 0u)
+            {
+                Encode(m_pending, m_pending_count);
+                m_pending_count = 0u;
+            }
+        }
 
-void TextOutput::EmitJson(const nlohmann::json& json) const
+    private:
+        static constexpr auto INPUT_CHUNK_SIZE = BASE64_GROUP_SIZE * 0x4000uz;
+
+        void Encode(const void* data, const size_t dataSize)
+        {
+            const auto result = base64::EncodeBase64(data, dataSize, m_output_buffer.data(), m_output_buffer.size());
+            assert(result);
+
+            m_stream.write(m_output_buffer.data(), static_cast<std::streamsize>(base64::GetBase64EncodeOutputLength(dataSize)));
+        }
+
+        std::ostream& m_stream;
+        std::vector<char> m_output_buffer;
+        uint8_t m_pending[BASE64_GROUP_SIZE];
+        size_t m_pending_count;
+    };
+} // namespace
+
+TextOutput::TextOutput(std::ostream& stream)
+    : m_stream(stream)
 {
-    m_stream << std::setw(4) << json;
 }
 
-void TextOutput::EmitBuffer(const void* buffer, const size_t bufferSize) const
+std::optional<std::string> TextOutput::CreateBufferUri(const size_t bufferSize) const
 {
-    // Nothing to do
+    return std::format("{}{}", GLTF_DATA_URI_PREFIX, BUFFER_DATA_PLACEHOLDER);
 }
 
-void TextOutput::Finalize() const
+void TextOutput::Emit(const nlohmann::json& json, const size_t bufferSize, const buffer_data_func_t& writeBufferData) const
 {
-    // Nothing to do
+    const auto jsonData = json.dump(4);
+
+    const auto placeholderOffset = bufferSize > 0u ? jsonData.find(BUFFER_DATA_PLACEHOLDER) : std::string::npos;
+    if (placeholderOffset == std::string::npos)
+    {
+        m_stream << jsonData;
+        return;
+    }
+
+    m_stream.write(jsonData.data(), static_cast<std::streamsize>(placeholderOffset));
+
+    Base64StreamEncoder encoder(m_stream);
+    writeBufferData(
+        [&encoder](const void* data, const size_t dataSize)
+        {
+            encoder.Write(data, dataSize);
+        });
+    encoder.Finalize();
+
+    const auto remainingOffset = placeholderOffset + std::char_traits<char>::length(BUFFER_DATA_PLACEHOLDER);
+    m_stream.write(&jsonData[remainingOffset], static_cast<std::streamsize>(jsonData.size() - remainingOffset));
 }
@@ -11,10 +11,8 @@ namespace gltf
     public:
         explicit TextOutput(std::ostream& stream);
 
-        std::optional<std::string> CreateBufferUri(const void* buffer, size_t bufferSize) const override;
-        void EmitJson(const nlohmann::json& json) const override;
-        void EmitBuffer(const void* buffer, size_t bufferSize) const override;
-        void Finalize() const override;
+        std::optional<std::string> CreateBufferUri(size_t bufferSize) const override;
+        void Emit(const nlohmann::json& json, size_t bufferSize, const buffer_data_func_t& writeBufferData) const override;
 
     private:
         std::ostream& m_stream;
@@ -9,7 +9,13 @@
 #pragma warning(pop)
 
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
 #include <format>
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 using namespace gltf;
 using namespace nlohmann;
@@ -18,6 +24,8 @@ namespace
 {
     constexpr auto GLTF_GENERATOR = "OpenAssetTools " GIT_VERSION;
 
+    constexpr auto BUFFER_CHUNK_SIZE = 0x10000uz;
+
     struct GltfVertex
     {
         float coordinates[3];
@@ -25,6 +33,63 @@ namespace
         float uv[2];
     };
 
+    /**
+     * \brief Collects the small writes of buffer data in a staging buffer and passes them on in chunks of a fixed size.
+     */
+    class BufferChunkWriter
+    {
+    public:
+        explicit BufferChunkWriter(const buffer_chunk_func_t& writeChunk)
+            : m_write_chunk(writeChunk),
+              m_buffer(BUFFER_CHUNK_SIZE),
+              m_buffer_offset(0u),
+              m_written_size(0u)
+        {
+        }
+
+        template<typename T> void Write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            static_assert(sizeof(T) <= BUFFER_CHUNK_SIZE);
+
+            if (m_buffer_offset + sizeof(T) > m_buffer.size())
+                Flush();
+
+            std::memcpy(&m_buffer[m_buffer_offset], &value, sizeof(T));
+            m_buffer_offset += sizeof(T);
+        }
+
+        void Flush()
+        {
+            if (m_buffer_offset == 0u)
+                return;
+
+            m_write_chunk(m_buffer.data(), m_buffer_offset);
+            m_written_size += m_buffer_offset;
+            m_buffer_offset = 0u;
+        }
+
+        _NODISCARD size_t GetWrittenSize() const
+        {
+            return m_written_size + m_buffer_offset;
+        }
+
+    private:
+        const buffer_chunk_func_t& m_write_chunk;
+        std::vector<uint8_t> m_buffer;
+        size_t m_buffer_offset;
+        size_t m_written_size;
+    };
+
+    GltfVertex CreateGltfVertex(const XModelVertex& commonVertex)
+    {
+        return GltfVertex{
+            {commonVertex.coordinates[0], commonVertex.coordinates[2], -commonVertex.coordinates[1]},
+            {commonVertex.normal[0],      commonVertex.normal[2],      -commonVertex.normal[1]     },
+            {commonVertex.uv[0],          commonVertex.uv[1]                                       },
+        };
+    }
+
     class GltfWriterImpl final : public gltf::Writer
     {
     public:
@@ -38,7 +103,6 @@ namespace
         void Write(const XModelCommon& xmodel) override
         {
             JsonRoot gltf;
-            std::vector<uint8_t> bufferData;
 
             CreateJsonAsset(gltf.asset);
             CreateSkeletonNodes(gltf, xmodel);
@@ -50,16 +114,17 @@ namespace
             CreateSkin(gltf, xmodel);
             CreateMeshes(gltf, xmodel);
             CreateScene(gltf, xmodel);
-            FillBufferData(gltf, xmodel, bufferData);
-            CreateBuffer(gltf, xmodel, bufferData);
-
-            const json jRoot = gltf;
-            m_output->EmitJson(jRoot);
 
-            if (!bufferData.empty())
-                m_output->EmitBuffer(bufferData.data(), bufferData.size());
+            const auto bufferSize = GetExpectedBufferSize(xmodel);
+            CreateBuffer(gltf, bufferSize);
 
-            m_output->Finalize();
+            const json jRoot = gltf;
+            m_output->Emit(jRoot,
+                           bufferSize,
+                           [&xmodel](const buffer_chunk_func_t& writeChunk)
+                           {
+                               WriteBufferData(xmodel, writeChunk);
+                           });
         }
 
     private:
@@ -384,6 +449,7 @@ namespace
             positionAccessor.componentType = JsonAccessorComponentType::FLOAT;
             positionAccessor.count = static_cast<unsigned>(xmodel.m_vertices.size());
             positionAccessor.type = JsonAccessorType::VEC3;
+            CreatePositionBounds(positionAccessor, xmodel);
             m_position_accessor = static_cast<unsigned>(gltf.accessors->size());
             gltf.accessors->emplace_back(positionAccessor);
 
@@ -447,13 +513,8 @@ namespace
             }
         }
 
-        void FillBufferData(JsonRoot& gltf, const XModelCommon& xmodel, std::vector<uint8_t>& bufferData) const
+        static void CreatePositionBounds(JsonAccessor& positionAccessor, const XModelCommon& xmodel)
         {
-            const auto expectedBufferSize = GetExpectedBufferSize(xmodel);
-            bufferData.resize(expectedBufferSize);
-
-            auto currentBufferOffset = 0uz;
-
             float minPosition[3]{
                 std::numeric_limits<float>::max(),
                 std::numeric_limits<float>::max(),
@@ -467,111 +528,103 @@ namespace
 
             for (const auto& commonVertex : xmodel.m_vertices)
             {
-                auto* vertex = reinterpret_cast<GltfVertex*>(&bufferData[currentBufferOffset]);
-
-                vertex->coordinates[0] = commonVertex.coordinates[0];
-                vertex->coordinates[1] = commonVertex.coordinates[2];
-                vertex->coordinates[2] = -commonVertex.coordinates[1];
-
-                minPosition[0] = std::min(minPosition[0], vertex->coordinates[0]);
-                minPosition[1] = std::min(minPosition[1], vertex->coordinates[1]);
-                minPosition[2] = std::min(minPosition[2], vertex->coordinates[2]);
-                maxPosition[0] = std::max(maxPosition[0], vertex->coordinates[0]);
-                maxPosition[1] = std::max(maxPosition[1], vertex->coordinates[1]);
-                maxPosition[2] = std::max(maxPosition[2], vertex->coordinates[2]);
-
-                vertex->normal[0] = commonVertex.normal[0];
-                vertex->normal[1] = commonVertex.normal[2];
-                vertex->normal[2] = -commonVertex.normal[1];
+                const auto vertex = CreateGltfVertex(commonVertex);
+
+                minPosition[0] = std::min(minPosition[0], vertex.coordinates[0]);
+                minPosition[1] = std::min(minPosition[1], vertex.coordinates[1]);
+                minPosition[2] = std::min(minPosition[2], vertex.coordinates[2]);
+                maxPosition[0] = std::max(maxPosition[0], vertex.coordinates[0]);
+                maxPosition[1] = std::max(maxPosition[1], vertex.coordinates[1]);
+                maxPosition[2] = std::max(maxPosition[2], vertex.coordinates[2]);
+            }
 
-                vertex->uv[0] = commonVertex.uv[0];
-                vertex->uv[1] = commonVertex.uv[1];
+            positionAccessor.min = std::vector({minPosition[0], minPosition[1], minPosition[2]});
+            positionAccessor.max = std::vector({maxPosition[0], maxPosition[1], maxPosition[2]});
+        }
 
-                currentBufferOffset += sizeof(GltfVertex);
-            }
+        static void WriteBufferData(const XModelCommon& xmodel, const buffer_chunk_func_t& writeChunk)
+        {
+            BufferChunkWriter writer(writeChunk);
 
-            if (gltf.accessors.has_value())
-            {
-                gltf.accessors.value()[m_position_accessor].min = std::vector({minPosition[0], minPosition[1], minPosition[2]});
-                gltf.accessors.value()[m_position_accessor].max = std::vector({maxPosition[0], maxPosition[1], maxPosition[2]});
-            }
+            for (const auto& commonVertex : xmodel.m_vertices)
+                writer.Write(CreateGltfVertex(commonVertex));
 
             if (!xmodel.m_bone_weight_data.weights.empty())
             {
                 assert(xmodel.m_vertex_bone_weights.size() == xmodel.m_vertices.size());
 
-                auto* joints = &bufferData[currentBufferOffset];
-                auto* weights = reinterpret_cast<float*>(&bufferData[currentBufferOffset + sizeof(uint8_t) * 4u * xmodel.m_vertex_bone_weights.size()]);
+                // All joints come before all weights
                 for (const auto& commonVertexWeights : xmodel.m_vertex_bone_weights)
                 {
-                    assert(commonVertexWeights.weightOffset < xmodel.m_bone_weight_data.weights.size());
-                    assert(commonVertexWeights.weightCount <= 4u);
-
-                    const auto commonVertexWeightCount = std::min(commonVertexWeights.weightCount, 4u);
-                    const auto* commonVertexWeightData = &xmodel.m_bone_weight_data.weights[commonVertexWeights.weightOffset];
-                    for (auto i = 0u; i < commonVertexWeightCount; i++)
-                    {
+                    std::array<uint8_t, 4> joints{};
+                    const auto* commonVertexWeightData = GetVertexWeightData(xmodel, commonVertexWeights);
+                    for (auto i = 0u; i < std::min(commonVertexWeights.weightCount, 4u); i++)
                         joints[i] = static_cast<unsigned char>(commonVertexWeightData[i].boneIndex);
-                        weights[i] = commonVertexWeightData[i].weight;
-                    }
 
-                    for (auto i = commonVertexWeightCount; i < 4u; i++)
-                    {
-                        joints[i] = 0u;
-                        weights[i] = 0.0f;
-                    }
-
-                    joints += 4u;
-                    weights += 4u;
+                    writer.Write(joints);
                 }
 
-                currentBufferOffset += (sizeof(uint8_t) + sizeof(float)) * 4u * xmodel.m_vertex_bone_weights.size();
+                for (const auto& commonVertexWeights : xmodel.m_vertex_bone_weights)
+                {
+                    std::array<float, 4> weights{};
+                    const auto* commonVertexWeightData = GetVertexWeightData(xmodel, commonVertexWeights);
+                    for (auto i = 0u; i < std::min(commonVertexWeights.weightCount, 4u); i++)
+                        weights[i] = commonVertexWeightData[i].weight;
+
+                    writer.Write(weights);
+                }
 
-                auto* inverseBindMatrixData = reinterpret_cast<float*>(&bufferData[currentBufferOffset]);
                 for (const auto& bone : xmodel.m_bones)
                 {
                     const auto translation = Eigen::Translation3f(bone.globalOffset[0], bone.globalOffset[2], -bone.globalOffset[1]);
                     const auto rotation = Eigen::Quaternionf(bone.globalRotation.w, bone.globalRotation.x, bone.globalRotation.z, -bone.globalRotation.y);
 
-                    const auto inverseBindMatrix = (translation * rotation).matrix().inverse();
+                    const Eigen::Matrix4f inverseBindMatrix = (translation * rotation).matrix().inverse();
 
                     // GLTF matrix is column major
-                    inverseBindMatrixData[0] = inverseBindMatrix(0, 0);
-                    inverseBindMatrixData[1] = inverseBindMatrix(1, 0);
-                    inverseBindMatrixData[2] = inverseBindMatrix(2, 0);
-                    inverseBindMatrixData[3] = inverseBindMatrix(3, 0);
-                    inverseBindMatrixData[4] = inverseBindMatrix(0, 1);
-                    inverseBindMatrixData[5] = inverseBindMatrix(1, 1);
-                    inverseBindMatrixData[6] = inverseBindMatrix(2, 1);
-                    inverseBindMatrixData[7] = inverseBindMatrix(3, 1);
-                    inverseBindMatrixData[8] = inverseBindMatrix(0, 2);
-                    inverseBindMatrixData[9] = inverseBindMatrix(1, 2);
-                    inverseBindMatrixData[10] = inverseBindMatrix(2, 2);
-                    inverseBindMatrixData[11] = inverseBindMatrix(3, 2);
-                    inverseBindMatrixData[12] = inverseBindMatrix(0, 3);
-                    inverseBindMatrixData[13] = inverseBindMatrix(1, 3);
-                    inverseBindMatrixData[14] = inverseBindMatrix(2, 3);
-                    inverseBindMatrixData[15] = inverseBindMatrix(3, 3);
-
-                    inverseBindMatrixData += 16u;
+                    writer.Write(std::to_array({
+                        inverseBindMatrix(0, 0),
+                        inverseBindMatrix(1, 0),
+                        inverseBindMatrix(2, 0),
+                        inverseBindMatrix(3, 0),
+                        inverseBindMatrix(0, 1),
+                        inverseBindMatrix(1, 1),
+                        inverseBindMatrix(2, 1),
+                        inverseBindMatrix(3, 1),
+                        inverseBindMatrix(0, 2),
+                        inverseBindMatrix(1, 2),
+                        inverseBindMatrix(2, 2),
+                        inverseBindMatrix(3, 2),
+                        inverseBindMatrix(0, 3),
+                        inverseBindMatrix(1, 3),
+                        inverseBindMatrix(2, 3),
+                        inverseBindMatrix(3, 3),
+                    }));
                 }
-                currentBufferOffset += sizeof(float) * 16u * xmodel.m_bones.size();
             }
 
             for (const auto& object : xmodel.m_objects)
             {
                 for (const auto& face : object.m_faces)
                 {
-                    auto* faceIndices = reinterpret_cast<unsigned short*>(&bufferData[currentBufferOffset]);
-                    faceIndices[0] = static_cast<unsigned short>(face.vertexIndex[2]);
-                    faceIndices[1] = static_cast<unsigned short>(face.vertexIndex[1]);
-                    faceIndices[2] = static_cast<unsigned short>(face.vertexIndex[0]);
-
-                    currentBufferOffset += sizeof(unsigned short) * 3u;
+                    writer.Write(std::to_array({
+                        static_cast<unsigned short>(face.vertexIndex[2]),
+                        static_cast<unsigned short>(face.vertexIndex[1]),
+                        static_cast<unsigned short>(face.vertexIndex[0]),
+                    }));
                 }
             }
 
-            assert(expectedBufferSize == currentBufferOffset);
+            writer.Flush();
+            assert(writer.GetWrittenSize() == GetExpectedBufferSize(xmodel));
+        }
+
+        static const XModelBoneWeight* GetVertexWeightData(const XModelCommon& xmodel, const XModelVertexBoneWeights& vertexWeights)
+        {
+            assert(vertexWeights.weightOffset < xmodel.m_bone_weight_data.weights.size());
+            assert(vertexWeights.weightCount <= 4u);
+
+            return &xmodel.m_bone_weight_data.weights[vertexWeights.weightOffset];
         }
 
         static size_t GetExpectedBufferSize(const XModelCommon& xmodel)
@@ -597,16 +650,16 @@ namespace
             return result;
         }
 
-        void CreateBuffer(JsonRoot& gltf, const XModelCommon& xmodel, const std::vector<uint8_t>& bufferData) const
+        void CreateBuffer(JsonRoot& gltf, const size_t bufferSize) const
         {
             if (!gltf.buffers.has_value())
                 gltf.buffers.emplace();
 
             JsonBuffer jsonBuffer;
-            jsonBuffer.byteLength = static_cast<unsigned>(bufferData.size());
+            jsonBuffer.byteLength = static_cast<unsigned>(bufferSize);
 
-            if (!bufferData.empty())
-                jsonBuffer.uri = m_output->CreateBufferUri(bufferData.data(), bufferData.size());
+            if (bufferSize > 0u)
+                jsonBuffer.uri = m_output->CreateBufferUri(bufferSize);
 
             gltf.buffers->emplace_back(std::move(jsonBuffer));
         }
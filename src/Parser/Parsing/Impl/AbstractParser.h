@@ -19,10 +19,12 @@ public:
 protected:
     ILexer<TokenType>* m_lexer;
     std::unique_ptr<ParserState> m_state;
+    std::ostream* m_error_stream;
 
     explicit AbstractParser(ILexer<TokenType>* lexer, std::unique_ptr<ParserState> state)
         : m_lexer(lexer),
-          m_state(std::move(state))
+          m_state(std::move(state)),
+          m_error_stream(&std::cerr)
     {
     }
 
@@ -35,6 +37,14 @@ public:
     AbstractParser& operator=(const AbstractParser& other) = default;
     AbstractParser& operator=(AbstractParser&& other) noexcept = default;
 
+    /**
+     * \brief Sets the stream parsing errors are printed to instead of \c std::cerr.
+     */
+    void SetErrorStream(std::ostream& errorStream)
+    {
+        m_error_stream = &errorStream;
+    }
+
     bool Parse() override
     {
         try
@@ -63,12 +73,12 @@ public:
 
                     if (!line.IsEof())
                     {
-                        std::cerr << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression:\n"
+                        *m_error_stream << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression:\n"
                                   << line.m_line.substr(pos.m_column - 1) << "\n";
                     }
                     else
                     {
-                        std::cerr << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression.\n";
+                        *m_error_stream << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression.\n";
                     }
                     return false;
                 }
@@ -81,11 +91,11 @@ public:
 
             if (!line.IsEof() && line.m_line.size() > static_cast<unsigned>(pos.m_column - 1))
             {
-                std::cerr << "Error: " << e.FullMessage() << "\n" << line.m_line.substr(pos.m_column - 1) << "\n";
+                *m_error_stream << "Error: " << e.FullMessage() << "\n" << line.m_line.substr(pos.m_column - 1) << "\n";
             }
             else
             {
-                std::cerr << "Error: " << e.FullMessage() << "\n";
+                *m_error_stream << "Error: " << e.FullMessage() << "\n";
             }
 
             return false;
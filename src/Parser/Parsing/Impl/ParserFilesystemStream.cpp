@@ -16,6 +16,7 @@ ParserFilesystemStream::ParserFilesystemStream(const std::string& path)
 {
     const auto absolutePath = absolute(fs::path(path));
     m_files.emplace(FileInfo(absolutePath.string()));
+    m_opened_file_paths.emplace_back(absolutePath.string());
 }
 
 bool ParserFilesystemStream::IsOpen() const
@@ -82,6 +83,7 @@ bool ParserFilesystemStream::IncludeFile(const std::string& filename)
     if (!fileInfo.m_stream.is_open())
         return false;
 
+    m_opened_file_paths.emplace_back(*fileInfo.m_file_path);
     m_files.emplace(std::move(fileInfo));
     return true;
 }
@@ -96,3 +98,8 @@ bool ParserFilesystemStream::Eof() const
 {
     return m_files.empty() || m_files.top().m_stream.eof();
 }
+
+const std::vector<std::string>& ParserFilesystemStream::GetOpenedFilePaths() const
+{
+    return m_opened_file_paths;
+}
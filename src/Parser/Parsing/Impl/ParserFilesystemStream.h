@@ -4,6 +4,8 @@
 
 #include <fstream>
 #include <stack>
+#include <string>
+#include <vector>
 
 class ParserFilesystemStream final : public IParserLineStream
 {
@@ -18,6 +20,7 @@ class ParserFilesystemStream final : public IParserLineStream
     };
 
     std::stack<FileInfo> m_files;
+    std::vector<std::string> m_opened_file_paths;
 
 public:
     explicit ParserFilesystemStream(const std::string& path);
@@ -27,4 +30,9 @@ public:
     void PopCurrentFile() override;
     _NODISCARD bool IsOpen() const override;
     _NODISCARD bool Eof() const override;
+
+    /**
+     * \brief Returns the absolute paths of all files that have been opened by this stream, including the base file and all included files.
+     */
+    _NODISCARD const std::vector<std::string>& GetOpenedFilePaths() const;
 };
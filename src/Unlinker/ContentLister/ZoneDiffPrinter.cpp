@@ -0,0 +1,54 @@
+#include "ZoneDiffPrinter.h"
+
+#include "Diffing/ZoneDiff.h"
+
+#include <format>
+#include <iostream>
+#include <utility>
+
+namespace
+{
+    const char* ChangePrefix(const DiffChange change)
+    {
+        switch (change)
+        {
+        case DiffChange::ADDED:
+            return "+";
+        case DiffChange::REMOVED:
+            return "-";
+        default:
+            return "~";
+        }
+    }
+} // namespace
+
+ZoneDiffPrinter::ZoneDiffPrinter(const Zone& oldZone, const Zone& newZone, std::function<bool(asset_type_t assetType)> compareContent)
+    : m_old_zone(oldZone),
+      m_new_zone(newZone),
+      m_compare_content(std::move(compareContent))
+{
+}
+
+void ZoneDiffPrinter::PrintDiff() const
+{
+    const auto* pools = m_new_zone.m_pools.get();
+    std::cout << std::format("Zone '{}' compared to '{}' ({})\n", m_new_zone.m_name, m_old_zone.m_name, m_new_zone.m_game->GetShortName());
+    std::cout << "Changes:\n";
+
+    const auto assetDiffs = ZoneDiff::Compare(m_old_zone, m_new_zone, m_compare_content);
+
+    size_t changeCounts[3]{};
+    for (const auto& assetDiff : assetDiffs)
+    {
+        std::cout << std::format("{} {}, {}\n", ChangePrefix(assetDiff.m_change), *pools->GetAssetTypeName(assetDiff.m_type), assetDiff.m_name);
+        for (const auto& field : assetDiff.m_fields)
+            std::cout << std::format("    {} {}\n", ChangePrefix(field.m_change), field.m_path);
+
+        changeCounts[static_cast<size_t>(assetDiff.m_change)]++;
+    }
+
+    std::cout << std::format("{} added, {} removed, {} modified assets\n\n",
+                             changeCounts[static_cast<size_t>(DiffChange::ADDED)],
+                             changeCounts[static_cast<size_t>(DiffChange::REMOVED)],
+                             changeCounts[static_cast<size_t>(DiffChange::MODIFIED)]);
+}
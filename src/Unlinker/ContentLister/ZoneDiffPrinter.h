@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Zone/Zone.h"
+
+#include <functional>
+
+class ZoneDiffPrinter
+{
+public:
+    ZoneDiffPrinter(const Zone& oldZone, const Zone& newZone, std::function<bool(asset_type_t assetType)> compareContent);
+
+    void PrintDiff() const;
+
+private:
+    const Zone& m_old_zone;
+    const Zone& m_new_zone;
+    std::function<bool(asset_type_t assetType)> m_compare_content;
+};
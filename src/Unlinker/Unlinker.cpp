@@ -2,10 +2,12 @@
 
 #include "ContentLister/ContentPrinter.h"
 #include "ContentLister/ZoneDefWriter.h"
+#include "ContentLister/ZoneDiffPrinter.h"
 #include "IObjLoader.h"
 #include "IObjWriter.h"
 #include "ObjWriting.h"
 #include "SearchPath/IWD.h"
+#include "SearchPath/OutputPathAsync.h"
 #include "SearchPath/OutputPathFilesystem.h"
 #include "SearchPath/SearchPathFilesystem.h"
 #include "SearchPath/SearchPaths.h"
@@ -13,12 +15,17 @@
 #include "UnlinkerPaths.h"
 #include "Utils/ClassUtils.h"
 #include "Utils/ObjFileStream.h"
+#include "Utils/ProcessMemory.h"
+#include "Utils/Tracing.h"
+#include "Utils/VirtualMemory.h"
+#include "Zone/ReferenceZoneCache.h"
 #include "ZoneLoading.h"
 
 #include <cassert>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <optional>
 #include <regex>
 #include <set>
 
@@ -46,16 +53,20 @@ public:
         if (!LoadZones(paths))
             return false;
 
-        const auto result = UnlinkZones(paths);
+        auto result = LoadZoneToDiffAgainst() && UnlinkZones(paths);
 
         UnloadZones();
+
+        if (!m_args.m_trace_file.empty() && !utils::WriteTraceFile(m_args.m_trace_file))
+            result = false;
+
         return result;
     }
 
 private:
     _NODISCARD bool ShouldLoadObj() const
     {
-        return m_args.m_task != UnlinkerArgs::ProcessingTask::LIST && !m_args.m_skip_obj;
+        return m_args.m_task == UnlinkerArgs::ProcessingTask::DUMP && !m_args.m_skip_obj;
     }
 
     bool WriteZoneDefinitionFile(const Zone& zone, const fs::path& zoneDefinitionFileFolder) const
@@ -99,6 +110,35 @@ private:
         return true;
     }
 
+    _NODISCARD bool ShouldHandleAssetType(const std::string& assetTypeName) const
+    {
+        if (m_args.m_specified_asset_type_map.contains(assetTypeName))
+            return m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::INCLUDE;
+
+        return m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::EXCLUDE;
+    }
+
+    /**
+     * \brief Checks whether an asset type of a zone to unlink only needs to be scanned instead of being fully loaded.
+     * Scanned assets can still be listed and compared by name but only their name is kept.
+     * \param zone The zone that is being loaded.
+     * \param assetType The asset type to check.
+     * \return \c true if assets of the type only need to be scanned, otherwise \c false
+     */
+    _NODISCARD bool ShouldOnlyScanAssetType(const Zone& zone, const asset_type_t assetType) const
+    {
+        if (m_args.m_task == UnlinkerArgs::ProcessingTask::LIST)
+            return true;
+
+        // Dumpers of handled asset types and zone definition writers read the content of the assets they reference,
+        // so only a diff, which compares references by name, can skip loading the content of asset types it does not handle
+        if (m_args.m_task != UnlinkerArgs::ProcessingTask::DIFF)
+            return false;
+
+        const auto assetTypeName = zone.m_pools->GetAssetTypeName(assetType);
+        return assetTypeName && !ShouldHandleAssetType(*assetTypeName);
+    }
+
     void UpdateAssetIncludesAndExcludes(const AssetDumpingContext& context) const
     {
         const auto assetTypeCount = context.m_zone.m_pools->GetAssetTypeCount();
@@ -110,15 +150,14 @@ private:
         {
             const auto assetTypeName = std::string(*context.m_zone.m_pools->GetAssetTypeName(i));
 
+            ObjWriting::Configuration.AssetTypesToHandleBitfield[i] = ShouldHandleAssetType(assetTypeName);
+
             const auto foundSpecifiedEntry = m_args.m_specified_asset_type_map.find(assetTypeName);
             if (foundSpecifiedEntry != m_args.m_specified_asset_type_map.end())
             {
-                ObjWriting::Configuration.AssetTypesToHandleBitfield[i] = m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::INCLUDE;
                 assert(foundSpecifiedEntry->second < handledSpecifiedAssets.size());
                 handledSpecifiedAssets[foundSpecifiedEntry->second] = true;
             }
-            else
-                ObjWriting::Configuration.AssetTypesToHandleBitfield[i] = m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::EXCLUDE;
         }
 
         auto anySpecifiedValueInvalid = false;
@@ -158,11 +197,29 @@ private:
      */
     bool HandleZone(ISearchPath& searchPath, Zone& zone) const
     {
+        const utils::TraceScope trace("unlink", "HandleZone", zone.m_name);
+
         if (m_args.m_task == UnlinkerArgs::ProcessingTask::LIST)
         {
             const ContentPrinter printer(zone);
             printer.PrintContent();
         }
+        else if (m_args.m_task == UnlinkerArgs::ProcessingTask::DIFF)
+        {
+            if (m_zone_to_diff_against->m_game != zone.m_game)
+            {
+                std::cerr << std::format("Cannot compare zone \"{}\" with zone \"{}\" of a different game.\n", zone.m_name, m_zone_to_diff_against->m_name);
+                return false;
+            }
+
+            const ZoneDiffPrinter printer(*m_zone_to_diff_against,
+                                          zone,
+                                          [this, &zone](const asset_type_t assetType)
+                                          {
+                                              return !ShouldOnlyScanAssetType(zone, assetType);
+                                          });
+            printer.PrintDiff();
+        }
         else if (m_args.m_task == UnlinkerArgs::ProcessingTask::DUMP)
         {
             const auto outputFolderPathStr = m_args.GetOutputFolderPathForZone(zone);
@@ -177,7 +234,8 @@ private:
                 return false;
 
             OutputPathFilesystem outputFolderOutputPath(outputFolderPath);
-            AssetDumpingContext context(zone, outputFolderPathStr, outputFolderOutputPath, searchPath);
+            OutputPathAsync asyncOutputPath(outputFolderOutputPath);
+            AssetDumpingContext context(zone, outputFolderPathStr, asyncOutputPath, searchPath);
 
             std::ofstream gdtStream;
             if (m_args.m_use_gdt)
@@ -202,6 +260,9 @@ private:
                 gdtStream.close();
             }
 
+            if (!asyncOutputPath.Flush())
+                result = false;
+
             if (!result)
             {
                 std::cerr << "Dumping zone failed!\n";
@@ -212,8 +273,64 @@ private:
         return true;
     }
 
+    std::unique_ptr<Zone> LoadReferenceZone(UnlinkerPaths& paths, const std::string& zonePath) const
+    {
+        auto absoluteZoneDirectory = absolute(std::filesystem::path(zonePath).remove_filename()).string();
+
+        auto searchPathsForZone = paths.GetSearchPathsForZone(absoluteZoneDirectory);
+        auto zone = ZoneLoading::LoadZone(zonePath);
+        if (zone == nullptr)
+        {
+            std::cerr << std::format("Failed to load zone \"{}\".\n", zonePath);
+            return nullptr;
+        }
+
+        if (m_args.m_verbose)
+            std::cout << std::format("Loaded zone \"{}\"\n", zone->m_name);
+
+        if (ShouldLoadObj())
+        {
+            const auto* objLoader = IObjLoader::GetObjLoaderForGame(zone->m_game->GetId());
+            objLoader->LoadReferencedContainersForZone(*searchPathsForZone, *zone);
+        }
+
+        return zone;
+    }
+
+    void UnloadReferenceZone(std::unique_ptr<Zone> zone) const
+    {
+        // Copy zone name since we deallocate before logging
+        const auto zoneName = zone->m_name;
+
+        if (ShouldLoadObj())
+        {
+            const auto* objLoader = IObjLoader::GetObjLoaderForGame(zone->m_game->GetId());
+            objLoader->UnloadContainersOfZone(*zone);
+        }
+
+        zone.reset();
+
+        if (m_args.m_verbose)
+            std::cout << std::format("Unloaded zone \"{}\"\n", zoneName);
+    }
+
     bool LoadZones(UnlinkerPaths& paths)
     {
+        m_reference_zones.emplace(
+            [this, &paths](const std::string& zonePath)
+            {
+                return LoadReferenceZone(paths, zonePath);
+            },
+            [this](std::unique_ptr<Zone> zone)
+            {
+                UnloadReferenceZone(std::move(zone));
+            },
+            [this](Zone& zone)
+            {
+                return ShouldLoadObj() && IObjLoader::GetObjLoaderForGame(zone.m_game->GetId())->HasContainersOfZone(zone);
+            });
+        m_reference_zones->SetMemoryBudget(m_args.m_memory_budget);
+
         for (const auto& zonePath : m_args.m_zones_to_load)
         {
             if (!fs::is_regular_file(zonePath))
@@ -222,55 +339,93 @@ private:
                 continue;
             }
 
-            auto absoluteZoneDirectory = absolute(std::filesystem::path(zonePath).remove_filename()).string();
-
-            auto searchPathsForZone = paths.GetSearchPathsForZone(absoluteZoneDirectory);
-            auto zone = ZoneLoading::LoadZone(zonePath);
-            if (zone == nullptr)
-            {
-                std::cerr << std::format("Failed to load zone \"{}\".\n", zonePath);
+            if (!m_reference_zones->AddZone(zonePath))
                 return false;
-            }
+        }
 
-            if (m_args.m_verbose)
-                std::cout << std::format("Loaded zone \"{}\"\n", zone->m_name);
+        ReportPeakMemoryUsage("loading zones");
 
-            if (ShouldLoadObj())
-            {
-                const auto* objLoader = IObjLoader::GetObjLoaderForGame(zone->m_game->GetId());
-                objLoader->LoadReferencedContainersForZone(*searchPathsForZone, *zone);
-            }
+        return true;
+    }
 
-            m_loaded_zones.emplace_back(std::move(zone));
+    /**
+     * \brief Loads the zone that all zones to unlink are compared against when diffing zones.
+     * Its asset types are loaded the same way as the ones of the zones to unlink so that their content can be compared.
+     * \return \c true if the zone is not needed or was loaded successfully, otherwise \c false
+     */
+    bool LoadZoneToDiffAgainst()
+    {
+        if (m_args.m_task != UnlinkerArgs::ProcessingTask::DIFF)
+            return true;
+
+        m_zone_to_diff_against = ZoneLoading::LoadZone(m_args.m_zone_to_diff_against,
+                                                       [this](const Zone& zoneToLoad, const asset_type_t assetType)
+                                                       {
+                                                           return ShouldOnlyScanAssetType(zoneToLoad, assetType);
+                                                       });
+        if (m_zone_to_diff_against == nullptr)
+        {
+            std::cerr << std::format("Failed to load zone \"{}\".\n", m_args.m_zone_to_diff_against);
+            return false;
         }
 
+        if (m_args.m_verbose)
+            std::cout << std::format("Loaded zone \"{}\" to compare against\n", m_zone_to_diff_against->m_name);
+
         return true;
     }
 
     void UnloadZones()
     {
-        for (auto i = m_loaded_zones.rbegin(); i != m_loaded_zones.rend(); ++i)
-        {
-            auto& loadedZone = *i;
+        m_zone_to_diff_against.reset();
 
-            // Copy zone name since we deallocate before logging
-            const auto zoneName = loadedZone->m_name;
+        if (!m_reference_zones)
+            return;
 
-            if (ShouldLoadObj())
-            {
-                const auto* objLoader = IObjLoader::GetObjLoaderForGame(loadedZone->m_game->GetId());
-                objLoader->UnloadContainersOfZone(*loadedZone);
-            }
+        if (m_args.m_memory_budget > 0 && m_args.m_verbose)
+            std::cout << std::format("Loaded referenced zones again {} times to stay within the memory budget\n", m_reference_zones->GetReloadCount());
 
-            loadedZone.reset();
+        m_reference_zones->UnloadAll();
+        m_reference_zones.reset();
+    }
 
-            if (m_args.m_verbose)
-                std::cout << std::format("Unloaded zone \"{}\"\n", zoneName);
+    /**
+     * \brief Prints the highest amount of physical memory used since the last report when running verbose or with a memory budget.
+     * \param phase A description of what has been done since the last report.
+     */
+    void ReportPeakMemoryUsage(const std::string& phase) const
+    {
+        if (!m_args.m_verbose && m_args.m_memory_budget == 0)
+            return;
+
+        const auto peakResidentSetSize = utils::GetPeakResidentSetSize();
+        if (peakResidentSetSize > 0)
+            std::cout << std::format("Peak resident set size while {}: {} MB\n", phase, peakResidentSetSize / (1024uz * 1024uz));
+
+        if (m_reference_zones)
+        {
+            std::cout << std::format("  {} referenced zones loaded using {} MB of zone memory\n",
+                                     m_reference_zones->GetLoadedZoneCount(),
+                                     m_reference_zones->GetResidentSize() / (1024uz * 1024uz));
         }
-        m_loaded_zones.clear();
+
+        utils::ResetPeakResidentSetSize();
     }
 
-    bool UnlinkZones(UnlinkerPaths& paths) const
+    static void PrintBlockMemoryUsage(const Zone& zone)
+    {
+        for (const auto& block : zone.GetMemory()->GetBlocks())
+        {
+            if (block->m_buffer_size == 0)
+                continue;
+
+            // Ask the system what is committed, since discarded temp blocks and untouched pages do not use any physical memory
+            const auto committedSize = utils::GetResidentVirtualMemorySize(block->m_buffer, block->m_buffer_size);
+            std::cout << std::format("  Block {}: {} of {} reserved bytes committed\n", block->m_name, committedSize, block->m_buffer_size);
+        }
+    }
+
+    bool UnlinkZones(UnlinkerPaths& paths)
     {
         for (const auto& zonePath : m_args.m_zones_to_unlink)
         {
@@ -285,10 +440,12 @@ private:
                 zoneDirectory = fs::current_path();
             auto absoluteZoneDirectory = absolute(zoneDirectory).string();
 
-            auto searchPathsForZone = paths.GetSearchPathsForZone(absoluteZoneDirectory);
-
             std::string zoneName;
-            auto zone = ZoneLoading::LoadZone(zonePath);
+            auto zone = ZoneLoading::LoadZone(zonePath,
+                                              [this](const Zone& zoneToLoad, const asset_type_t assetType)
+                                              {
+                                                  return ShouldOnlyScanAssetType(zoneToLoad, assetType);
+                                              });
             if (zone == nullptr)
             {
                 std::cerr << std::format("Failed to load zone \"{}\".\n", zonePath);
@@ -297,7 +454,17 @@ private:
 
             zoneName = zone->m_name;
             if (m_args.m_verbose)
+            {
                 std::cout << std::format("Loaded zone \"{}\"\n", zoneName);
+                PrintBlockMemoryUsage(*zone);
+            }
+
+            // Make sure all zones this zone references assets from are loaded before its containers are loaded
+            if (m_reference_zones && !m_reference_zones->PrepareForZone(*zone))
+                return false;
+
+            // Loading a reference zone again switches the search paths to its directory, so the search paths of this zone are only retrieved afterwards
+            auto searchPathsForZone = paths.GetSearchPathsForZone(absoluteZoneDirectory);
 
             const auto* objLoader = IObjLoader::GetObjLoaderForGame(zone->m_game->GetId());
             if (ShouldLoadObj())
@@ -312,13 +479,16 @@ private:
             zone.reset();
             if (m_args.m_verbose)
                 std::cout << std::format("Unloaded zone \"{}\"\n", zoneName);
+
+            ReportPeakMemoryUsage(std::format("unlinking zone \"{}\"", zoneName));
         }
 
         return true;
     }
 
     UnlinkerArgs m_args;
-    std::vector<std::unique_ptr<Zone>> m_loaded_zones;
+    std::optional<ReferenceZoneCache> m_reference_zones;
+    std::unique_ptr<Zone> m_zone_to_diff_against;
 };
 
 Unlinker::Unlinker()
@@ -6,7 +6,9 @@
 #include "Utils/Arguments/UsageInformation.h"
 #include "Utils/FileUtils.h"
 #include "Utils/StringUtils.h"
+#include "Utils/Tracing.h"
 
+#include <charconv>
 #include <format>
 #include <iostream>
 #include <regex>
@@ -49,12 +51,26 @@ const CommandLineOption* const OPTION_LOAD =
     .Reusable()
     .Build();
 
+const CommandLineOption* const OPTION_MEMORY_BUDGET =
+    CommandLineOption::Builder::Create()
+    .WithLongName("memory-budget")
+    .WithDescription("Limits the memory of zones loaded with --load to the specified amount of megabytes. Zones that are not referenced by the zone that is currently unlinked are unloaded and loaded again when needed.")
+    .WithParameter("megabytes")
+    .Build();
+
 const CommandLineOption* const OPTION_LIST =
     CommandLineOption::Builder::Create()
     .WithLongName("list")
     .WithDescription("Lists the contents of a zone instead of writing them to the disk.")
     .Build();
 
+const CommandLineOption* const OPTION_DIFF =
+    CommandLineOption::Builder::Create()
+    .WithLongName("diff")
+    .WithDescription("Compares the zones to unlink with the specified zone instead of writing them to the disk. Prints all added, removed and modified assets with the paths of all fields that changed.")
+    .WithParameter("zonePath")
+    .Build();
+
 const CommandLineOption* const OPTION_OUTPUT_FOLDER =
     CommandLineOption::Builder::Create()
     .WithShortName("o")
@@ -118,6 +134,13 @@ const CommandLineOption* const OPTION_LEGACY_MENUS =
     .WithDescription("Dumps menus with a compatibility mode to work with applications not compatible with the newer dumping mode.")
     .Build();
 
+const CommandLineOption* const OPTION_TRACE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("trace")
+    .WithDescription("Records the duration of loading, writing and dumping steps and writes them to a file in the Chrome trace event format.")
+    .WithParameter("traceFilePath")
+    .Build();
+
 // clang-format on
 
 const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
@@ -126,7 +149,9 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_VERBOSE,
     OPTION_MINIMAL_ZONE_FILE,
     OPTION_LOAD,
+    OPTION_MEMORY_BUDGET,
     OPTION_LIST,
+    OPTION_DIFF,
     OPTION_OUTPUT_FOLDER,
     OPTION_SEARCH_PATH,
     OPTION_IMAGE_FORMAT,
@@ -136,12 +161,14 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_EXCLUDE_ASSETS,
     OPTION_INCLUDE_ASSETS,
     OPTION_LEGACY_MENUS,
+    OPTION_TRACE,
 };
 
 UnlinkerArgs::UnlinkerArgs()
     : m_argument_parser(COMMAND_LINE_OPTIONS, std::extent_v<decltype(COMMAND_LINE_OPTIONS)>),
       m_zone_pattern(R"(\?zone\?)"),
       m_task(ProcessingTask::DUMP),
+      m_memory_budget(0uz),
       m_minimal_zone_def(false),
       m_asset_type_handling(AssetTypeHandling::EXCLUDE),
       m_skip_obj(false),
@@ -177,6 +204,23 @@ void UnlinkerArgs::SetVerbose(const bool isVerbose)
     ObjWriting::Configuration.Verbose = isVerbose;
 }
 
+bool UnlinkerArgs::SetMemoryBudget()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_MEMORY_BUDGET);
+
+    size_t megabytes = 0;
+    const auto* end = specifiedValue.data() + specifiedValue.size();
+    const auto [ptr, ec] = std::from_chars(specifiedValue.data(), end, megabytes);
+    if (ec != std::errc() || ptr != end || megabytes == 0)
+    {
+        std::cerr << std::format("Illegal value: \"{}\" is not a valid memory budget. Use -? to see usage information.\n", specifiedValue);
+        return false;
+    }
+
+    m_memory_budget = megabytes * 1024uz * 1024uz;
+    return true;
+}
+
 bool UnlinkerArgs::SetImageDumpingMode() const
 {
     auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_IMAGE_FORMAT);
@@ -311,10 +355,30 @@ bool UnlinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldCont
     if (m_argument_parser.IsOptionSpecified(OPTION_LOAD))
         m_zones_to_load = m_argument_parser.GetParametersForOption(OPTION_LOAD);
 
+    // --memory-budget
+    if (m_argument_parser.IsOptionSpecified(OPTION_MEMORY_BUDGET))
+    {
+        if (!SetMemoryBudget())
+            return false;
+    }
+
     // --list
+    // --diff
+    if (m_argument_parser.IsOptionSpecified(OPTION_LIST) && m_argument_parser.IsOptionSpecified(OPTION_DIFF))
+    {
+        std::cerr << "You can only either list or diff zones, not both\n";
+        return false;
+    }
+
     if (m_argument_parser.IsOptionSpecified(OPTION_LIST))
         m_task = ProcessingTask::LIST;
 
+    if (m_argument_parser.IsOptionSpecified(OPTION_DIFF))
+    {
+        m_task = ProcessingTask::DIFF;
+        m_zone_to_diff_against = m_argument_parser.GetValueForOption(OPTION_DIFF);
+    }
+
     // -o; --output-folder
     if (m_argument_parser.IsOptionSpecified(OPTION_OUTPUT_FOLDER))
         m_output_folder = m_argument_parser.GetValueForOption(OPTION_OUTPUT_FOLDER);
@@ -379,6 +443,13 @@ bool UnlinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldCont
     if (m_argument_parser.IsOptionSpecified(OPTION_LEGACY_MENUS))
         ObjWriting::Configuration.MenuLegacyMode = true;
 
+    // --trace
+    if (m_argument_parser.IsOptionSpecified(OPTION_TRACE))
+    {
+        m_trace_file = m_argument_parser.GetValueForOption(OPTION_TRACE);
+        utils::EnableTracing();
+    }
+
     return true;
 }
 
@@ -26,6 +26,7 @@ private:
     static void PrintVersion();
 
     void SetVerbose(bool isVerbose);
+    bool SetMemoryBudget();
     bool SetImageDumpingMode() const;
     bool SetModelDumpingMode() const;
 
@@ -36,7 +37,8 @@ public:
     enum class ProcessingTask
     {
         DUMP,
-        LIST
+        LIST,
+        DIFF
     };
 
     enum class AssetTypeHandling : std::uint8_t
@@ -47,9 +49,16 @@ public:
 
     std::vector<std::string> m_zones_to_load;
     std::vector<std::string> m_zones_to_unlink;
+
+    // The maximum amount of bytes of loaded zone memory or 0 for no limit
+    size_t m_memory_budget;
     std::set<std::string> m_user_search_paths;
 
     ProcessingTask m_task;
+
+    // The zone that zones to unlink are compared against when diffing
+    std::string m_zone_to_diff_against;
+
     std::string m_output_folder;
     bool m_minimal_zone_def;
 
@@ -62,6 +71,8 @@ public:
 
     bool m_verbose;
 
+    std::string m_trace_file;
+
     UnlinkerArgs();
     bool ParseArgs(int argc, const char** argv, bool& shouldContinue);
 
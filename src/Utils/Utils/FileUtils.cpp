@@ -1,7 +1,15 @@
 #include "FileUtils.h"
 
+#include <atomic>
+#include <format>
 #include <sstream>
 
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
 bool FileUtils::ParsePathsString(const std::string& pathsString, std::set<std::string>& output)
 {
     std::ostringstream currentPath;
@@ -61,3 +69,19 @@ bool FileUtils::ParsePathsString(const std::string& pathsString, std::set<std::s
 
     return true;
 }
+
+std::filesystem::path FileUtils::MakeTemporaryFilePath(const std::filesystem::path& filePath)
+{
+    static std::atomic_uint64_t temporaryFileCounter = 0u;
+
+#ifdef _WIN32
+    const auto processId = _getpid();
+#else
+    const auto processId = getpid();
+#endif
+
+    auto temporaryPath = filePath;
+    temporaryPath += std::format(".{}.{}.tmp", processId, temporaryFileCounter++);
+
+    return temporaryPath;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <filesystem>
 #include <set>
 #include <string>
 
@@ -19,4 +20,10 @@ public:
      * \return \c true if the user input was valid and could be processed successfully, otherwise \c false.
      */
     static bool ParsePathsString(const std::string& pathsString, std::set<std::string>& output);
+
+    /**
+     * \brief Creates a path next to the specified file to write its data to before renaming it to the actual file.
+     * The path is unique across all threads and processes, so concurrent writers never write into the same temporary file.
+     */
+    static std::filesystem::path MakeTemporaryFilePath(const std::filesystem::path& filePath);
 };
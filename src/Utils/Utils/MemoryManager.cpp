@@ -3,7 +3,10 @@
 #include <cstdlib>
 #include <cstring>
 
-MemoryManager::MemoryManager() = default;
+MemoryManager::MemoryManager()
+    : m_allocated_size(0uz)
+{
+}
 
 MemoryManager::~MemoryManager()
 {
@@ -11,12 +14,16 @@ MemoryManager::~MemoryManager()
         free(allocation);
 
     m_allocations.clear();
+    m_allocation_sizes.clear();
+    m_allocated_size = 0uz;
 }
 
 void* MemoryManager::AllocRaw(const size_t size)
 {
     void* result = calloc(size, 1u);
     m_allocations.push_back(result);
+    m_allocation_sizes.push_back(size);
+    m_allocated_size += size;
 
     return result;
 }
@@ -28,20 +35,30 @@ char* MemoryManager::Dup(const char* str)
 #else
     auto* result = strdup(str);
 #endif
+    const auto size = strlen(str) + 1u;
     m_allocations.push_back(result);
+    m_allocation_sizes.push_back(size);
+    m_allocated_size += size;
 
     return result;
 }
 
 void MemoryManager::Free(const void* data)
 {
-    for (auto iAlloc = m_allocations.begin(); iAlloc != m_allocations.end(); ++iAlloc)
+    for (auto i = 0uz; i < m_allocations.size(); i++)
     {
-        if (*iAlloc == data)
+        if (m_allocations[i] == data)
         {
-            free(*iAlloc);
-            m_allocations.erase(iAlloc);
+            free(m_allocations[i]);
+            m_allocated_size -= m_allocation_sizes[i];
+            m_allocations.erase(m_allocations.begin() + static_cast<std::ptrdiff_t>(i));
+            m_allocation_sizes.erase(m_allocation_sizes.begin() + static_cast<std::ptrdiff_t>(i));
             return;
         }
     }
 }
+
+std::size_t MemoryManager::GetAllocatedSize() const
+{
+    return m_allocated_size;
+}
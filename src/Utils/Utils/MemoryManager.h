@@ -24,6 +24,13 @@ public:
 
     void Free(const void* data);
 
+    /**
+     * \brief Returns the amount of bytes of all allocations that have not been freed yet.
+     */
+    [[nodiscard]] std::size_t GetAllocatedSize() const;
+
 protected:
     std::vector<void*> m_allocations;
+    std::vector<std::size_t> m_allocation_sizes;
+    std::size_t m_allocated_size;
 };
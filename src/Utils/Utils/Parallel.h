@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace utils
+{
+    namespace detail
+    {
+        // The amount of threads that are currently started by ParallelFor in addition to their calling threads
+        inline std::atomic_size_t additionalParallelWorkerCount = 0;
+    } // namespace detail
+
+    inline size_t GetParallelWorkerCount(const size_t taskCount)
+    {
+        const auto hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+        return std::min<size_t>(hardwareThreads, taskCount);
+    }
+
+    /**
+     * \brief Reserves up to the specified amount of additional worker threads without exceeding the amount of hardware threads in the whole process.
+     * \return The amount of reserved threads that must be released with \c ReleaseParallelWorkers.
+     */
+    inline size_t ReserveParallelWorkers(const size_t wantedWorkerCount)
+    {
+        const auto maxAdditionalWorkers = static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u) - 1u);
+
+        auto activeWorkers = detail::additionalParallelWorkerCount.load();
+        size_t reservedWorkers;
+        do
+        {
+            reservedWorkers = activeWorkers < maxAdditionalWorkers ? std::min(wantedWorkerCount, maxAdditionalWorkers - activeWorkers) : 0u;
+        } while (reservedWorkers > 0 && !detail::additionalParallelWorkerCount.compare_exchange_weak(activeWorkers, activeWorkers + reservedWorkers));
+
+        return reservedWorkers;
+    }
+
+    inline void ReleaseParallelWorkers(const size_t workerCount)
+    {
+        detail::additionalParallelWorkerCount -= workerCount;
+    }
+
+    /**
+     * \brief Calls the specified function for every index in [0, count) on a number of worker threads.
+     * Indices are handed out in ascending order but may complete in any order.
+     * The calling thread participates in the work and the function only returns when all indices have been processed.
+     * All calls share the hardware threads, so nested calls only start threads that outer calls left unused and run on their calling thread otherwise.
+     * \param count The amount of indices to process.
+     * \param func The function to call for each index. Must be safe to call concurrently.
+     */
+    template<typename Func> void ParallelFor(const size_t count, Func&& func)
+    {
+        const auto workerCount = GetParallelWorkerCount(count);
+        const auto additionalWorkerCount = workerCount > 1 ? ReserveParallelWorkers(workerCount - 1) : 0uz;
+        if (additionalWorkerCount == 0)
+        {
+            for (auto i = 0uz; i < count; i++)
+                func(i);
+            return;
+        }
+
+        std::atomic_size_t nextIndex = 0;
+        const auto work = [&nextIndex, count, &func]
+        {
+            for (auto i = nextIndex++; i < count; i = nextIndex++)
+                func(i);
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(additionalWorkerCount);
+        for (auto i = 0uz; i < additionalWorkerCount; i++)
+            threads.emplace_back(work);
+
+        work();
+
+        for (auto& thread : threads)
+            thread.join();
+
+        ReleaseParallelWorkers(additionalWorkerCount);
+    }
+} // namespace utils
@@ -0,0 +1,77 @@
+#include "ProcessMemory.h"
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include <psapi.h>
+#elif defined(__linux__)
+#include <fstream>
+#include <string>
+#endif
+
+namespace
+{
+#if defined(__linux__)
+    size_t ReadProcStatusValue(const std::string& key)
+    {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line))
+        {
+            if (!line.starts_with(key) || line.size() <= key.size() || line[key.size()] != ':')
+                continue;
+
+            // Values are specified in kB
+            return static_cast<size_t>(std::stoull(line.substr(key.size() + 1))) * 1024u;
+        }
+
+        return 0;
+    }
+#endif
+} // namespace
+
+namespace utils
+{
+    size_t GetResidentSetSize()
+    {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return counters.WorkingSetSize;
+        return 0;
+#elif defined(__linux__)
+        return ReadProcStatusValue("VmRSS");
+#else
+        return 0;
+#endif
+    }
+
+    size_t GetPeakResidentSetSize()
+    {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return counters.PeakWorkingSetSize;
+        return 0;
+#elif defined(__linux__)
+        return ReadProcStatusValue("VmHWM");
+#else
+        return 0;
+#endif
+    }
+
+    bool ResetPeakResidentSetSize()
+    {
+#if defined(__linux__)
+        // Writing 5 resets the peak resident set size of the process
+        std::ofstream clearRefs("/proc/self/clear_refs");
+        if (!clearRefs.is_open())
+            return false;
+
+        clearRefs << "5";
+        return static_cast<bool>(clearRefs.flush());
+#else
+        return false;
+#endif
+    }
+} // namespace utils
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+namespace utils
+{
+    /**
+     * \brief Returns the amount of physical memory currently used by the process in bytes or \c 0 if it cannot be determined.
+     */
+    size_t GetResidentSetSize();
+
+    /**
+     * \brief Returns the highest amount of physical memory used by the process since it started or since the last call to
+     * \c ResetPeakResidentSetSize in bytes or \c 0 if it cannot be determined.
+     */
+    size_t GetPeakResidentSetSize();
+
+    /**
+     * \brief Resets the peak resident set size to the current resident set size if the system supports it.
+     * \return \c true if the peak was reset, otherwise \c false
+     */
+    bool ResetPeakResidentSetSize();
+} // namespace utils
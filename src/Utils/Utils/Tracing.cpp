@@ -0,0 +1,218 @@
+#include "Tracing.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+namespace
+{
+    class TraceEvent
+    {
+    public:
+        const char* m_category;
+        std::string m_name;
+        std::string m_detail;
+        int64_t m_timestamp;
+        int64_t m_duration;
+        unsigned m_thread_id;
+    };
+
+    std::mutex traceMutex;
+    std::vector<TraceEvent> traceEvents;
+    std::chrono::steady_clock::time_point traceStart;
+    std::once_flag traceStartFlag;
+
+    std::atomic_uint nextTraceThreadId = 1;
+
+    unsigned GetTraceThreadId()
+    {
+        // Small sequential ids are easier to read in trace viewers than native thread ids
+        thread_local const auto threadId = nextTraceThreadId++;
+        return threadId;
+    }
+
+    int64_t ToMicroseconds(const std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    }
+
+    void WriteJsonString(std::ostream& stream, const std::string_view value)
+    {
+        stream << '"';
+        for (const auto c : value)
+        {
+            switch (c)
+            {
+            case '"':
+                stream << "\\\"";
+                break;
+            case '\\':
+                stream << "\\\\";
+                break;
+            case '\n':
+                stream << "\\n";
+                break;
+            case '\r':
+                stream << "\\r";
+                break;
+            case '\t':
+                stream << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    stream << std::format("\\u{:04x}", static_cast<unsigned>(c));
+                else
+                    stream << c;
+                break;
+            }
+        }
+        stream << '"';
+    }
+} // namespace
+
+namespace utils
+{
+    void EnableTracing()
+    {
+        std::call_once(traceStartFlag,
+                       []
+                       {
+                           traceStart = std::chrono::steady_clock::now();
+                       });
+
+        tracing_internal::enabled = true;
+    }
+
+    void WriteTraceEvents(std::ostream& stream)
+    {
+        std::lock_guard lock(traceMutex);
+
+        stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+        auto first = true;
+        for (const auto& event : traceEvents)
+        {
+            if (!first)
+                stream << ",";
+            first = false;
+
+            stream << "\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << event.m_thread_id << ",\"ts\":" << event.m_timestamp << ",\"dur\":" << event.m_duration
+                   << ",\"cat\":";
+            WriteJsonString(stream, event.m_category);
+            stream << ",\"name\":";
+            WriteJsonString(stream, event.m_name);
+
+            if (!event.m_detail.empty())
+            {
+                stream << ",\"args\":{\"detail\":";
+                WriteJsonString(stream, event.m_detail);
+                stream << "}";
+            }
+
+            stream << "}";
+        }
+
+        stream << "\n]}\n";
+    }
+
+    bool WriteTraceFile(const std::string& path)
+    {
+        std::ofstream stream(path, std::fstream::out | std::fstream::binary);
+        if (!stream.is_open())
+        {
+            std::cerr << std::format("Could not open trace file '{}'\n", path);
+            return false;
+        }
+
+        WriteTraceEvents(stream);
+
+        stream.close();
+        if (stream.fail())
+        {
+            std::cerr << std::format("Failed to write trace file '{}'\n", path);
+            return false;
+        }
+
+        return true;
+    }
+
+    std::string GetTraceTypeName(const std::type_info& type)
+    {
+#if defined(__GNUC__)
+        auto status = 0;
+        auto* demangledName = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+        if (status == 0 && demangledName != nullptr)
+        {
+            std::string result(demangledName);
+            std::free(demangledName);
+            return result;
+        }
+
+        return type.name();
+#else
+        // MSVC prefixes type names with the kind of type
+        std::string_view name(type.name());
+        for (const std::string_view prefix : {"class ", "struct "})
+        {
+            if (name.starts_with(prefix))
+            {
+                name.remove_prefix(prefix.size());
+                break;
+            }
+        }
+
+        return std::string(name);
+#endif
+    }
+
+    TraceScope::TraceScope(const char* category, const std::string_view name)
+        : m_active(IsTracingEnabled()),
+          m_category(category)
+    {
+        if (m_active)
+        {
+            m_name = name;
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    TraceScope::TraceScope(const char* category, const std::string_view name, const std::string_view detail)
+        : m_active(IsTracingEnabled()),
+          m_category(category)
+    {
+        if (m_active)
+        {
+            m_name = name;
+            m_detail = detail;
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    TraceScope::~TraceScope()
+    {
+        if (!m_active)
+            return;
+
+        const auto end = std::chrono::steady_clock::now();
+
+        TraceEvent event{
+            .m_category = m_category,
+            .m_name = std::move(m_name),
+            .m_detail = std::move(m_detail),
+            .m_timestamp = ToMicroseconds(m_start - traceStart),
+            .m_duration = ToMicroseconds(end - m_start),
+            .m_thread_id = GetTraceThreadId(),
+        };
+
+        std::lock_guard lock(traceMutex);
+        traceEvents.emplace_back(std::move(event));
+    }
+} // namespace utils
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+
+namespace utils
+{
+    namespace tracing_internal
+    {
+        inline std::atomic_bool enabled = false;
+    } // namespace tracing_internal
+
+    /**
+     * \brief Starts recording trace events for all threads.
+     * Timestamps of recorded events are relative to the first call of this function.
+     */
+    void EnableTracing();
+
+    inline bool IsTracingEnabled()
+    {
+        return tracing_internal::enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * \brief Writes all trace events recorded so far in the Chrome trace event format.
+     * The output can be viewed with chrome://tracing or https://ui.perfetto.dev.
+     * \param stream The stream to write the json document to.
+     */
+    void WriteTraceEvents(std::ostream& stream);
+
+    /**
+     * \brief Writes all trace events recorded so far to a file in the Chrome trace event format.
+     * \return \c true if the file could be written, otherwise \c false
+     */
+    bool WriteTraceFile(const std::string& path);
+
+    /**
+     * \brief Returns a human-readable name for a type to use as the name of a trace event.
+     */
+    std::string GetTraceTypeName(const std::type_info& type);
+
+    /**
+     * \brief Records the duration of its own lifetime as a trace event.
+     * When tracing is disabled, construction and destruction do not allocate or query the clock.
+     */
+    class TraceScope
+    {
+    public:
+        /**
+         * \param category The category of the event. Must be a string literal.
+         * \param name The name of the event.
+         */
+        TraceScope(const char* category, std::string_view name);
+
+        /**
+         * \param category The category of the event. Must be a string literal.
+         * \param name The name of the event.
+         * \param detail Additional information about the event like the name of an asset.
+         */
+        TraceScope(const char* category, std::string_view name, std::string_view detail);
+        ~TraceScope();
+
+        TraceScope(const TraceScope& other) = delete;
+        TraceScope(TraceScope&& other) noexcept = delete;
+        TraceScope& operator=(const TraceScope& other) = delete;
+        TraceScope& operator=(TraceScope&& other) noexcept = delete;
+
+    private:
+        bool m_active;
+        const char* m_category;
+        std::string m_name;
+        std::string m_detail;
+        std::chrono::steady_clock::time_point m_start;
+    };
+} // namespace utils
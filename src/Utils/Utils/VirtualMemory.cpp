@@ -0,0 +1,109 @@
+#include "VirtualMemory.h"
+
+#include <algorithm>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include <psapi.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#else
+#include <cstdlib>
+#endif
+
+namespace utils
+{
+    void* ReserveVirtualMemory(const size_t size)
+    {
+#ifdef _WIN32
+        return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#elif defined(__linux__)
+        // Do not reserve swap space either, pages are only accounted for once they are touched
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        return ptr != MAP_FAILED ? ptr : nullptr;
+#else
+        return std::calloc(size, 1);
+#endif
+    }
+
+    void DiscardVirtualMemory(void* ptr, const size_t size)
+    {
+        if (ptr == nullptr || size == 0)
+            return;
+
+#ifdef _WIN32
+        VirtualAlloc(ptr, size, MEM_RESET, PAGE_READWRITE);
+#elif defined(__linux__)
+        madvise(ptr, size, MADV_DONTNEED);
+#endif
+    }
+
+    void ReleaseVirtualMemory(void* ptr, const size_t size)
+    {
+        if (ptr == nullptr)
+            return;
+
+#ifdef _WIN32
+        VirtualFree(ptr, 0, MEM_RELEASE);
+#elif defined(__linux__)
+        munmap(ptr, size);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    size_t GetResidentVirtualMemorySize(const void* ptr, const size_t size)
+    {
+        if (ptr == nullptr || size == 0)
+            return 0;
+
+#ifdef _WIN32
+        SYSTEM_INFO systemInfo;
+        GetSystemInfo(&systemInfo);
+        const auto pageSize = static_cast<size_t>(systemInfo.dwPageSize);
+        const auto pageCount = (size + pageSize - 1u) / pageSize;
+
+        // Query the working set in chunks to not allocate an entry for every page of large ranges at once
+        constexpr auto MAX_PAGES_PER_QUERY = 4096uz;
+        std::vector<PSAPI_WORKING_SET_EX_INFORMATION> pageInfos(std::min(pageCount, MAX_PAGES_PER_QUERY));
+        auto residentPageCount = 0uz;
+        for (auto pageOffset = 0uz; pageOffset < pageCount; pageOffset += pageInfos.size())
+        {
+            const auto queryPageCount = std::min(pageCount - pageOffset, pageInfos.size());
+            for (auto i = 0uz; i < queryPageCount; i++)
+                pageInfos[i].VirtualAddress = const_cast<char*>(static_cast<const char*>(ptr)) + (pageOffset + i) * pageSize;
+
+            if (!QueryWorkingSetEx(GetCurrentProcess(), pageInfos.data(), static_cast<DWORD>(queryPageCount * sizeof(PSAPI_WORKING_SET_EX_INFORMATION))))
+                return size;
+
+            for (auto i = 0uz; i < queryPageCount; i++)
+            {
+                if (pageInfos[i].VirtualAttributes.Valid)
+                    residentPageCount++;
+            }
+        }
+
+        return std::min(residentPageCount * pageSize, size);
+#elif defined(__linux__)
+        const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const auto pageCount = (size + pageSize - 1u) / pageSize;
+
+        std::vector<unsigned char> pageResidency(pageCount);
+        if (mincore(const_cast<void*>(ptr), size, pageResidency.data()) != 0)
+            return size;
+
+        const auto residentPageCount = static_cast<size_t>(std::ranges::count_if(pageResidency,
+                                                                                 [](const unsigned char residency)
+                                                                                 {
+                                                                                     return (residency & 1u) != 0u;
+                                                                                 }));
+
+        return std::min(residentPageCount * pageSize, size);
+#else
+        return size;
+#endif
+    }
+} // namespace utils
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+
+namespace utils
+{
+    /**
+     * \brief Reserves a zero-initialized, readable and writable range of memory.
+     * Physical memory is only committed by the system once a page is accessed for the first time.
+     * \param size The size of the memory range in bytes.
+     * \return The start of the memory range or \c nullptr if it could not be reserved.
+     */
+    void* ReserveVirtualMemory(size_t size);
+
+    /**
+     * \brief Returns the physical memory of a memory range to the system.
+     * The range stays accessible but its content is undefined afterwards.
+     */
+    void DiscardVirtualMemory(void* ptr, size_t size);
+
+    void ReleaseVirtualMemory(void* ptr, size_t size);
+
+    /**
+     * \brief Determines how much of a memory range is currently backed by physical memory.
+     * \return The amount of resident bytes or \c size if the system cannot tell.
+     */
+    size_t GetResidentVirtualMemorySize(const void* ptr, size_t size);
+} // namespace utils
@@ -14,6 +14,10 @@ function ZoneCodeGeneratorLib:link(links)
 	links:add(self:name())
 	links:linkto(Parser)
 	links:linkto(Utils)
+
+    if os.host() == "linux" then
+		links:add("pthread")
+	end
 end
 
 function ZoneCodeGeneratorLib:use()
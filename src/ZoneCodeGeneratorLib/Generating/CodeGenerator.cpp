@@ -2,16 +2,31 @@
 
 #include "Domain/Computations/StructureComputations.h"
 #include "Templates/AssetStructTestsTemplate.h"
+#include "Templates/ZoneDiffTemplate.h"
 #include "Templates/ZoneLoadTemplate.h"
 #include "Templates/ZoneMarkTemplate.h"
 #include "Templates/ZoneWriteTemplate.h"
+#include "Utils/Parallel.h"
 
+#include <chrono>
 #include <filesystem>
+#include <format>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 namespace fs = std::filesystem;
 
+CodeGenerator::RenderJob::RenderJob(const IDataRepository* repository, StructureInformation* asset, ICodeTemplate* codeTemplate, std::string templateName)
+    : m_repository(repository),
+      m_asset(asset),
+      m_template(codeTemplate),
+      m_template_name(std::move(templateName)),
+      m_success(false),
+      m_written_file_count(0u)
+{
+}
+
 CodeGenerator::CodeGenerator(const ZoneCodeGeneratorArguments* args)
     : m_args(args)
 {
@@ -23,34 +38,71 @@ void CodeGenerator::SetupTemplates()
     m_template_mapping["zoneload"] = std::make_unique<ZoneLoadTemplate>();
     m_template_mapping["zonemark"] = std::make_unique<ZoneMarkTemplate>();
     m_template_mapping["zonewrite"] = std::make_unique<ZoneWriteTemplate>();
+    m_template_mapping["zonediff"] = std::make_unique<ZoneDiffTemplate>();
     m_template_mapping["assetstructtests"] = std::make_unique<AssetStructTestsTemplate>();
 }
 
-bool CodeGenerator::GenerateCodeForTemplate(RenderingContext* context, ICodeTemplate* codeTemplate) const
+bool CodeGenerator::WriteFileIfChanged(const std::string& path, const std::string& content, bool& written)
+{
+    written = false;
+
+    // Only touch files that actually change to not trigger rebuilds of everything that includes them
+    std::error_code ec;
+    if (fs::file_size(path, ec) == content.size() && !ec)
+    {
+        std::ifstream existingStream(path, std::fstream::in | std::fstream::binary);
+        if (existingStream.is_open())
+        {
+            std::string existingContent(content.size(), '\0');
+            existingStream.read(existingContent.data(), static_cast<std::streamsize>(existingContent.size()));
+            if (existingStream.gcount() == static_cast<std::streamsize>(content.size()) && existingContent == content)
+                return true;
+        }
+    }
+
+    std::ofstream stream(path, std::fstream::out | std::fstream::binary);
+    if (!stream.is_open())
+    {
+        std::cout << std::format("Failed to open file '{}'\n", path);
+        return false;
+    }
+
+    stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+    stream.close();
+
+    written = true;
+    return true;
+}
+
+void CodeGenerator::ExecuteRenderJob(RenderJob& job) const
 {
-    for (const auto& codeFile : codeTemplate->GetFilesToRender(context))
+    const auto context = RenderingContext::BuildContext(job.m_repository, job.m_asset);
+
+    for (const auto& codeFile : job.m_template->GetFilesToRender(context.get()))
     {
         fs::path p(m_args->m_output_directory);
         p.append(codeFile.m_file_name);
 
         auto parentFolder(p);
         parentFolder.remove_filename();
-        create_directories(parentFolder);
 
-        std::ofstream stream(p, std::fstream::out | std::fstream::binary);
+        // Other jobs may create the same folder concurrently, failing to open the file will be reported anyway
+        std::error_code ec;
+        create_directories(parentFolder, ec);
 
-        if (!stream.is_open())
-        {
-            std::cout << "Failed to open file '" << p.string() << "'\n";
-            return false;
-        }
+        std::ostringstream stream;
+        job.m_template->RenderFile(stream, codeFile.m_tag, context.get());
 
-        codeTemplate->RenderFile(stream, codeFile.m_tag, context);
+        bool written;
+        if (!WriteFileIfChanged(p.string(), stream.str(), written))
+            return;
 
-        stream.close();
+        job.m_generated_files.emplace_back(p.string());
+        if (written)
+            job.m_written_file_count++;
     }
 
-    return true;
+    job.m_success = true;
 }
 
 bool CodeGenerator::GetAssetWithName(IDataRepository* repository, const std::string& name, StructureInformation*& asset)
@@ -76,10 +128,11 @@ bool CodeGenerator::GetAssetWithName(IDataRepository* repository, const std::str
         return false;
     }
 
+    asset = info;
     return true;
 }
 
-bool CodeGenerator::GenerateCode(IDataRepository* repository)
+bool CodeGenerator::CreateRenderJobs(IDataRepository* repository, std::vector<RenderJob>& jobs) const
 {
     std::vector<StructureInformation*> assets;
 
@@ -90,7 +143,6 @@ bool CodeGenerator::GenerateCode(IDataRepository* repository)
             assets.push_back(info);
     }
 
-    const auto start = std::chrono::steady_clock::now();
     for (const auto& generationTask : m_args->m_generation_tasks)
     {
         auto templateName = generationTask.m_template_name;
@@ -107,18 +159,7 @@ bool CodeGenerator::GenerateCode(IDataRepository* repository)
         if (generationTask.m_all_assets)
         {
             for (auto* asset : assets)
-            {
-                auto context = RenderingContext::BuildContext(repository, asset);
-                if (!GenerateCodeForTemplate(context.get(), foundTemplate->second.get()))
-                {
-                    std::cout << "Failed to generate code for asset '" << asset->m_definition->GetFullName() << "' with preset '" << foundTemplate->first
-                              << "'\n";
-                    return false;
-                }
-
-                std::cout << "Successfully generated code for asset '" << asset->m_definition->GetFullName() << "' with preset '" << foundTemplate->first
-                          << "'\n";
-            }
+                jobs.emplace_back(repository, asset, foundTemplate->second.get(), foundTemplate->first);
         }
         else
         {
@@ -126,12 +167,53 @@ bool CodeGenerator::GenerateCode(IDataRepository* repository)
             if (!GetAssetWithName(repository, generationTask.m_asset_name, asset))
                 return false;
 
-            auto context = RenderingContext::BuildContext(repository, asset);
-            if (!GenerateCodeForTemplate(context.get(), foundTemplate->second.get()))
-                return false;
+            jobs.emplace_back(repository, asset, foundTemplate->second.get(), foundTemplate->first);
         }
     }
+
+    return true;
+}
+
+bool CodeGenerator::GenerateCode(IDataRepository* repository)
+{
+    std::vector<RenderJob> jobs;
+    if (!CreateRenderJobs(repository, jobs))
+        return false;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // Rendering only reads from the repository, so all asset/template combinations can be rendered independently
+    utils::ParallelFor(jobs.size(),
+                       [this, &jobs](const size_t jobIndex)
+                       {
+                           ExecuteRenderJob(jobs[jobIndex]);
+                       });
+
+    auto writtenFileCount = 0u;
+    for (const auto& job : jobs)
+    {
+        if (!job.m_success)
+        {
+            std::cout << std::format("Failed to generate code for asset '{}' with preset '{}'\n", job.m_asset->m_definition->GetFullName(), job.m_template_name);
+            return false;
+        }
+
+        if (m_args->m_verbose)
+        {
+            std::cout << std::format("Successfully generated code for asset '{}' with preset '{}' ({} of {} files changed)\n",
+                                     job.m_asset->m_definition->GetFullName(),
+                                     job.m_template_name,
+                                     job.m_written_file_count,
+                                     job.m_generated_files.size());
+        }
+
+        writtenFileCount += job.m_written_file_count;
+        m_generated_files.insert(m_generated_files.end(), job.m_generated_files.begin(), job.m_generated_files.end());
+    }
+
     const auto end = std::chrono::steady_clock::now();
+    std::cout << std::format("Generated {} files, {} changed\n", m_generated_files.size(), writtenFileCount);
+
     if (m_args->m_verbose)
     {
         std::cout << "Generating code took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
@@ -139,3 +221,8 @@ bool CodeGenerator::GenerateCode(IDataRepository* repository)
 
     return true;
 }
+
+const std::vector<std::string>& CodeGenerator::GetGeneratedFiles() const
+{
+    return m_generated_files;
+}
@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 class CodeGenerator
 {
@@ -14,13 +15,33 @@ public:
 
     bool GenerateCode(IDataRepository* repository);
 
+    [[nodiscard]] const std::vector<std::string>& GetGeneratedFiles() const;
+
 private:
+    class RenderJob
+    {
+    public:
+        const IDataRepository* m_repository;
+        StructureInformation* m_asset;
+        ICodeTemplate* m_template;
+        std::string m_template_name;
+
+        bool m_success;
+        std::vector<std::string> m_generated_files;
+        unsigned m_written_file_count;
+
+        RenderJob(const IDataRepository* repository, StructureInformation* asset, ICodeTemplate* codeTemplate, std::string templateName);
+    };
+
     void SetupTemplates();
 
-    bool GenerateCodeForTemplate(RenderingContext* context, ICodeTemplate* codeTemplate) const;
+    bool CreateRenderJobs(IDataRepository* repository, std::vector<RenderJob>& jobs) const;
+    void ExecuteRenderJob(RenderJob& job) const;
+    static bool WriteFileIfChanged(const std::string& path, const std::string& content, bool& written);
     static bool GetAssetWithName(IDataRepository* repository, const std::string& name, StructureInformation*& asset);
 
     const ZoneCodeGeneratorArguments* m_args;
 
     std::unordered_map<std::string, std::unique_ptr<ICodeTemplate>> m_template_mapping;
+    std::vector<std::string> m_generated_files;
 };
@@ -0,0 +1,169 @@
+#include "GenerationManifest.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr auto MANIFEST_VERSION = 1u;
+    constexpr auto KEY_VERSION = "version ";
+    constexpr auto KEY_CONFIGURATION = "config ";
+    constexpr auto KEY_INPUT = "input ";
+    constexpr auto KEY_OUTPUT = "output ";
+
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+} // namespace
+
+GenerationManifest::InputFile::InputFile(std::string path, const uint64_t hash)
+    : m_path(std::move(path)),
+      m_hash(hash)
+{
+}
+
+GenerationManifest::GenerationManifest(std::string configuration)
+    : m_configuration(std::move(configuration))
+{
+}
+
+bool GenerationManifest::HashFile(const std::string& path, uint64_t& hash)
+{
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+    if (!stream.is_open())
+        return false;
+
+    hash = FNV_OFFSET_BASIS;
+
+    char buffer[0x4000];
+    while (stream)
+    {
+        stream.read(buffer, sizeof(buffer));
+        const auto readCount = stream.gcount();
+        for (auto i = 0; i < readCount; i++)
+        {
+            hash ^= static_cast<uint8_t>(buffer[i]);
+            hash *= FNV_PRIME;
+        }
+    }
+
+    return true;
+}
+
+bool GenerationManifest::AddInputFile(const std::string& path)
+{
+    const auto alreadyAdded = std::ranges::any_of(m_input_files,
+                                                  [&path](const InputFile& inputFile)
+                                                  {
+                                                      return inputFile.m_path == path;
+                                                  });
+    if (alreadyAdded)
+        return true;
+
+    uint64_t hash;
+    if (!HashFile(path, hash))
+        return false;
+
+    m_input_files.emplace_back(path, hash);
+    return true;
+}
+
+void GenerationManifest::AddOutputFile(const std::string& path)
+{
+    m_output_files.emplace_back(path);
+}
+
+bool GenerationManifest::ReadFromFile(const std::string& path)
+{
+    std::ifstream stream(path, std::ios::in);
+    if (!stream.is_open())
+        return false;
+
+    std::string line;
+    if (!std::getline(stream, line) || line != std::format("{}{}", KEY_VERSION, MANIFEST_VERSION))
+        return false;
+
+    m_configuration.clear();
+    m_input_files.clear();
+    m_output_files.clear();
+
+    while (std::getline(stream, line))
+    {
+        if (line.starts_with(KEY_CONFIGURATION))
+        {
+            m_configuration = line.substr(std::char_traits<char>::length(KEY_CONFIGURATION));
+        }
+        else if (line.starts_with(KEY_INPUT))
+        {
+            // input <hash> <path>
+            const auto hashStart = std::char_traits<char>::length(KEY_INPUT);
+            const auto hashEnd = line.find(' ', hashStart);
+            if (hashEnd == std::string::npos)
+                return false;
+
+            uint64_t hash;
+            try
+            {
+                hash = std::stoull(line.substr(hashStart, hashEnd - hashStart), nullptr, 16);
+            }
+            catch (const std::exception&)
+            {
+                return false;
+            }
+
+            m_input_files.emplace_back(line.substr(hashEnd + 1), hash);
+        }
+        else if (line.starts_with(KEY_OUTPUT))
+        {
+            m_output_files.emplace_back(line.substr(std::char_traits<char>::length(KEY_OUTPUT)));
+        }
+        else if (!line.empty())
+            return false;
+    }
+
+    return true;
+}
+
+bool GenerationManifest::WriteToFile(const std::string& path) const
+{
+    const auto parentFolder = fs::path(path).parent_path();
+    if (!parentFolder.empty())
+        create_directories(parentFolder);
+
+    std::ofstream stream(path, std::ios::out | std::ios::trunc);
+    if (!stream.is_open())
+        return false;
+
+    stream << std::format("{}{}\n", KEY_VERSION, MANIFEST_VERSION);
+    stream << std::format("{}{}\n", KEY_CONFIGURATION, m_configuration);
+
+    for (const auto& inputFile : m_input_files)
+        stream << std::format("{}{:x} {}\n", KEY_INPUT, inputFile.m_hash, inputFile.m_path);
+
+    for (const auto& outputFile : m_output_files)
+        stream << std::format("{}{}\n", KEY_OUTPUT, outputFile);
+
+    return stream.good();
+}
+
+bool GenerationManifest::IsUpToDate(const std::string& configuration) const
+{
+    if (m_configuration != configuration || m_input_files.empty())
+        return false;
+
+    for (const auto& inputFile : m_input_files)
+    {
+        uint64_t hash;
+        if (!HashFile(inputFile.m_path, hash) || hash != inputFile.m_hash)
+            return false;
+    }
+
+    return std::ranges::all_of(m_output_files,
+                               [](const std::string& outputFile)
+                               {
+                                   return fs::is_regular_file(outputFile);
+                               });
+}
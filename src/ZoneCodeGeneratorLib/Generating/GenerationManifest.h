@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Records the inputs and outputs of a code generation run.
+ * When none of the inputs changed since the last run, generation can be skipped entirely.
+ */
+class GenerationManifest
+{
+public:
+    class InputFile
+    {
+    public:
+        std::string m_path;
+        uint64_t m_hash;
+
+        InputFile(std::string path, uint64_t hash);
+    };
+
+    explicit GenerationManifest(std::string configuration);
+
+    bool AddInputFile(const std::string& path);
+    void AddOutputFile(const std::string& path);
+
+    bool ReadFromFile(const std::string& path);
+    bool WriteToFile(const std::string& path) const;
+
+    /**
+     * \brief Checks whether this manifest was created with the specified configuration,
+     * all recorded input files still have the same content and all recorded output files still exist.
+     */
+    [[nodiscard]] bool IsUpToDate(const std::string& configuration) const;
+
+private:
+    static bool HashFile(const std::string& path, uint64_t& hash);
+
+    std::string m_configuration;
+    std::vector<InputFile> m_input_files;
+    std::vector<std::string> m_output_files;
+};
@@ -0,0 +1,987 @@
+#include "ZoneDiffTemplate.h"
+
+#include "Domain/Computations/MemberComputations.h"
+#include "Domain/Computations/StructureComputations.h"
+#include "Internal/BaseTemplate.h"
+#include "Utils/StringUtils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+    constexpr int TAG_HEADER = 1;
+    constexpr int TAG_SOURCE = 2;
+
+    class Template final : BaseTemplate
+    {
+    public:
+        Template(std::ostream& stream, RenderingContext* context)
+            : BaseTemplate(stream, context)
+        {
+        }
+
+        void Header()
+        {
+            LINE("// ====================================================================")
+            LINE("// This file has been generated by ZoneCodeGenerator.")
+            LINE("// Do not modify.")
+            LINE("// Any changes will be discarded when regenerating.")
+            LINE("// ====================================================================")
+            LINE("")
+            LINE("#pragma once")
+            LINE("")
+            LINE("#include \"Diffing/AssetDiffRecorder.h\"")
+            LINEF("#include \"Game/{0}/{0}.h\"", m_env.m_game)
+            LINE("")
+            LINE("#include <string>")
+            LINE("")
+            LINEF("namespace {0}", m_env.m_game)
+            LINE("{")
+            m_intendation++;
+            LINEF("class {0} final : public AssetDiffRecorder", RecorderClassName(m_env.m_asset))
+            LINE("{")
+            m_intendation++;
+
+            LINE(VariableDecl(m_env.m_asset->m_definition))
+            LINE(PointerVariableDecl(m_env.m_asset->m_definition))
+            LINE("")
+
+            // Variable Declarations: type varType;
+            for (const auto* type : m_env.m_used_types)
+            {
+                if (type->m_info && !type->m_info->m_definition->m_anonymous && !type->m_info->m_is_leaf && !StructureComputations(type->m_info).IsAsset())
+                {
+                    LINE(VariableDecl(type->m_type))
+                }
+            }
+            for (const auto* type : m_env.m_used_types)
+            {
+                if (type->m_pointer_array_reference_exists && !type->m_is_context_asset)
+                {
+                    LINE(PointerVariableDecl(type->m_type))
+                }
+            }
+
+            LINE("")
+
+            // Method Declarations
+            for (const auto* type : m_env.m_used_types)
+            {
+                if (type->m_pointer_array_reference_exists)
+                {
+                    PrintHeaderPtrArrayRecordMethodDeclaration(type->m_type);
+                }
+            }
+            for (const auto* type : m_env.m_used_types)
+            {
+                if (type->m_array_reference_exists && type->m_info && !type->m_info->m_is_leaf && type->m_non_runtime_reference_exists)
+                {
+                    PrintHeaderArrayRecordMethodDeclaration(type->m_type);
+                }
+            }
+            for (const auto* type : m_env.m_used_structures)
+            {
+                if (type->m_non_runtime_reference_exists && !type->m_info->m_is_leaf && !StructureComputations(type->m_info).IsAsset())
+                {
+                    PrintHeaderRecordMethodDeclaration(type->m_info);
+                }
+            }
+            PrintHeaderRecordMethodDeclaration(m_env.m_asset);
+            LINE("")
+            m_intendation--;
+            LINE("public:")
+            m_intendation++;
+            PrintHeaderConstructor();
+            PrintHeaderMainRecordMethodDeclaration(m_env.m_asset);
+            PrintHeaderGetNameMethodDeclaration(m_env.m_asset);
+
+            m_intendation--;
+            LINE("};")
+            m_intendation--;
+            LINE("}")
+        }
+
+        void Source()
+        {
+            LINE("// ====================================================================")
+            LINE("// This file has been generated by ZoneCodeGenerator.")
+            LINE("// Do not modify.")
+            LINE("// Any changes will be discarded when regenerating.")
+            LINE("// ====================================================================")
+            LINE("")
+            LINEF("#include \"{0}_diff_db.h\"", Lower(m_env.m_asset->m_definition->m_name))
+            LINE("")
+            LINE("#include <cassert>")
+            LINE("#include <cstdint>")
+            LINE("")
+
+            if (!m_env.m_referenced_assets.empty())
+            {
+                LINE("// Referenced Assets:")
+                for (const auto* type : m_env.m_referenced_assets)
+                {
+                    LINEF("#include \"../{0}/{0}_diff_db.h\"", Lower(type->m_type->m_name))
+                }
+                LINE("")
+            }
+            LINEF("using namespace {0};", m_env.m_game)
+            LINE("")
+            PrintConstructorMethod();
+
+            for (const auto* type : m_env.m_used_types)
+            {
+                if (type->m_pointer_array_reference_exists)
+                {
+                    LINE("")
+                    PrintRecordPtrArrayMethod(type->m_type, type->m_info);
+                }
+            }
+            for (const auto* type : m_env.m_used_types)
+            {
+                if (type->m_array_reference_exists && type->m_info && !type->m_info->m_is_leaf && type->m_non_runtime_reference_exists)
+                {
+                    LINE("")
+                    PrintRecordArrayMethod(type->m_type, type->m_info);
+                }
+            }
+            for (const auto* type : m_env.m_used_structures)
+            {
+                if (type->m_non_runtime_reference_exists && !type->m_info->m_is_leaf && !StructureComputations(type->m_info).IsAsset())
+                {
+                    LINE("")
+                    PrintRecordMethod(type->m_info);
+                }
+            }
+            LINE("")
+            PrintRecordMethod(m_env.m_asset);
+            LINE("")
+            PrintMainRecordMethod();
+            LINE("")
+            PrintGetNameMethod();
+        }
+
+    private:
+        enum class MemberLoadType : std::uint8_t
+        {
+            ARRAY_POINTER,
+            DYNAMIC_ARRAY,
+            EMBEDDED,
+            EMBEDDED_ARRAY,
+            POINTER_ARRAY,
+            SINGLE_POINTER
+        };
+
+        static std::string RecorderClassName(const StructureInformation* asset)
+        {
+            return std::format("DiffRecorder_{0}", asset->m_definition->m_name);
+        }
+
+        static std::string VariableDecl(const DataDefinition* def)
+        {
+            return std::format("{0}* var{1};", def->GetFullName(), MakeSafeTypeName(def));
+        }
+
+        static std::string PointerVariableDecl(const DataDefinition* def)
+        {
+            return std::format("{0}** var{1}Ptr;", def->GetFullName(), MakeSafeTypeName(def));
+        }
+
+        static std::string MakePathName(const MemberInformation* member, const DeclarationModifierComputations& modifier)
+        {
+            return std::format("\"{0}{1}\"", member->m_member->m_name, MakeArrayIndices(modifier));
+        }
+
+        static bool HasPointerModifier(const MemberInformation* member)
+        {
+            const auto& declarationModifiers = member->m_member->m_type_declaration->m_declaration_modifiers;
+            return std::ranges::any_of(declarationModifiers,
+                                       [](const std::unique_ptr<DeclarationModifier>& modifier)
+                                       {
+                                           return modifier->GetType() == DeclarationModifierType::POINTER;
+                                       });
+        }
+
+        void PrintHeaderPtrArrayRecordMethodDeclaration(const DataDefinition* def) const
+        {
+            LINEF("void RecordPtrArray_{0}(size_t count);", MakeSafeTypeName(def))
+        }
+
+        void PrintHeaderArrayRecordMethodDeclaration(const DataDefinition* def) const
+        {
+            LINEF("void RecordArray_{0}(size_t count);", MakeSafeTypeName(def))
+        }
+
+        void PrintHeaderRecordMethodDeclaration(const StructureInformation* info) const
+        {
+            LINEF("void Record_{0}();", MakeSafeTypeName(info->m_definition))
+        }
+
+        void PrintHeaderGetNameMethodDeclaration(const StructureInformation* info) const
+        {
+            LINEF("static std::string GetAssetName({0}* pAsset);", info->m_definition->GetFullName())
+        }
+
+        void PrintHeaderConstructor() const
+        {
+            LINEF("explicit {0}(const Zone* zone);", RecorderClassName(m_env.m_asset))
+        }
+
+        void PrintHeaderMainRecordMethodDeclaration(const StructureInformation* info) const
+        {
+            LINEF("void Record({0}* pAsset);", info->m_definition->GetFullName())
+        }
+
+        void PrintVariableInitialization(const DataDefinition* def) const
+        {
+            LINEF("var{0} = nullptr;", def->m_name)
+        }
+
+        void PrintPointerVariableInitialization(const DataDefinition* def) const
+        {
+            LINEF("var{0}Ptr = nullptr;", def->m_name)
+        }
+
+        void PrintConstructorMethod()
+        {
+            LINEF("{0}::{0}(const Zone* zone)", RecorderClassName(m_env.m_asset))
+
+            m_intendation++;
+            LINE(": AssetDiffRecorder(zone)")
+            m_intendation--;
+
+            LINE("{")
+            m_intendation++;
+
+            PrintVariableInitialization(m_env.m_asset->m_definition);
+            PrintPointerVariableInitialization(m_env.m_asset->m_definition);
+            LINE("")
+
+            for (const auto* type : m_env.m_used_types)
+            {
+                if (type->m_info && !type->m_info->m_definition->m_anonymous && !type->m_info->m_is_leaf && !StructureComputations(type->m_info).IsAsset())
+                {
+                    PrintVariableInitialization(type->m_type);
+                }
+            }
+            for (const auto* type : m_env.m_used_types)
+            {
+                if (type->m_pointer_array_reference_exists && !type->m_is_context_asset)
+                {
+                    PrintPointerVariableInitialization(type->m_type);
+                }
+            }
+
+            m_intendation--;
+            LINE("}")
+        }
+
+        void PrintRecordPtrArrayMethod_PointerCheck(const DataDefinition* def, const StructureInformation* info)
+        {
+            LINEF("if (*{0})", MakeTypePtrVarName(def))
+            LINE("{")
+            m_intendation++;
+
+            if (info && StructureComputations(info).IsAsset())
+            {
+                LINEF("Record_AssetName(nullptr, {0}::GetAssetName(*{1}));", RecorderClassName(info), MakeTypePtrVarName(def))
+            }
+            else if (info && !info->m_is_leaf)
+            {
+                LINEF("{0} = *{1};", MakeTypeVarName(info->m_definition), MakeTypePtrVarName(def))
+                LINEF("Record_{0}();", MakeSafeTypeName(def))
+            }
+            else
+            {
+                LINEF("Record_Data(nullptr, *{0}, sizeof({1}));", MakeTypePtrVarName(def), def->GetFullName())
+            }
+
+            m_intendation--;
+            LINE("}")
+        }
+
+        void PrintRecordPtrArrayMethod(const DataDefinition* def, const StructureInformation* info)
+        {
+            LINEF("void {0}::RecordPtrArray_{1}(const size_t count)", RecorderClassName(m_env.m_asset), MakeSafeTypeName(def))
+            LINE("{")
+            m_intendation++;
+
+            LINEF("assert({0} != nullptr);", MakeTypePtrVarName(def))
+            LINE("")
+
+            LINEF("{0}** var = {1};", def->GetFullName(), MakeTypePtrVarName(def))
+            LINE("for (size_t index = 0; index < count; index++)")
+            LINE("{")
+            m_intendation++;
+
+            LINE("PushIndex(index);")
+            LINEF("{0} = var;", MakeTypePtrVarName(def))
+            PrintRecordPtrArrayMethod_PointerCheck(def, info);
+            LINE("PopPath();")
+            LINE("")
+            LINE("var++;")
+
+            m_intendation--;
+            LINE("}")
+            m_intendation--;
+            LINE("}")
+        }
+
+        void PrintRecordArrayMethod(const DataDefinition* def, const StructureInformation* info)
+        {
+            LINEF("void {0}::RecordArray_{1}(const size_t count)", RecorderClassName(m_env.m_asset), MakeSafeTypeName(def))
+            LINE("{")
+            m_intendation++;
+
+            LINEF("assert({0} != nullptr);", MakeTypeVarName(def))
+            LINE("")
+
+            LINEF("{0}* var = {1};", def->GetFullName(), MakeTypeVarName(def))
+            LINE("for (size_t index = 0; index < count; index++)")
+            LINE("{")
+            m_intendation++;
+
+            LINE("PushIndex(index);")
+            LINEF("{0} = var;", MakeTypeVarName(info->m_definition))
+            LINEF("Record_{0}();", info->m_definition->m_name)
+            LINE("PopPath();")
+            LINE("var++;")
+
+            m_intendation--;
+            LINE("}")
+
+            m_intendation--;
+            LINE("}")
+        }
+
+        void RecordMember_ScriptString(const StructureInformation* info,
+                                       const MemberInformation* member,
+                                       const DeclarationModifierComputations& modifier,
+                                       const MemberLoadType loadType) const
+        {
+            if (loadType == MemberLoadType::ARRAY_POINTER)
+            {
+                LINEF("RecordArray_ScriptString({0}, {1}, {2});",
+                      MakePathName(member, modifier),
+                      MakeMemberAccess(info, member, modifier),
+                      MakeEvaluation(modifier.GetArrayPointerCountEvaluation()))
+            }
+            else if (loadType == MemberLoadType::EMBEDDED_ARRAY)
+            {
+                LINEF("RecordArray_ScriptString({0}, {1}, {2});",
+                      MakePathName(member, modifier),
+                      MakeMemberAccess(info, member, modifier),
+                      MakeArrayCount(dynamic_cast<ArrayDeclarationModifier*>(modifier.GetDeclarationModifier())))
+            }
+            else if (loadType == MemberLoadType::EMBEDDED)
+            {
+                LINEF("Record_ScriptString({0}, {1});", MakePathName(member, modifier), MakeMemberAccess(info, member, modifier))
+            }
+            else
+            {
+                assert(false);
+                LINEF("#error unsupported loadType {0} for script string", static_cast<int>(loadType))
+            }
+        }
+
+        void RecordMember_String(const StructureInformation* info,
+                                 const MemberInformation* member,
+                                 const DeclarationModifierComputations& modifier,
+                                 const MemberLoadType loadType) const
+        {
+            if (loadType == MemberLoadType::SINGLE_POINTER)
+            {
+                LINEF("Record_String({0}, {1});", MakePathName(member, modifier), MakeMemberAccess(info, member, modifier))
+            }
+            else if (loadType == MemberLoadType::POINTER_ARRAY)
+            {
+                if (modifier.IsArray())
+                {
+                    LINEF("RecordArray_String({0}, {1}, {2});", MakePathName(member, modifier), MakeMemberAccess(info, member, modifier), modifier.GetArraySize())
+                }
+                else
+                {
+                    LINEF("RecordArray_String({0}, {1}, {2});",
+                          MakePathName(member, modifier),
+                          MakeMemberAccess(info, member, modifier),
+                          MakeEvaluation(modifier.GetPointerArrayCountEvaluation()))
+                }
+            }
+            else
+            {
+                assert(false);
+                LINEF("#error unsupported loadType {0} for string", static_cast<int>(loadType))
+            }
+        }
+
+        void RecordMember_Asset(const StructureInformation* info,
+                                const MemberInformation* member,
+                                const DeclarationModifierComputations& modifier,
+                                const MemberLoadType loadType) const
+        {
+            if (loadType == MemberLoadType::SINGLE_POINTER)
+            {
+                LINEF("Record_AssetName({0}, {1}::GetAssetName({2}));",
+                      MakePathName(member, modifier),
+                      RecorderClassName(member->m_type),
+                      MakeMemberAccess(info, member, modifier))
+            }
+            else if (loadType == MemberLoadType::POINTER_ARRAY)
+            {
+                RecordMember_PointerArray(info, member, modifier);
+            }
+            else
+            {
+                assert(false);
+                LINEF("#error unsupported loadType {0} for asset", static_cast<int>(loadType))
+            }
+        }
+
+        void RecordMember_ArrayPointer(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier) const
+        {
+            if (member->m_type && !member->m_type->m_is_leaf)
+            {
+                LINEF("PushPath({0});", MakePathName(member, modifier))
+                LINEF("{0} = {1};", MakeTypeVarName(member->m_member->m_type_declaration->m_type), MakeMemberAccess(info, member, modifier))
+                LINEF("RecordArray_{0}({1});",
+                      MakeSafeTypeName(member->m_member->m_type_declaration->m_type),
+                      MakeEvaluation(modifier.GetArrayPointerCountEvaluation()))
+                LINE("PopPath();")
+            }
+            else
+            {
+                LINEF("RecordArray_Data({0}, {1}, sizeof({2}{3}), {4});",
+                      MakePathName(member, modifier),
+                      MakeMemberAccess(info, member, modifier),
+                      MakeTypeDecl(member->m_member->m_type_declaration.get()),
+                      MakeFollowingReferences(modifier.GetFollowingDeclarationModifiers()),
+                      MakeEvaluation(modifier.GetArrayPointerCountEvaluation()))
+            }
+        }
+
+        void RecordMember_PointerArray(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier) const
+        {
+            LINEF("PushPath({0});", MakePathName(member, modifier))
+            LINEF("{0} = {1};", MakeTypePtrVarName(member->m_member->m_type_declaration->m_type), MakeMemberAccess(info, member, modifier))
+            if (modifier.IsArray())
+            {
+                LINEF("RecordPtrArray_{0}({1});", MakeSafeTypeName(member->m_member->m_type_declaration->m_type), modifier.GetArraySize())
+            }
+            else
+            {
+                LINEF("RecordPtrArray_{0}({1});",
+                      MakeSafeTypeName(member->m_member->m_type_declaration->m_type),
+                      MakeEvaluation(modifier.GetPointerArrayCountEvaluation()))
+            }
+            LINE("PopPath();")
+        }
+
+        void RecordMember_EmbeddedArray(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier) const
+        {
+            std::string arraySizeStr;
+
+            if (modifier.HasDynamicArrayCount())
+                arraySizeStr = MakeEvaluation(modifier.GetDynamicArrayCountEvaluation());
+            else
+                arraySizeStr = std::to_string(modifier.GetArraySize());
+
+            if (member->m_type && !member->m_type->m_is_leaf)
+            {
+                LINEF("PushPath({0});", MakePathName(member, modifier))
+                LINEF("{0} = {1};", MakeTypeVarName(member->m_member->m_type_declaration->m_type), MakeMemberAccess(info, member, modifier))
+                LINEF("RecordArray_{0}({1});", MakeSafeTypeName(member->m_member->m_type_declaration->m_type), arraySizeStr)
+                LINE("PopPath();")
+            }
+            else
+            {
+                LINEF("RecordArray_Data({0}, {1}, sizeof({2}), {3});",
+                      MakePathName(member, modifier),
+                      MakeMemberAccess(info, member, modifier),
+                      MakeTypeDecl(member->m_member->m_type_declaration.get()),
+                      arraySizeStr)
+            }
+        }
+
+        void RecordMember_DynamicArray(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier) const
+        {
+            if (member->m_type && !member->m_type->m_is_leaf)
+            {
+                LINEF("PushPath({0});", MakePathName(member, modifier))
+                LINEF("{0} = {1};", MakeTypeVarName(member->m_member->m_type_declaration->m_type), MakeMemberAccess(info, member, modifier))
+                LINEF("RecordArray_{0}({1});",
+                      MakeSafeTypeName(member->m_member->m_type_declaration->m_type),
+                      MakeEvaluation(modifier.GetDynamicArraySizeEvaluation()))
+                LINE("PopPath();")
+            }
+            else
+            {
+                LINEF("RecordArray_Data({0}, {1}, sizeof({2}{3}), {4});",
+                      MakePathName(member, modifier),
+                      MakeMemberAccess(info, member, modifier),
+                      MakeTypeDecl(member->m_member->m_type_declaration.get()),
+                      MakeFollowingReferences(modifier.GetFollowingDeclarationModifiers()),
+                      MakeEvaluation(modifier.GetDynamicArraySizeEvaluation()))
+            }
+        }
+
+        void RecordMember_Embedded(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier) const
+        {
+            if (member->m_type && !member->m_type->m_is_leaf)
+            {
+                LINEF("PushPath({0});", MakePathName(member, modifier))
+                LINEF("{0} = &{1};", MakeTypeVarName(member->m_member->m_type_declaration->m_type), MakeMemberAccess(info, member, modifier))
+                LINEF("Record_{0}();", MakeSafeTypeName(member->m_member->m_type_declaration->m_type))
+                LINE("PopPath();")
+            }
+            else
+            {
+                RecordMember_Data(info, member, modifier);
+            }
+        }
+
+        void RecordMember_SinglePointer(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier) const
+        {
+            if (member->m_type && !member->m_type->m_is_leaf)
+            {
+                LINEF("PushPath({0});", MakePathName(member, modifier))
+                LINEF("{0} = {1};", MakeTypeVarName(member->m_member->m_type_declaration->m_type), MakeMemberAccess(info, member, modifier))
+                LINEF("Record_{0}();", MakeSafeTypeName(member->m_type->m_definition))
+                LINE("PopPath();")
+            }
+            else
+            {
+                LINEF("Record_Data({0}, {1}, sizeof({2}{3}));",
+                      MakePathName(member, modifier),
+                      MakeMemberAccess(info, member, modifier),
+                      MakeTypeDecl(member->m_member->m_type_declaration.get()),
+                      MakeFollowingReferences(modifier.GetFollowingDeclarationModifiers()))
+            }
+        }
+
+        void RecordMember_Data(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier) const
+        {
+            // Bit fields cannot be addressed, so their value is recorded instead of their memory
+            if (member->m_member->m_type_declaration->m_has_custom_bit_size)
+            {
+                LINEF("Record_Value({0}, static_cast<int64_t>({1}));", MakePathName(member, modifier), MakeMemberAccess(info, member, modifier))
+            }
+            else
+            {
+                LINEF("Record_Data({0}, &{1}, sizeof({1}));", MakePathName(member, modifier), MakeMemberAccess(info, member, modifier))
+            }
+        }
+
+        void RecordMember_TypeCheck(const StructureInformation* info,
+                                    const MemberInformation* member,
+                                    const DeclarationModifierComputations& modifier,
+                                    const MemberLoadType loadType) const
+        {
+            if (member->m_is_script_string)
+            {
+                RecordMember_ScriptString(info, member, modifier, loadType);
+            }
+            else if (member->m_is_string || member->m_asset_ref)
+            {
+                RecordMember_String(info, member, modifier, loadType);
+            }
+            else if (member->m_type && StructureComputations(member->m_type).IsAsset())
+            {
+                RecordMember_Asset(info, member, modifier, loadType);
+            }
+            else
+            {
+                switch (loadType)
+                {
+                case MemberLoadType::ARRAY_POINTER:
+                    RecordMember_ArrayPointer(info, member, modifier);
+                    break;
+
+                case MemberLoadType::SINGLE_POINTER:
+                    RecordMember_SinglePointer(info, member, modifier);
+                    break;
+
+                case MemberLoadType::EMBEDDED:
+                    RecordMember_Embedded(info, member, modifier);
+                    break;
+
+                case MemberLoadType::POINTER_ARRAY:
+                    RecordMember_PointerArray(info, member, modifier);
+                    break;
+
+                case MemberLoadType::DYNAMIC_ARRAY:
+                    RecordMember_DynamicArray(info, member, modifier);
+                    break;
+
+                case MemberLoadType::EMBEDDED_ARRAY:
+                    RecordMember_EmbeddedArray(info, member, modifier);
+                    break;
+
+                default:
+                    LINEF("// t={0}", static_cast<int>(loadType))
+                    break;
+                }
+            }
+        }
+
+        static bool RecordMember_ShouldMakePointerCheck(const MemberInformation* member, const DeclarationModifierComputations& modifier, MemberLoadType loadType)
+        {
+            if (loadType != MemberLoadType::ARRAY_POINTER && loadType != MemberLoadType::POINTER_ARRAY && loadType != MemberLoadType::SINGLE_POINTER)
+            {
+                return false;
+            }
+
+            if (loadType == MemberLoadType::POINTER_ARRAY)
+            {
+                return !modifier.IsArray();
+            }
+
+            if (member->m_is_string || member->m_asset_ref)
+            {
+                return false;
+            }
+
+            return true;
+        }
+
+        void RecordMember_PointerCheck(const StructureInformation* info,
+                                       const MemberInformation* member,
+                                       const DeclarationModifierComputations& modifier,
+                                       const MemberLoadType loadType)
+        {
+            // Runtime data is never loaded and therefore cannot differ between zones
+            if (MemberComputations(member).IsInRuntimeBlock())
+                return;
+
+            if (RecordMember_ShouldMakePointerCheck(member, modifier, loadType))
+            {
+                LINEF("if ({0})", MakeMemberAccess(info, member, modifier))
+                LINE("{")
+                m_intendation++;
+
+                RecordMember_TypeCheck(info, member, modifier, loadType);
+
+                m_intendation--;
+                LINE("}")
+            }
+            else
+            {
+                RecordMember_TypeCheck(info, member, modifier, loadType);
+            }
+        }
+
+        void RecordMember_ReferenceArray(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier)
+        {
+            for (const auto& entry : modifier.GetArrayEntries())
+            {
+                RecordMember_Reference(info, member, entry);
+            }
+        }
+
+        void RecordMember_Reference(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier)
+        {
+            if (modifier.IsDynamicArray())
+            {
+                RecordMember_PointerCheck(info, member, modifier, MemberLoadType::DYNAMIC_ARRAY);
+            }
+            else if (modifier.IsSinglePointer())
+            {
+                RecordMember_PointerCheck(info, member, modifier, MemberLoadType::SINGLE_POINTER);
+            }
+            else if (modifier.IsArrayPointer())
+            {
+                RecordMember_PointerCheck(info, member, modifier, MemberLoadType::ARRAY_POINTER);
+            }
+            else if (modifier.IsPointerArray())
+            {
+                RecordMember_PointerCheck(info, member, modifier, MemberLoadType::POINTER_ARRAY);
+            }
+            else if (modifier.IsArray() && modifier.GetNextDeclarationModifier() == nullptr)
+            {
+                RecordMember_PointerCheck(info, member, modifier, MemberLoadType::EMBEDDED_ARRAY);
+            }
+            else if (modifier.GetDeclarationModifier() == nullptr)
+            {
+                RecordMember_PointerCheck(info, member, modifier, MemberLoadType::EMBEDDED);
+            }
+            else if (modifier.IsArray())
+            {
+                RecordMember_ReferenceArray(info, member, modifier);
+            }
+            else
+            {
+                assert(false);
+                LINEF("#error RecordMemberReference failed @ {0}", member->m_member->m_name)
+            }
+        }
+
+        void RecordMember_Condition_Struct(const StructureInformation* info, const MemberInformation* member)
+        {
+            if (member->m_condition)
+            {
+                LINEF("if ({0})", MakeEvaluation(member->m_condition.get()))
+                LINE("{")
+                m_intendation++;
+
+                RecordMember_Reference(info, member, DeclarationModifierComputations(member));
+
+                m_intendation--;
+                LINE("}")
+            }
+            else
+            {
+                RecordMember_Reference(info, member, DeclarationModifierComputations(member));
+            }
+        }
+
+        void RecordMember_Condition_Union(const StructureInformation* info, const MemberInformation* member)
+        {
+            const MemberComputations computations(member);
+
+            if (computations.IsFirstMember())
+            {
+                if (member->m_condition)
+                {
+                    LINEF("if ({0})", MakeEvaluation(member->m_condition.get()))
+                    LINE("{")
+                    m_intendation++;
+
+                    RecordMember_Reference(info, member, DeclarationModifierComputations(member));
+
+                    m_intendation--;
+                    LINE("}")
+                }
+                else
+                {
+                    RecordMember_Reference(info, member, DeclarationModifierComputations(member));
+                }
+            }
+            else if (computations.IsLastMember())
+            {
+                if (member->m_condition)
+                {
+                    LINEF("else if ({0})", MakeEvaluation(member->m_condition.get()))
+                    LINE("{")
+                    m_intendation++;
+
+                    RecordMember_Reference(info, member, DeclarationModifierComputations(member));
+
+                    m_intendation--;
+                    LINE("}")
+                }
+                else
+                {
+                    LINE("else")
+                    LINE("{")
+                    m_intendation++;
+
+                    RecordMember_Reference(info, member, DeclarationModifierComputations(member));
+
+                    m_intendation--;
+                    LINE("}")
+                }
+            }
+            else
+            {
+                if (member->m_condition)
+                {
+                    LINEF("else if ({0})", MakeEvaluation(member->m_condition.get()))
+                    LINE("{")
+                    m_intendation++;
+
+                    RecordMember_Reference(info, member, DeclarationModifierComputations(member));
+
+                    m_intendation--;
+                    LINE("}")
+                }
+                else
+                {
+                    LINEF("#error Middle member of union must have condition ({0})", member->m_member->m_name)
+                }
+            }
+        }
+
+        void PrintRecordStructMembers(const StructureInformation* info)
+        {
+            for (const auto& member : info->m_ordered_members)
+            {
+                const MemberComputations computations(member.get());
+                if (computations.ShouldIgnore())
+                    continue;
+
+                if (!member->m_is_leaf)
+                {
+                    RecordMember_Condition_Struct(info, member.get());
+                }
+                else if (member->m_member->m_name.empty())
+                {
+                    RecordMember_AnonymousData(info, member->m_member);
+                }
+                else if (!HasPointerModifier(member.get()))
+                {
+                    // Leaf members with pointers always have a count of 0 and do not point to anything that could be compared
+                    RecordMember_Data(info, member.get(), DeclarationModifierComputations(member.get()));
+                }
+            }
+        }
+
+        void RecordMember_AnonymousData(const StructureInformation* info, const Variable* variable)
+        {
+            // Members of anonymous structs and unions can be accessed as if they were members of the surrounding type
+            const auto* definition = dynamic_cast<const DefinitionWithMembers*>(variable->m_type_declaration->m_type);
+            if (definition == nullptr)
+                return;
+
+            if (definition->GetType() == DataDefinitionType::UNION)
+            {
+                // All members of a union share their memory, so recording the largest one is enough
+                const auto largestMember = std::ranges::max_element(definition->m_members,
+                                                                    [](const std::shared_ptr<Variable>& var0, const std::shared_ptr<Variable>& var1)
+                                                                    {
+                                                                        return var0->m_type_declaration->GetSize() < var1->m_type_declaration->GetSize();
+                                                                    });
+                if (largestMember != definition->m_members.end())
+                    RecordVariable_Data(info, largestMember->get());
+            }
+            else
+            {
+                for (const auto& innerVariable : definition->m_members)
+                    RecordVariable_Data(info, innerVariable.get());
+            }
+        }
+
+        void RecordVariable_Data(const StructureInformation* info, const Variable* variable)
+        {
+            if (variable->m_name.empty())
+            {
+                RecordMember_AnonymousData(info, variable);
+            }
+            else if (variable->m_type_declaration->m_has_custom_bit_size)
+            {
+                LINEF("Record_Value(\"{0}\", static_cast<int64_t>({1}->{0}));", variable->m_name, MakeTypeVarName(info->m_definition))
+            }
+            else
+            {
+                LINEF("Record_Data(\"{0}\", &{1}->{0}, sizeof({1}->{0}));", variable->m_name, MakeTypeVarName(info->m_definition))
+            }
+        }
+
+        void PrintRecordUnionMembers(const StructureInformation* info)
+        {
+            const StructureComputations computations(info);
+            const auto usedMembers = computations.GetUsedMembers();
+
+            for (const auto* member : usedMembers)
+                RecordMember_Condition_Union(info, member);
+
+            // Compare the memory of the union when none of its members that need special treatment is active
+            if (!usedMembers.empty() && usedMembers.back()->m_condition && computations.GetDynamicMember() == nullptr)
+            {
+                LINE("else")
+                LINE("{")
+                m_intendation++;
+
+                LINEF("Record_Data(nullptr, {0}, sizeof({1}));", MakeTypeVarName(info->m_definition), info->m_definition->GetFullName())
+
+                m_intendation--;
+                LINE("}")
+            }
+        }
+
+        void PrintRecordMethod(const StructureInformation* info)
+        {
+            LINEF("void {0}::Record_{1}()", RecorderClassName(m_env.m_asset), info->m_definition->m_name)
+            LINE("{")
+            m_intendation++;
+
+            LINEF("assert({0} != nullptr);", MakeTypeVarName(info->m_definition))
+            LINE("")
+
+            if (info->m_definition->GetType() == DataDefinitionType::UNION)
+                PrintRecordUnionMembers(info);
+            else
+                PrintRecordStructMembers(info);
+
+            m_intendation--;
+            LINE("}")
+        }
+
+        void PrintGetNameMethod()
+        {
+            LINEF("std::string {0}::GetAssetName({1}* pAsset)", RecorderClassName(m_env.m_asset), m_env.m_asset->m_definition->GetFullName())
+            LINE("{")
+            m_intendation++;
+
+            if (!m_env.m_asset->m_name_chain.empty())
+            {
+                LINE_START("return pAsset")
+
+                auto first = true;
+                for (auto* member : m_env.m_asset->m_name_chain)
+                {
+                    if (first)
+                    {
+                        first = false;
+                        LINE_MIDDLEF("->{0}", member->m_member->m_name)
+                    }
+                    else
+                    {
+                        LINE_MIDDLEF(".{0}", member->m_member->m_name)
+                    }
+                }
+                LINE_END(";")
+            }
+            else
+            {
+                LINEF("return \"{0}\";", m_env.m_asset->m_definition->m_name)
+            }
+
+            m_intendation--;
+            LINE("}")
+        }
+
+        void PrintMainRecordMethod()
+        {
+            LINEF("void {0}::Record({1}* pAsset)", RecorderClassName(m_env.m_asset), m_env.m_asset->m_definition->GetFullName())
+            LINE("{")
+            m_intendation++;
+
+            LINE("assert(pAsset != nullptr);")
+            LINE("")
+            LINEF("{0} = pAsset;", MakeTypeVarName(m_env.m_asset->m_definition))
+            LINEF("Record_{0}();", MakeSafeTypeName(m_env.m_asset->m_definition))
+
+            m_intendation--;
+            LINE("}")
+        }
+    };
+} // namespace
+
+std::vector<CodeTemplateFile> ZoneDiffTemplate::GetFilesToRender(RenderingContext* context)
+{
+    std::vector<CodeTemplateFile> files;
+
+    auto assetName = context->m_asset->m_definition->m_name;
+    utils::MakeStringLowerCase(assetName);
+
+    files.emplace_back(std::format("{0}/{0}_diff_db.h", assetName), TAG_HEADER);
+    files.emplace_back(std::format("{0}/{0}_diff_db.cpp", assetName), TAG_SOURCE);
+
+    return files;
+}
+
+void ZoneDiffTemplate::RenderFile(std::ostream& stream, const int fileTag, RenderingContext* context)
+{
+    Template t(stream, context);
+
+    if (fileTag == TAG_HEADER)
+    {
+        t.Header();
+    }
+    else
+    {
+        assert(fileTag == TAG_SOURCE);
+        t.Source();
+    }
+}
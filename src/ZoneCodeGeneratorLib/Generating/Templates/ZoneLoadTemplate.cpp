@@ -98,6 +98,7 @@ namespace
             PrintHeaderLoadMethodDeclaration(m_env.m_asset);
             PrintHeaderTempPtrLoadMethodDeclaration(m_env.m_asset);
             PrintHeaderAssetLoadMethodDeclaration(m_env.m_asset);
+            PrintHeaderAssetScanMethodDeclaration(m_env.m_asset);
             LINE("")
             m_intendation--;
             LINE("public:")
@@ -170,6 +171,8 @@ namespace
             LINE("")
             PrintLoadAssetMethod(m_env.m_asset);
             LINE("")
+            PrintScanAssetMethod(m_env.m_asset);
+            LINE("")
             PrintMainLoadMethod();
             LINE("")
             PrintGetNameMethod();
@@ -231,6 +234,11 @@ namespace
             LINEF("void LoadAsset_{0}({1}** pAsset);", MakeSafeTypeName(info->m_definition), info->m_definition->GetFullName())
         }
 
+        void PrintHeaderAssetScanMethodDeclaration(const StructureInformation* info) const
+        {
+            LINEF("void ScanAsset_{0}({1}** pAsset);", MakeSafeTypeName(info->m_definition), info->m_definition->GetFullName())
+        }
+
         void PrintHeaderGetNameMethodDeclaration(const StructureInformation* info) const
         {
             LINEF("static std::string GetAssetName({0}* pAsset);", info->m_definition->GetFullName())
@@ -484,13 +492,13 @@ namespace
                 if (member->m_type->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_type->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_type->m_post_load_action.get());
                 }
 
                 if (member->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_post_load_action.get());
                 }
             }
             else
@@ -544,13 +552,13 @@ namespace
                 if (member->m_type->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_type->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_type->m_post_load_action.get());
                 }
 
                 if (member->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_post_load_action.get());
                 }
             }
             else if (computations.IsAfterPartialLoad())
@@ -601,13 +609,13 @@ namespace
                 if (member->m_type->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_type->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_type->m_post_load_action.get());
                 }
 
                 if (member->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_post_load_action.get());
                 }
             }
             else if (computations.IsAfterPartialLoad())
@@ -630,13 +638,13 @@ namespace
                 if (member->m_type->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_type->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_type->m_post_load_action.get());
                 }
 
                 if (member->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_post_load_action.get());
                 }
             }
             else
@@ -1205,13 +1213,20 @@ namespace
             if (info->m_post_load_action)
             {
                 LINE("")
-                LINE(MakeCustomActionCall(info->m_post_load_action.get()))
+                PrintCustomActionCall(info->m_post_load_action.get());
             }
 
             if (StructureComputations(info).IsAsset())
             {
                 LINE("")
+                LINE("if (m_scan_only)")
+                m_intendation++;
+                LINEF("ScanAsset_{0}({1});", MakeSafeTypeName(info->m_definition), MakeTypePtrVarName(info->m_definition))
+                m_intendation--;
+                LINE("else")
+                m_intendation++;
                 LINEF("LoadAsset_{0}({1});", MakeSafeTypeName(info->m_definition), MakeTypePtrVarName(info->m_definition))
+                m_intendation--;
             }
 
             if (inTemp)
@@ -1284,6 +1299,52 @@ namespace
             LINE("}")
         }
 
+        void PrintScanAssetMethod(const StructureInformation* info)
+        {
+            LINEF("void {0}::ScanAsset_{1}({2}** pAsset)",
+                  LoaderClassName(m_env.m_asset),
+                  MakeSafeTypeName(info->m_definition),
+                  info->m_definition->GetFullName())
+            LINE("{")
+            m_intendation++;
+
+            LINE("assert(pAsset != nullptr);")
+            LINE("")
+            LINE("// Scanned assets only keep their name, since all other data may point into temp block memory that is discarded after loading")
+            LINEF("auto* reallocatedAsset = m_zone->GetMemory()->Alloc<{0}>();", info->m_definition->GetFullName())
+            if (!info->m_name_chain.empty())
+                LINEF("{0} = m_zone->GetMemory()->Dup({1});", MakeNameAccess(info, "reallocatedAsset"), MakeNameAccess(info, "(*pAsset)"))
+            LINE("")
+            LINEF("m_asset_info = reinterpret_cast<XAssetInfo<{0}>*>(LinkAsset(GetAssetName(*pAsset), reallocatedAsset, {{}}, {{}}, {{}}));",
+                  info->m_definition->GetFullName())
+            LINE("*pAsset = m_asset_info->Asset();")
+
+            m_intendation--;
+            LINE("}")
+        }
+
+        static std::string MakeNameAccess(const StructureInformation* info, const std::string& variableName)
+        {
+            std::ostringstream str;
+            str << variableName;
+
+            auto first = true;
+            for (const auto* member : info->m_name_chain)
+            {
+                str << (first ? "->" : ".") << member->m_member->m_name;
+                first = false;
+            }
+
+            return str.str();
+        }
+
+        void PrintCustomActionCall(const CustomAction* action) const
+        {
+            // Actions only persist data of the asset, which scanned assets do not need
+            LINE("if (!m_scan_only)")
+            LINEF("    {0}", MakeCustomActionCall(action))
+        }
+
         void PrintMainLoadMethod()
         {
             LINEF("XAssetInfo<{0}>* {1}::Load({0}** pAsset)", m_env.m_asset->m_definition->GetFullName(), LoaderClassName(m_env.m_asset))
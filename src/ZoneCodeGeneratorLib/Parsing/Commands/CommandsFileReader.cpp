@@ -26,6 +26,7 @@ namespace
 CommandsFileReader::CommandsFileReader(const ZoneCodeGeneratorArguments* args, std::string filename)
     : m_args(args),
       m_filename(std::move(filename)),
+      m_base_stream(nullptr),
       m_stream(nullptr)
 {
     SetupPostProcessors();
@@ -40,6 +41,7 @@ bool CommandsFileReader::OpenBaseStream()
         return false;
     }
 
+    m_base_stream = stream.get();
     m_stream = stream.get();
     m_open_streams.emplace_back(std::move(stream));
     return true;
@@ -101,3 +103,11 @@ bool CommandsFileReader::ReadCommandsFile(IDataRepository* repository)
                                    return postProcessor->PostProcess(repository);
                                });
 }
+
+std::vector<std::string> CommandsFileReader::GetInputFiles() const
+{
+    if (!m_base_stream)
+        return {};
+
+    return m_base_stream->GetOpenedFilePaths();
+}
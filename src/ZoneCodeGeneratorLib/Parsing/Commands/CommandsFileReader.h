@@ -1,11 +1,13 @@
 #pragma once
 
 #include "Parsing/IParserLineStream.h"
+#include "Parsing/Impl/ParserFilesystemStream.h"
 #include "Parsing/PostProcessing/IPostProcessor.h"
 #include "Persistence/IDataRepository.h"
 #include "ZoneCodeGeneratorArguments.h"
 
 #include <string>
+#include <vector>
 
 class CommandsFileReader
 {
@@ -13,6 +15,7 @@ public:
     CommandsFileReader(const ZoneCodeGeneratorArguments* args, std::string filename);
 
     bool ReadCommandsFile(IDataRepository* repository);
+    [[nodiscard]] std::vector<std::string> GetInputFiles() const;
 
 private:
     bool OpenBaseStream();
@@ -23,6 +26,7 @@ private:
     std::string m_filename;
 
     std::vector<std::unique_ptr<IParserLineStream>> m_open_streams;
+    const ParserFilesystemStream* m_base_stream;
     IParserLineStream* m_stream;
 
     std::vector<std::unique_ptr<IPostProcessor>> m_post_processors;
@@ -27,6 +27,7 @@ HeaderFileReader::HeaderFileReader(const ZoneCodeGeneratorArguments* args, std::
     : m_args(args),
       m_filename(std::move(filename)),
       m_pack_value_supplier(nullptr),
+      m_base_stream(nullptr),
       m_stream(nullptr)
 {
     SetupPostProcessors();
@@ -41,6 +42,7 @@ bool HeaderFileReader::OpenBaseStream()
         return false;
     }
 
+    m_base_stream = stream.get();
     m_stream = stream.get();
     m_open_streams.emplace_back(std::move(stream));
     return true;
@@ -102,3 +104,11 @@ bool HeaderFileReader::ReadHeaderFile(IDataRepository* repository)
                                    return postProcessor->PostProcess(repository);
                                });
 }
+
+std::vector<std::string> HeaderFileReader::GetInputFiles() const
+{
+    if (!m_base_stream)
+        return {};
+
+    return m_base_stream->GetOpenedFilePaths();
+}
@@ -2,11 +2,13 @@
 
 #include "Parsing/IPackValueSupplier.h"
 #include "Parsing/IParserLineStream.h"
+#include "Parsing/Impl/ParserFilesystemStream.h"
 #include "Parsing/PostProcessing/IPostProcessor.h"
 #include "Persistence/IDataRepository.h"
 #include "ZoneCodeGeneratorArguments.h"
 
 #include <string>
+#include <vector>
 
 class HeaderFileReader
 {
@@ -14,6 +16,7 @@ public:
     HeaderFileReader(const ZoneCodeGeneratorArguments* args, std::string filename);
 
     bool ReadHeaderFile(IDataRepository* repository);
+    [[nodiscard]] std::vector<std::string> GetInputFiles() const;
 
 private:
     bool OpenBaseStream();
@@ -25,6 +28,7 @@ private:
 
     std::vector<std::unique_ptr<IParserLineStream>> m_open_streams;
     const IPackValueSupplier* m_pack_value_supplier;
+    const ParserFilesystemStream* m_base_stream;
     IParserLineStream* m_stream;
 
     std::vector<std::unique_ptr<IPostProcessor>> m_post_processors;
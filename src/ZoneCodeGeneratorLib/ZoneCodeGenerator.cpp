@@ -1,6 +1,7 @@
 #include "ZoneCodeGenerator.h"
 
 #include "Generating/CodeGenerator.h"
+#include "Generating/GenerationManifest.h"
 #include "Parsing/Commands/CommandsFileReader.h"
 #include "Parsing/Header/HeaderFileReader.h"
 #include "Persistence/IDataRepository.h"
@@ -9,9 +10,15 @@
 #include "ZoneCodeGeneratorArguments.h"
 
 #include <cstdio>
+#include <filesystem>
+#include <format>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
 
 class ZoneCodeGeneratorImpl : public ZoneCodeGenerator
 {
@@ -30,6 +37,10 @@ public:
         if (!shouldContinue)
             return 0;
 
+        m_executable_path = argv[0];
+        if (IsManifestUpToDate())
+            return 0;
+
         if (!ReadHeaderData() || !ReadCommandsData())
             return 1;
 
@@ -42,6 +53,9 @@ public:
                 return 1;
         }
 
+        if (!m_args.m_manifest_path.empty() && !WriteManifest())
+            return 1;
+
         return 0;
     }
 
@@ -54,6 +68,9 @@ private:
 
             if (!headerFileReader.ReadHeaderFile(m_repository.get()))
                 return false;
+
+            const auto inputFiles = headerFileReader.GetInputFiles();
+            m_input_files.insert(m_input_files.end(), inputFiles.begin(), inputFiles.end());
         }
 
         return true;
@@ -67,6 +84,9 @@ private:
 
             if (!commandsFileReader.ReadCommandsFile(m_repository.get()))
                 return false;
+
+            const auto inputFiles = commandsFileReader.GetInputFiles();
+            m_input_files.insert(m_input_files.end(), inputFiles.begin(), inputFiles.end());
         }
 
         return true;
@@ -78,14 +98,80 @@ private:
         prettyPrinter.PrintAll();
     }
 
-    _NODISCARD bool GenerateCode() const
+    _NODISCARD bool GenerateCode()
     {
         CodeGenerator codeGenerator(&m_args);
-        return codeGenerator.GenerateCode(m_repository.get());
+        if (!codeGenerator.GenerateCode(m_repository.get()))
+            return false;
+
+        m_output_files = codeGenerator.GetGeneratedFiles();
+        return true;
+    }
+
+    _NODISCARD std::string GetManifestConfiguration() const
+    {
+        std::ostringstream ss;
+        ss << std::format("out={}", m_args.m_output_directory);
+        for (const auto& generationTask : m_args.m_generation_tasks)
+            ss << std::format(";{}:{}", generationTask.m_all_assets ? "*" : generationTask.m_asset_name, generationTask.m_template_name);
+
+        return ss.str();
+    }
+
+    _NODISCARD bool IsManifestUpToDate() const
+    {
+        // Printing always requires the data to be read
+        if (m_args.m_manifest_path.empty() || m_args.ShouldPrint())
+            return false;
+
+        const auto configuration = GetManifestConfiguration();
+        GenerationManifest manifest(configuration);
+        if (!manifest.ReadFromFile(m_args.m_manifest_path) || !manifest.IsUpToDate(configuration))
+            return false;
+
+        // Touch the manifest to let build systems know the outputs are up to date
+        std::error_code ec;
+        fs::last_write_time(m_args.m_manifest_path, fs::file_time_type::clock::now(), ec);
+
+        std::cout << std::format("Inputs unchanged since last generation, skipping: {}\n", m_args.m_manifest_path);
+        return true;
+    }
+
+    _NODISCARD bool WriteManifest() const
+    {
+        GenerationManifest manifest(GetManifestConfiguration());
+
+        // Changes to the generator itself also need to cause regeneration
+        if (fs::is_regular_file(m_executable_path))
+            manifest.AddInputFile(absolute(fs::path(m_executable_path)).lexically_normal().string());
+
+        for (const auto& inputFile : m_input_files)
+        {
+            if (!manifest.AddInputFile(inputFile))
+            {
+                std::cerr << std::format("Failed to hash input file for manifest: {}\n", inputFile);
+                return false;
+            }
+        }
+
+        for (const auto& outputFile : m_output_files)
+            manifest.AddOutputFile(outputFile);
+
+        if (!manifest.WriteToFile(m_args.m_manifest_path))
+        {
+            std::cerr << std::format("Failed to write manifest: {}\n", m_args.m_manifest_path);
+            return false;
+        }
+
+        return true;
     }
 
     ZoneCodeGeneratorArguments m_args;
     std::unique_ptr<IDataRepository> m_repository;
+
+    std::string m_executable_path;
+    std::vector<std::string> m_input_files;
+    std::vector<std::string> m_output_files;
 };
 
 std::unique_ptr<ZoneCodeGenerator> ZoneCodeGenerator::Create()
@@ -62,6 +62,15 @@ const CommandLineOption* const OPTION_OUTPUT_FOLDER =
     .WithParameter("outputPath")
     .Build();
 
+const CommandLineOption* const OPTION_MANIFEST =
+    CommandLineOption::Builder::Create()
+    .WithShortName("m")
+    .WithLongName("manifest")
+    .WithDescription("Specifies a dependency manifest file. Generation is skipped when all inputs recorded in the manifest are unchanged.")
+    .WithCategory(CATEGORY_OUTPUT)
+    .WithParameter("manifestFile")
+    .Build();
+
 const CommandLineOption* const OPTION_PRINT =
     CommandLineOption::Builder::Create()
     .WithShortName("p")
@@ -89,6 +98,7 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_HEADER,
     OPTION_COMMANDS_FILE,
     OPTION_OUTPUT_FOLDER,
+    OPTION_MANIFEST,
     OPTION_PRINT,
     OPTION_GENERATE,
 };
@@ -177,6 +187,10 @@ bool ZoneCodeGeneratorArguments::ParseArgs(const int argc, const char** argv, bo
     else
         m_output_directory = ".";
 
+    // -m; --manifest
+    if (m_argument_parser.IsOptionSpecified(OPTION_MANIFEST))
+        m_manifest_path = m_argument_parser.GetValueForOption(OPTION_MANIFEST);
+
     // -h; --header
     if (m_argument_parser.IsOptionSpecified(OPTION_HEADER))
     {
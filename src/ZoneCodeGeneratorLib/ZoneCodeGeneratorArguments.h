@@ -31,6 +31,7 @@ public:
     std::vector<std::string> m_header_paths;
     std::vector<std::string> m_command_paths;
     std::string m_output_directory;
+    std::string m_manifest_path;
 
     std::vector<GenerationTask> m_generation_tasks;
 
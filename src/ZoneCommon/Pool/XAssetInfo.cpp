@@ -37,7 +37,8 @@ std::size_t std::hash<IndirectAssetReference>::operator()(const IndirectAssetRef
 XAssetInfoGeneric::XAssetInfoGeneric()
     : m_type(-1),
       m_ptr(nullptr),
-      m_zone(nullptr)
+      m_zone(nullptr),
+      m_mark_epoch(0u)
 {
 }
 
@@ -45,7 +46,8 @@ XAssetInfoGeneric::XAssetInfoGeneric(const asset_type_t type, std::string name,
     : m_type(type),
       m_name(std::move(name)),
       m_ptr(ptr),
-      m_zone(nullptr)
+      m_zone(nullptr),
+      m_mark_epoch(0u)
 {
 }
 
@@ -56,7 +58,8 @@ XAssetInfoGeneric::XAssetInfoGeneric(
       m_ptr(ptr),
       m_dependencies(std::move(dependencies)),
       m_used_script_strings(std::move(usedScriptStrings)),
-      m_zone(nullptr)
+      m_zone(nullptr),
+      m_mark_epoch(0u)
 {
 }
 
@@ -72,7 +75,8 @@ XAssetInfoGeneric::XAssetInfoGeneric(asset_type_t type,
       m_dependencies(std::move(dependencies)),
       m_used_script_strings(std::move(usedScriptStrings)),
       m_indirect_asset_references(std::move(indirectAssetReferences)),
-      m_zone(nullptr)
+      m_zone(nullptr),
+      m_mark_epoch(0u)
 {
 }
 
@@ -89,7 +93,8 @@ XAssetInfoGeneric::XAssetInfoGeneric(const asset_type_t type,
       m_dependencies(std::move(dependencies)),
       m_used_script_strings(std::move(usedScriptStrings)),
       m_indirect_asset_references(std::move(indirectAssetReferences)),
-      m_zone(zone)
+      m_zone(zone),
+      m_mark_epoch(0u)
 {
 }
 
@@ -2,6 +2,7 @@
 #include "Zone/Zone.h"
 #include "Zone/ZoneTypes.h"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -65,6 +66,9 @@ public:
     std::vector<scr_string_t> m_used_script_strings;
     std::vector<IndirectAssetReference> m_indirect_asset_references;
     Zone* m_zone;
+
+    // The epoch of the last asset marker that added this asset as a dependency, so markers can deduplicate dependencies without hashing
+    uint64_t m_mark_epoch;
 };
 
 template<typename T> class XAssetInfo : public XAssetInfoGeneric
@@ -0,0 +1,143 @@
+#include "AssetHashSet.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace
+{
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+    constexpr uint64_t SEED_MULTIPLIER = 0x9E3779B97F4A7C15u;
+
+    constexpr auto HASHES_PER_BUCKET = 4uz;
+    constexpr uint32_t MAX_BUCKET_SEED = 1u << 16u;
+
+    uint64_t MixBits(uint64_t value)
+    {
+        value ^= value >> 30u;
+        value *= 0xBF58476D1CE4E5B9u;
+        value ^= value >> 27u;
+        value *= 0x94D049BB133111EBu;
+        value ^= value >> 31u;
+
+        return value;
+    }
+} // namespace
+
+AssetHashSet::AssetHashSet(std::vector<uint64_t> assetHashes)
+    : m_asset_hashes(std::move(assetHashes))
+{
+    std::ranges::sort(m_asset_hashes);
+    const auto duplicates = std::ranges::unique(m_asset_hashes);
+    m_asset_hashes.erase(duplicates.begin(), duplicates.end());
+
+    // A hash of 0 marks empty slots and is never returned by HashAsset
+    std::erase(m_asset_hashes, 0u);
+
+    if (m_asset_hashes.empty())
+        return;
+
+    // Leave some slots free so the buckets that are placed last quickly find a seed
+    auto slotCount = m_asset_hashes.size() + m_asset_hashes.size() / 8u + 1u;
+    while (!TryBuild(slotCount))
+        slotCount += slotCount / 8u + 1u;
+}
+
+uint64_t AssetHashSet::HashAsset(const asset_type_t assetType, const std::string_view assetName)
+{
+    // Hash the bytes of the type in a fixed order to get the same hash on every platform
+    auto hash = FNV_OFFSET_BASIS;
+    for (auto i = 0u; i < sizeof(uint32_t); i++)
+        hash = (hash ^ ((static_cast<uint32_t>(assetType) >> (i * 8u)) & 0xFFu)) * FNV_PRIME;
+
+    for (const auto c : assetName)
+        hash = (hash ^ static_cast<uint8_t>(c)) * FNV_PRIME;
+
+    hash = MixBits(hash);
+
+    return hash != 0u ? hash : 1u;
+}
+
+bool AssetHashSet::Contains(const uint64_t assetHash) const
+{
+    if (assetHash == 0u || m_slots.empty())
+        return false;
+
+    return m_slots[GetSlot(assetHash)] == assetHash;
+}
+
+bool AssetHashSet::Contains(const asset_type_t assetType, const std::string_view assetName) const
+{
+    return Contains(HashAsset(assetType, assetName));
+}
+
+const std::vector<uint64_t>& AssetHashSet::GetAssetHashes() const
+{
+    return m_asset_hashes;
+}
+
+size_t AssetHashSet::GetSlot(const uint64_t assetHash) const
+{
+    const auto bucket = static_cast<size_t>(assetHash % m_bucket_seeds.size());
+    const auto seed = static_cast<uint64_t>(m_bucket_seeds[bucket]);
+
+    return static_cast<size_t>(MixBits(assetHash ^ (seed * SEED_MULTIPLIER)) % m_slots.size());
+}
+
+bool AssetHashSet::TryBuild(const size_t slotCount)
+{
+    const auto bucketCount = (m_asset_hashes.size() + HASHES_PER_BUCKET - 1u) / HASHES_PER_BUCKET;
+    std::vector<std::vector<uint64_t>> buckets(bucketCount);
+    for (const auto assetHash : m_asset_hashes)
+        buckets[static_cast<size_t>(assetHash % bucketCount)].emplace_back(assetHash);
+
+    // Place the largest buckets first while most slots are still free
+    std::vector<size_t> bucketOrder(bucketCount);
+    std::iota(bucketOrder.begin(), bucketOrder.end(), 0uz);
+    std::ranges::stable_sort(bucketOrder,
+                             [&buckets](const size_t bucket0, const size_t bucket1)
+                             {
+                                 return buckets[bucket0].size() > buckets[bucket1].size();
+                             });
+
+    m_bucket_seeds.assign(bucketCount, 0u);
+    m_slots.assign(slotCount, 0u);
+
+    std::vector<size_t> bucketSlots;
+    for (const auto bucketIndex : bucketOrder)
+    {
+        const auto& bucket = buckets[bucketIndex];
+        if (bucket.empty())
+            break;
+
+        // Search for a seed that maps all hashes of the bucket to distinct free slots
+        auto placed = false;
+        for (auto seed = 0u; seed < MAX_BUCKET_SEED && !placed; seed++)
+        {
+            m_bucket_seeds[bucketIndex] = seed;
+            bucketSlots.clear();
+
+            placed = true;
+            for (const auto assetHash : bucket)
+            {
+                const auto slot = GetSlot(assetHash);
+                if (m_slots[slot] != 0u || std::ranges::find(bucketSlots, slot) != bucketSlots.end())
+                {
+                    placed = false;
+                    break;
+                }
+
+                bucketSlots.emplace_back(slot);
+            }
+        }
+
+        if (!placed)
+            return false;
+
+        for (auto i = 0uz; i < bucket.size(); i++)
+            m_slots[bucketSlots[i]] = bucket[i];
+    }
+
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Zone/ZoneTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * \brief A set of assets that are only identified by a 64-bit hash of their type and name.
+ * The set is built with a perfect hash function, so looking up an asset only ever probes a single slot.
+ */
+class AssetHashSet
+{
+public:
+    AssetHashSet() = default;
+    explicit AssetHashSet(std::vector<uint64_t> assetHashes);
+
+    /**
+     * \brief Hashes the type and name of an asset. The hash is stable across platforms and runs, so it can be persisted.
+     * \return The hash of the asset, which is never \c 0.
+     */
+    static uint64_t HashAsset(asset_type_t assetType, std::string_view assetName);
+
+    [[nodiscard]] bool Contains(uint64_t assetHash) const;
+    [[nodiscard]] bool Contains(asset_type_t assetType, std::string_view assetName) const;
+
+    /**
+     * \brief The sorted hashes of all assets of the set.
+     */
+    [[nodiscard]] const std::vector<uint64_t>& GetAssetHashes() const;
+
+private:
+    [[nodiscard]] size_t GetSlot(uint64_t assetHash) const;
+    bool TryBuild(size_t slotCount);
+
+    std::vector<uint64_t> m_asset_hashes;
+    std::vector<uint32_t> m_bucket_seeds;
+    std::vector<uint64_t> m_slots;
+};
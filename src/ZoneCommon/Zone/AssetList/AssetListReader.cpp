@@ -4,7 +4,10 @@
 #include "Game/IGame.h"
 #include "Zone/AssetNameResolver.h"
 
+#include <cctype>
 #include <format>
+#include <sstream>
+#include <string_view>
 
 namespace
 {
@@ -61,6 +64,70 @@ namespace
         CsvInputStream m_stream;
         const IAssetNameResolver* m_asset_name_resolver;
     };
+
+    std::string_view TrimCell(std::string_view cell)
+    {
+        while (!cell.empty() && std::isspace(static_cast<unsigned char>(cell.front())))
+            cell.remove_prefix(1u);
+        while (!cell.empty() && std::isspace(static_cast<unsigned char>(cell.back())))
+            cell.remove_suffix(1u);
+
+        return cell;
+    }
+
+    /**
+     * \brief Reads an asset list directly from its content without building row vectors for every line.
+     * \return \c false if the content contains anything that should be left to \c AssetListInputStream, like errors that need to be reported.
+     */
+    bool ReadSimpleAssetList(const std::string_view content, const IAssetNameResolver& assetNameResolver, AssetList& assetList)
+    {
+        std::vector<std::string_view> cells;
+        auto lineStart = 0uz;
+        while (lineStart < content.size())
+        {
+            auto lineEnd = content.find('\n', lineStart);
+            if (lineEnd == std::string_view::npos)
+                lineEnd = content.size();
+
+            auto line = content.substr(lineStart, lineEnd - lineStart);
+            if (lineEnd < content.size() && !line.empty() && line.back() == '\r')
+                line.remove_suffix(1u);
+            lineStart = lineEnd + 1u;
+
+            // The csv stream treats carriage returns that do not end a line differently
+            if (line.find('\r') != std::string_view::npos)
+                return false;
+
+            cells.clear();
+            auto cellStart = 0uz;
+            while (true)
+            {
+                const auto separatorPos = line.find(',', cellStart);
+                cells.emplace_back(TrimCell(line.substr(cellStart, separatorPos == std::string_view::npos ? std::string_view::npos : separatorPos - cellStart)));
+                if (separatorPos == std::string_view::npos)
+                    break;
+
+                cellStart = separatorPos + 1u;
+            }
+
+            if (cells.size() == 1u && cells[0].empty())
+                continue;
+
+            if (cells.size() < 2u)
+                return false;
+
+            const auto maybeType = assetNameResolver.GetAssetTypeByName(std::string(cells[0]));
+            if (!maybeType)
+                return false;
+
+            if (cells.size() >= 3u && cells[1].empty())
+                assetList.m_entries.emplace_back(*maybeType, std::string(cells[2]), true);
+            else
+                assetList.m_entries.emplace_back(*maybeType, std::string(cells[1]), false);
+        }
+
+        return true;
+    }
 } // namespace
 
 AssetListReader::AssetListReader(ISearchPath& searchPath, const GameId game)
@@ -70,27 +137,53 @@ AssetListReader::AssetListReader(ISearchPath& searchPath, const GameId game)
 }
 
 std::optional<AssetList> AssetListReader::ReadAssetList(const std::string& zoneName, const bool logMissing) const
+{
+    const auto content = ReadAssetListContent(zoneName, logMissing);
+    if (!content)
+        return std::nullopt;
+
+    return ParseAssetList(*content);
+}
+
+std::optional<std::string> AssetListReader::ReadAssetListContent(const std::string& zoneName, const bool logMissing) const
 {
     const auto assetListFileName = std::format("assetlist/{}.csv", zoneName);
     const auto assetListStream = m_search_path.Open(assetListFileName);
 
-    if (assetListStream.IsOpen())
+    if (!assetListStream.IsOpen())
     {
-        AssetList assetList;
-        const AssetListInputStream stream(*assetListStream.m_stream, m_game);
-        AssetListEntry entry;
+        if (logMissing)
+            std::cerr << std::format("Failed to open file for assetlist: {}\n", assetListFileName);
 
-        bool failure;
-        while (stream.NextEntry(entry, &failure))
-        {
-            assetList.m_entries.emplace_back(std::move(entry));
-        }
+        return std::nullopt;
+    }
+
+    std::ostringstream contentStream;
+    contentStream << assetListStream.m_stream->rdbuf();
+
+    return contentStream.str();
+}
 
-        if (!failure)
-            return assetList;
+std::optional<AssetList> AssetListReader::ParseAssetList(const std::string& content) const
+{
+    AssetList assetList;
+    const auto* assetNameResolver = IAssetNameResolver::GetResolverForGame(m_game);
+    if (ReadSimpleAssetList(content, *assetNameResolver, assetList))
+        return assetList;
+
+    assetList.m_entries.clear();
+    std::istringstream fallbackStream(content);
+    const AssetListInputStream stream(fallbackStream, m_game);
+    AssetListEntry entry;
+
+    bool failure;
+    while (stream.NextEntry(entry, &failure))
+    {
+        assetList.m_entries.emplace_back(std::move(entry));
     }
-    else if (logMissing)
-        std::cerr << std::format("Failed to open file for assetlist: {}\n", assetListFileName);
 
-    return std::nullopt;
+    if (failure)
+        return std::nullopt;
+
+    return assetList;
 }
@@ -14,6 +14,12 @@ public:
 
     std::optional<AssetList> ReadAssetList(const std::string& zoneName, bool logMissing = true) const;
 
+    /**
+     * \brief Reads the unparsed content of the asset list of a zone, e.g. to check whether it changed before parsing it.
+     */
+    std::optional<std::string> ReadAssetListContent(const std::string& zoneName, bool logMissing = true) const;
+    std::optional<AssetList> ParseAssetList(const std::string& content) const;
+
 private:
     ISearchPath& m_search_path;
     GameId m_game;
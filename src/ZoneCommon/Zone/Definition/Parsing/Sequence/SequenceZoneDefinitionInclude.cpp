@@ -25,7 +25,7 @@ void SequenceZoneDefinitionInclude::ProcessMatch(ZoneDefinitionParserState* stat
 
     const auto zoneDefinitionFileNameToInclude = std::format("{}.zone", inclusionName);
 
-    if (!state->m_underlying_stream.IncludeFile(zoneDefinitionFileNameToInclude))
+    if (!state->m_underlying_stream || !state->m_underlying_stream->IncludeFile(zoneDefinitionFileNameToInclude))
         throw ParsingException(inclusionNameToken.GetPos(), "Could not find zone definition with this filename");
 
     state->m_inclusions.emplace(inclusionName);
@@ -17,20 +17,6 @@ namespace
     constexpr auto METADATA_IPAK = "ipak";
     constexpr auto METADATA_IWD = "iwd";
 
-    std::optional<GameId> GetGameByName(const std::string& gameName)
-    {
-        auto upperGameName = gameName;
-        utils::MakeStringUpperCase(upperGameName);
-
-        for (auto i = 0u; i < static_cast<unsigned>(GameId::COUNT); i++)
-        {
-            if (upperGameName == GameId_Names[i])
-                return static_cast<GameId>(i);
-        }
-
-        return std::nullopt;
-    }
-
     enum class ProjectType : std::uint8_t
     {
         NONE,
@@ -61,6 +47,20 @@ namespace
     }
 } // namespace
 
+std::optional<GameId> SequenceZoneDefinitionMetaData::GetGameByName(const std::string& gameName)
+{
+    auto upperGameName = gameName;
+    utils::MakeStringUpperCase(upperGameName);
+
+    for (auto i = 0u; i < static_cast<unsigned>(GameId::COUNT); i++)
+    {
+        if (upperGameName == GameId_Names[i])
+            return static_cast<GameId>(i);
+    }
+
+    return std::nullopt;
+}
+
 SequenceZoneDefinitionMetaData::SequenceZoneDefinitionMetaData()
 {
     const ZoneDefinitionMatcherFactory create(this);
@@ -77,7 +77,7 @@ namespace
 {
     void ProcessMetaDataGame(ZoneDefinitionParserState* state, const ZoneDefinitionParserValue& valueToken, const std::string& value)
     {
-        const auto game = GetGameByName(value);
+        const auto game = SequenceZoneDefinitionMetaData::GetGameByName(value);
         if (!game)
             throw ParsingException(valueToken.GetPos(), "Unknown game name");
 
@@ -1,7 +1,11 @@
 #pragma once
 
+#include "Game/IGame.h"
 #include "Zone/Definition/Parsing/ZoneDefinitionParser.h"
 
+#include <optional>
+#include <string>
+
 class SequenceZoneDefinitionMetaData final : public ZoneDefinitionParser::sequence_t
 {
     static constexpr auto CAPTURE_KEY = 1;
@@ -12,4 +16,6 @@ protected:
 
 public:
     SequenceZoneDefinitionMetaData();
+
+    static std::optional<GameId> GetGameByName(const std::string& gameName);
 };
@@ -9,7 +9,7 @@
 
 ZoneDefinitionParser::ZoneDefinitionParser(
     ZoneDefinitionLexer* lexer, std::string targetName, ISearchPath& searchPath, IParserLineStream& underlyingStream, const std::optional<GameId> maybeGame)
-    : AbstractParser(lexer, std::make_unique<ZoneDefinitionParserState>(std::move(targetName), searchPath, underlyingStream))
+    : AbstractParser(lexer, std::make_unique<ZoneDefinitionParserState>(std::move(targetName), searchPath, &underlyingStream))
 {
     if (maybeGame)
         m_state->SetGame(*maybeGame);
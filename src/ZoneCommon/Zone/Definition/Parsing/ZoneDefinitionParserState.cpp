@@ -2,7 +2,7 @@
 
 #include <algorithm>
 
-ZoneDefinitionParserState::ZoneDefinitionParserState(std::string targetName, ISearchPath& searchPath, IParserLineStream& underlyingStream)
+ZoneDefinitionParserState::ZoneDefinitionParserState(std::string targetName, ISearchPath& searchPath, IParserLineStream* underlyingStream)
     : m_search_path(searchPath),
       m_underlying_stream(underlyingStream),
       m_asset_name_resolver(nullptr),
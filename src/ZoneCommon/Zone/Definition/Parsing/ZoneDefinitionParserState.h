@@ -13,7 +13,10 @@
 class ZoneDefinitionParserState
 {
 public:
-    ZoneDefinitionParserState(std::string targetName, ISearchPath& searchPath, IParserLineStream& underlyingStream);
+    /**
+     * \param underlyingStream The stream to include other zone definitions into or \c nullptr if the user of the state includes them itself.
+     */
+    ZoneDefinitionParserState(std::string targetName, ISearchPath& searchPath, IParserLineStream* underlyingStream);
 
     void SetGame(GameId game);
 
@@ -23,7 +26,7 @@ public:
     void Finalize();
 
     ISearchPath& m_search_path;
-    IParserLineStream& m_underlying_stream;
+    IParserLineStream* m_underlying_stream;
     std::unordered_set<std::string> m_inclusions;
 
     const IAssetNameResolver* m_asset_name_resolver;
@@ -0,0 +1,263 @@
+#include "ZoneDefinitionScanner.h"
+
+#include "Sequence/SequenceZoneDefinitionMetaData.h"
+#include "Utils/StringUtils.h"
+#include "Zone/AssetList/AssetListReader.h"
+
+#include <cctype>
+#include <format>
+
+namespace
+{
+    bool IsSpace(const char c)
+    {
+        return std::isspace(static_cast<unsigned char>(c)) != 0;
+    }
+
+    bool IsNonFieldCharacter(const char c)
+    {
+        return c == '\"' || c == '>' || c == '<' || c == ',';
+    }
+} // namespace
+
+ZoneDefinitionScanner::ZoneDefinitionScanner(std::string targetName, ISearchPath& searchPath, const std::optional<GameId> maybeGame)
+    : m_state(std::move(targetName), searchPath, nullptr)
+{
+    if (maybeGame)
+        m_state.SetGame(*maybeGame);
+}
+
+std::unique_ptr<ZoneDefinition> ZoneDefinitionScanner::Scan(const std::string& content)
+{
+    if (!ScanContent(content))
+        return nullptr;
+
+    m_state.Finalize();
+    return std::move(m_state.m_definition);
+}
+
+bool ZoneDefinitionScanner::ScanContent(const std::string& content)
+{
+    const std::string_view contentView(content);
+    auto lineStart = 0uz;
+    while (lineStart < contentView.size())
+    {
+        auto lineEnd = contentView.find('\n', lineStart);
+        if (lineEnd == std::string_view::npos)
+            lineEnd = contentView.size();
+
+        auto line = contentView.substr(lineStart, lineEnd - lineStart);
+        if (lineEnd < contentView.size() && !line.empty() && line.back() == '\r')
+            line.remove_suffix(1u);
+
+        if (!ScanLine(line))
+            return false;
+
+        lineStart = lineEnd + 1u;
+    }
+
+    return true;
+}
+
+bool ZoneDefinitionScanner::ScanLine(const std::string_view line)
+{
+    // Preprocessor directives, line continuations and carriage returns that do not end a line are left to the full parser
+    if (line.find('#') != std::string_view::npos || line.find('\r') != std::string_view::npos || (!line.empty() && line.back() == '\\'))
+        return false;
+
+    if (!TokenizeLine(line, m_tokens))
+        return false;
+
+    if (m_tokens.empty())
+        return true;
+
+    const auto isCharacter = [this](const size_t index, const char c)
+    {
+        return m_tokens[index].m_type == TokenType::CHARACTER && m_tokens[index].m_value[0] == c;
+    };
+    const auto isField = [this](const size_t index)
+    {
+        return m_tokens[index].m_type == TokenType::FIELD;
+    };
+    const auto isAssetName = [this](const size_t index)
+    {
+        return m_tokens[index].m_type == TokenType::FIELD || m_tokens[index].m_type == TokenType::STRING;
+    };
+    const auto tokenCount = m_tokens.size();
+
+    if (isCharacter(0, '>'))
+    {
+        if (tokenCount != 4u || !isField(1) || !isCharacter(2, ',') || !isField(3))
+            return false;
+
+        return ScanMetaData(std::string(m_tokens[1].m_value), std::string(m_tokens[3].m_value));
+    }
+
+    if (!isField(0) || tokenCount < 3u || !isCharacter(1, ','))
+        return false;
+
+    const auto& firstValue = m_tokens[0].m_value;
+    if (tokenCount == 3u && isField(2) && (firstValue == "include" || firstValue == "ignore" || firstValue == "assetlist" || firstValue == "build"))
+        return ScanKeyword(firstValue, std::string(m_tokens[2].m_value));
+
+    if (tokenCount == 3u && isAssetName(2))
+        return ScanEntry(std::string(firstValue), std::string(m_tokens[2].m_value), false);
+
+    if (tokenCount == 4u && isCharacter(2, ',') && isAssetName(3))
+        return ScanEntry(std::string(firstValue), std::string(m_tokens[3].m_value), true);
+
+    return false;
+}
+
+bool ZoneDefinitionScanner::TokenizeLine(std::string_view line, std::vector<Token>& tokens)
+{
+    tokens.clear();
+
+    // Remove line comments the same way the comment removing stream proxy does and leave block comments to the full parser
+    auto inString = false;
+    for (auto i = 0uz; i < line.size(); i++)
+    {
+        const auto c = line[i];
+        if (c == '"')
+            inString = !inString;
+        else if (!inString && c == '/' && i + 1u < line.size())
+        {
+            if (line[i + 1u] == '*')
+                return false;
+            if (line[i + 1u] == '/')
+            {
+                line = line.substr(0, i);
+                break;
+            }
+        }
+    }
+
+    auto pos = 0uz;
+    while (pos < line.size())
+    {
+        const auto c = line[pos];
+        if (c == '"')
+        {
+            const auto stringEnd = line.find('"', pos + 1u);
+            if (stringEnd == std::string_view::npos)
+                return false;
+
+            const auto value = line.substr(pos + 1u, stringEnd - pos - 1u);
+
+            // Escape sequences are interpreted differently by the comment removing proxy and the lexer
+            if (value.find('\\') != std::string_view::npos)
+                return false;
+
+            tokens.emplace_back(TokenType::STRING, value);
+            pos = stringEnd + 1u;
+        }
+        else if (c == '>' || c == '<' || c == ',')
+        {
+            tokens.emplace_back(TokenType::CHARACTER, line.substr(pos, 1u));
+            pos++;
+        }
+        else if (IsSpace(c))
+        {
+            pos++;
+        }
+        else
+        {
+            // Fields end at the next special character and do not include trailing whitespace
+            const auto fieldStart = pos;
+            auto fieldEnd = ++pos;
+            while (pos < line.size() && !IsNonFieldCharacter(line[pos]))
+            {
+                if (!IsSpace(line[pos]))
+                    fieldEnd = pos + 1u;
+                pos++;
+            }
+
+            tokens.emplace_back(TokenType::FIELD, line.substr(fieldStart, fieldEnd - fieldStart));
+        }
+    }
+
+    return true;
+}
+
+bool ZoneDefinitionScanner::ScanMetaData(std::string key, const std::string& value)
+{
+    utils::MakeStringLowerCase(key);
+
+    if (key == "game")
+    {
+        const auto game = SequenceZoneDefinitionMetaData::GetGameByName(value);
+        const auto previousGame = m_state.m_definition->m_game;
+        if (!game || (previousGame != GameId::COUNT && previousGame != *game))
+            return false;
+
+        m_state.SetGame(*game);
+    }
+    else if (key == "gdt")
+        m_state.m_definition->m_gdts.emplace_back(value);
+    else if (key == "name")
+        m_state.m_definition->m_name = value;
+    else if (key == "type")
+        return false; // Deprecated and warned about by the full parser
+    else if (key == "ipak")
+        m_state.StartIPak(value);
+    else if (key == "iwd")
+        m_state.StartIwd(value);
+    else
+        m_state.m_definition->m_properties.AddProperty(std::move(key), value);
+
+    return true;
+}
+
+bool ZoneDefinitionScanner::ScanKeyword(const std::string_view keyword, const std::string& value)
+{
+    if (keyword == "include")
+    {
+        if (m_state.m_inclusions.contains(value))
+            return false;
+
+        const auto includedContent = m_state.m_search_path.ReadFile(std::format("{}.zone", value));
+        if (!includedContent)
+            return false;
+
+        m_state.m_inclusions.emplace(value);
+        return ScanContent(*includedContent);
+    }
+
+    if (keyword == "ignore")
+    {
+        m_state.m_definition->m_ignores.emplace_back(value);
+        return true;
+    }
+
+    if (keyword == "assetlist")
+    {
+        if (m_state.m_definition->m_game == GameId::COUNT)
+            return false;
+
+        const AssetListReader assetListReader(m_state.m_search_path, m_state.m_definition->m_game);
+        auto maybeAssetList = assetListReader.ReadAssetList(value, false);
+        if (!maybeAssetList)
+            return false;
+
+        for (auto& assetListEntry : maybeAssetList->m_entries)
+            m_state.m_definition->m_assets.emplace_back(assetListEntry.m_type, std::move(assetListEntry.m_name), assetListEntry.m_is_reference);
+
+        return true;
+    }
+
+    m_state.m_definition->m_targets_to_build.emplace_back(value);
+    return true;
+}
+
+bool ZoneDefinitionScanner::ScanEntry(const std::string& typeName, std::string assetName, const bool isReference)
+{
+    if (!m_state.m_asset_name_resolver)
+        return false;
+
+    const auto maybeAssetType = m_state.m_asset_name_resolver->GetAssetTypeByName(typeName);
+    if (!maybeAssetType)
+        return false;
+
+    m_state.m_definition->m_assets.emplace_back(*maybeAssetType, std::move(assetName), isReference);
+    return true;
+}
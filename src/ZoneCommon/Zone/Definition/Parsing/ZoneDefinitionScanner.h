@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Game/IGame.h"
+#include "SearchPath/ISearchPath.h"
+#include "Zone/Definition/ZoneDefinition.h"
+#include "ZoneDefinitionParserState.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * \brief A single pass scanner for zone definitions that only consist of metadata, entries and the include, ignore, assetlist and build keywords,
+ * each on a line of their own.
+ * It produces the same definitions as \c ZoneDefinitionParser without running every token through the generic parser sequences.
+ * Whenever the scanner encounters anything else, like preprocessor directives, block comments or errors, it gives up so the full parser can be used.
+ */
+class ZoneDefinitionScanner
+{
+public:
+    ZoneDefinitionScanner(std::string targetName, ISearchPath& searchPath, std::optional<GameId> maybeGame = std::nullopt);
+
+    /**
+     * \brief Scans the content of a zone definition file including all zone definitions it includes.
+     * \return The scanned definition or \c nullptr if the definition requires the full parser.
+     */
+    std::unique_ptr<ZoneDefinition> Scan(const std::string& content);
+
+private:
+    enum class TokenType : std::uint8_t
+    {
+        CHARACTER,
+        FIELD,
+        STRING
+    };
+
+    class Token
+    {
+    public:
+        TokenType m_type;
+        std::string_view m_value;
+    };
+
+    bool ScanContent(const std::string& content);
+    bool ScanLine(std::string_view line);
+    static bool TokenizeLine(std::string_view line, std::vector<Token>& tokens);
+
+    bool ScanMetaData(std::string key, const std::string& value);
+    bool ScanKeyword(std::string_view keyword, const std::string& value);
+    bool ScanEntry(const std::string& typeName, std::string assetName, bool isReference);
+
+    ZoneDefinitionParserState m_state;
+    std::vector<Token> m_tokens;
+};
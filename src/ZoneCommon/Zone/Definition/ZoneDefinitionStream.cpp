@@ -6,20 +6,20 @@
 #include "Parsing/Impl/ParserSingleInputStream.h"
 #include "Zone/Definition/Parsing/ZoneDefinitionLexer.h"
 #include "Zone/Definition/Parsing/ZoneDefinitionParser.h"
+#include "Zone/Definition/Parsing/ZoneDefinitionScanner.h"
 
 #include <chrono>
 #include <format>
+#include <sstream>
 
 ZoneDefinitionInputStream::ZoneDefinitionInputStream(std::istream& stream, std::string targetName, std::string fileName, ISearchPath& searchPath)
     : SearchPathMultiInputStream(searchPath),
+      m_base_stream(stream),
       m_target_name(std::move(targetName)),
       m_file_name(std::move(fileName)),
       m_stream(nullptr),
       m_previously_set_game(std::nullopt)
 {
-    OpenBaseStream(stream);
-    SetupStreamProxies();
-    m_stream = m_open_streams.back().get();
 }
 
 bool ZoneDefinitionInputStream::OpenBaseStream(std::istream& stream)
@@ -46,18 +46,42 @@ std::unique_ptr<ZoneDefinition> ZoneDefinitionInputStream::ReadDefinition()
 {
     std::cout << std::format("Reading zone definition file: {}\n", m_file_name);
 
+    const auto start = std::chrono::steady_clock::now();
+
+    std::ostringstream contentStream;
+    contentStream << m_base_stream.rdbuf();
+    const auto content = contentStream.str();
+
+    // Most definitions only consist of plain entries that can be handled without the preprocessing stream proxies
+    ZoneDefinitionScanner scanner(m_target_name, m_search_path, m_previously_set_game);
+    auto definition = scanner.Scan(content);
+    if (!definition)
+        definition = ParseDefinition(content);
+
+    const auto end = std::chrono::steady_clock::now();
+
+    std::cout << std::format("Processing zone definition took {}ms\n", std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+
+    return definition;
+}
+
+std::unique_ptr<ZoneDefinition> ZoneDefinitionInputStream::ParseDefinition(const std::string& content)
+{
+    std::istringstream stream(content);
+    OpenBaseStream(stream);
+    SetupStreamProxies();
+
     const auto lexer = std::make_unique<ZoneDefinitionLexer>(m_stream);
     const auto parser = std::make_unique<ZoneDefinitionParser>(lexer.get(), m_target_name, m_search_path, *m_stream, m_previously_set_game);
 
-    const auto start = std::chrono::steady_clock::now();
     std::unique_ptr<ZoneDefinition> definition;
     if (parser->Parse())
         definition = parser->GetParsedValue();
-    const auto end = std::chrono::steady_clock::now();
 
-    std::cout << std::format("Processing zone definition took {}ms\n", std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+    m_stream = nullptr;
+    m_open_streams.clear();
 
-    return std::move(definition);
+    return definition;
 }
 
 ZoneDefinitionOutputStream::ZoneDefinitionOutputStream(std::ostream& stream)
@@ -19,9 +19,11 @@ public:
     std::unique_ptr<ZoneDefinition> ReadDefinition();
 
 private:
+    std::unique_ptr<ZoneDefinition> ParseDefinition(const std::string& content);
     bool OpenBaseStream(std::istream& stream);
     void SetupStreamProxies();
 
+    std::istream& m_base_stream;
     std::string m_target_name;
     std::string m_file_name;
     IParserLineStream* m_stream;
@@ -0,0 +1,191 @@
+#include "ReferenceZoneCache.h"
+
+#include <algorithm>
+#include <cassert>
+
+ReferenceZoneCache::Entry::Entry(std::string path)
+    : m_path(std::move(path)),
+      m_resident_size(0uz),
+      m_last_use(0u),
+      m_has_containers(false)
+{
+}
+
+ReferenceZoneCache::ReferenceZoneCache(load_zone_t loadZone, unload_zone_t unloadZone, has_containers_t hasContainers)
+    : m_load_zone(std::move(loadZone)),
+      m_unload_zone(std::move(unloadZone)),
+      m_has_containers(std::move(hasContainers)),
+      m_memory_budget(0uz),
+      m_use_counter(0u),
+      m_reload_count(0uz)
+{
+}
+
+void ReferenceZoneCache::SetMemoryBudget(const size_t memoryBudget)
+{
+    m_memory_budget = memoryBudget;
+}
+
+bool ReferenceZoneCache::AddZone(const std::string& zonePath)
+{
+    Entry entry(zonePath);
+    if (!Load(entry))
+        return false;
+
+    m_entries.emplace_back(std::move(entry));
+    return true;
+}
+
+bool ReferenceZoneCache::PrepareForZone(const Zone& zone)
+{
+    if (m_memory_budget == 0)
+        return true;
+
+    const auto referencedAssets = GetReferencedAssets(zone);
+
+    std::vector<bool> isNeeded(m_entries.size());
+    auto requiredSize = zone.GetMemory()->GetResidentSize();
+    for (auto i = 0uz; i < m_entries.size(); i++)
+    {
+        auto& entry = m_entries[i];
+        isNeeded[i] = ContainsAnyAsset(entry, referencedAssets);
+
+        // The size of unloaded zones is known from when they were loaded before
+        if (isNeeded[i] || entry.m_zone)
+            requiredSize += entry.m_resident_size;
+    }
+
+    // Unload zones before loading needed ones to not exceed the budget in between
+    while (requiredSize > m_memory_budget)
+    {
+        Entry* leastRecentlyUsed = nullptr;
+        for (auto i = 0uz; i < m_entries.size(); i++)
+        {
+            auto& entry = m_entries[i];
+            if (entry.m_zone && !isNeeded[i] && !entry.m_has_containers && (!leastRecentlyUsed || entry.m_last_use < leastRecentlyUsed->m_last_use))
+                leastRecentlyUsed = &entry;
+        }
+
+        // All loaded zones are needed or hold containers, the budget cannot be met
+        if (!leastRecentlyUsed)
+            break;
+
+        requiredSize -= leastRecentlyUsed->m_resident_size;
+        Unload(*leastRecentlyUsed);
+    }
+
+    for (auto i = 0uz; i < m_entries.size(); i++)
+    {
+        if (!isNeeded[i])
+            continue;
+
+        auto& entry = m_entries[i];
+        if (entry.m_zone)
+            entry.m_last_use = ++m_use_counter;
+        else if (!Load(entry))
+            return false;
+    }
+
+    return true;
+}
+
+void ReferenceZoneCache::UnloadAll()
+{
+    // Unload in reverse order of loading
+    for (auto i = m_entries.rbegin(); i != m_entries.rend(); ++i)
+    {
+        if (i->m_zone)
+            Unload(*i);
+    }
+
+    m_entries.clear();
+}
+
+size_t ReferenceZoneCache::GetResidentSize() const
+{
+    auto residentSize = 0uz;
+    for (const auto& entry : m_entries)
+    {
+        if (entry.m_zone)
+            residentSize += entry.m_resident_size;
+    }
+
+    return residentSize;
+}
+
+size_t ReferenceZoneCache::GetLoadedZoneCount() const
+{
+    return static_cast<size_t>(std::ranges::count_if(m_entries,
+                                                      [](const Entry& entry)
+                                                      {
+                                                          return entry.m_zone != nullptr;
+                                                      }));
+}
+
+size_t ReferenceZoneCache::GetReloadCount() const
+{
+    return m_reload_count;
+}
+
+bool ReferenceZoneCache::Load(Entry& entry)
+{
+    assert(!entry.m_zone);
+
+    auto zone = m_load_zone(entry.m_path);
+    if (!zone)
+        return false;
+
+    const auto isReload = !entry.m_asset_names_by_type.empty();
+    if (isReload)
+    {
+        m_reload_count++;
+    }
+    else
+    {
+        entry.m_asset_names_by_type.resize(zone->m_pools->GetAssetTypeCount());
+        for (const auto* asset : *zone->m_pools)
+        {
+            assert(static_cast<size_t>(asset->m_type) < entry.m_asset_names_by_type.size());
+            if (!asset->IsReference() && static_cast<size_t>(asset->m_type) < entry.m_asset_names_by_type.size())
+                entry.m_asset_names_by_type[asset->m_type].emplace(XAssetInfoGeneric::NormalizeAssetName(asset->m_name));
+        }
+    }
+
+    entry.m_resident_size = zone->GetMemory()->GetResidentSize();
+    entry.m_has_containers = m_has_containers(*zone);
+    entry.m_last_use = ++m_use_counter;
+    entry.m_zone = std::move(zone);
+
+    return true;
+}
+
+void ReferenceZoneCache::Unload(Entry& entry)
+{
+    assert(entry.m_zone);
+
+    m_unload_zone(std::move(entry.m_zone));
+    entry.m_zone = nullptr;
+}
+
+std::vector<ReferenceZoneCache::referenced_asset_t> ReferenceZoneCache::GetReferencedAssets(const Zone& zone)
+{
+    std::vector<referenced_asset_t> referencedAssets;
+    for (const auto* asset : *zone.m_pools)
+    {
+        // References are prefixed with a comma
+        if (asset->IsReference())
+            referencedAssets.emplace_back(asset->m_type, XAssetInfoGeneric::NormalizeAssetName(asset->m_name.substr(1)));
+    }
+
+    return referencedAssets;
+}
+
+bool ReferenceZoneCache::ContainsAnyAsset(const Entry& entry, const std::vector<referenced_asset_t>& assets)
+{
+    return std::ranges::any_of(assets,
+                               [&entry](const referenced_asset_t& asset)
+                               {
+                                   return static_cast<size_t>(asset.first) < entry.m_asset_names_by_type.size()
+                                          && entry.m_asset_names_by_type[asset.first].contains(asset.second);
+                               });
+}
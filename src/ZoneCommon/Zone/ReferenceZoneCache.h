@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Zone/Zone.h"
+#include "Zone/ZoneTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief Keeps the zones that are loaded as reference sources for the zones that are unlinked.
+ * Without a memory budget all zones stay loaded.
+ * With a memory budget, zones that do not contain assets referenced by the zone that is about to be unlinked are unloaded
+ * in least recently used order until the budget is met and are loaded again once a later zone references one of their assets.
+ * Zones that loaded containers are never unloaded early, since any later zone may read from their containers.
+ */
+class ReferenceZoneCache
+{
+public:
+    using load_zone_t = std::function<std::unique_ptr<Zone>(const std::string& zonePath)>;
+    using unload_zone_t = std::function<void(std::unique_ptr<Zone> zone)>;
+    using has_containers_t = std::function<bool(Zone& zone)>;
+
+    ReferenceZoneCache(load_zone_t loadZone, unload_zone_t unloadZone, has_containers_t hasContainers);
+
+    /**
+     * \param memoryBudget The maximum amount of bytes of zone memory to keep loaded or \c 0 for no limit.
+     */
+    void SetMemoryBudget(size_t memoryBudget);
+
+    bool AddZone(const std::string& zonePath);
+
+    /**
+     * \brief Makes sure all reference zones containing assets referenced by the specified zone are loaded
+     * and unloads other reference zones while the memory budget is exceeded.
+     * \param zone The zone that is about to be unlinked. Its memory counts towards the budget.
+     * \return \c true if all required zones are loaded, otherwise \c false
+     */
+    bool PrepareForZone(const Zone& zone);
+
+    void UnloadAll();
+
+    [[nodiscard]] size_t GetResidentSize() const;
+    [[nodiscard]] size_t GetLoadedZoneCount() const;
+    [[nodiscard]] size_t GetReloadCount() const;
+
+private:
+    class Entry
+    {
+    public:
+        std::string m_path;
+        std::unique_ptr<Zone> m_zone;
+        size_t m_resident_size;
+        uint64_t m_last_use;
+        bool m_has_containers;
+
+        // The normalized names of all assets of the zone, indexed by asset type, to know whether an unloaded zone is needed
+        std::vector<std::unordered_set<std::string>> m_asset_names_by_type;
+
+        explicit Entry(std::string path);
+    };
+
+    using referenced_asset_t = std::pair<asset_type_t, std::string>;
+
+    bool Load(Entry& entry);
+    void Unload(Entry& entry);
+    [[nodiscard]] static std::vector<referenced_asset_t> GetReferencedAssets(const Zone& zone);
+    [[nodiscard]] static bool ContainsAnyAsset(const Entry& entry, const std::vector<referenced_asset_t>& assets);
+
+    load_zone_t m_load_zone;
+    unload_zone_t m_unload_zone;
+    has_containers_t m_has_containers;
+    size_t m_memory_budget;
+    uint64_t m_use_counter;
+    size_t m_reload_count;
+
+    // Entries are kept in the order the zones were specified in to load them again in the same order
+    std::vector<Entry> m_entries;
+};
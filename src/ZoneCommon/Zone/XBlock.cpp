@@ -1,6 +1,9 @@
 #include "XBlock.h"
 
+#include "Utils/VirtualMemory.h"
+
 #include <cassert>
+#include <new>
 
 XBlock::XBlock(const std::string& name, const int index, const Type type)
 {
@@ -9,21 +12,29 @@ XBlock::XBlock(const std::string& name, const int index, const Type type)
     m_type = type;
     m_buffer = nullptr;
     m_buffer_size = 0;
+    m_used_size = 0;
 }
 
 XBlock::~XBlock()
 {
-    delete[] m_buffer;
+    utils::ReleaseVirtualMemory(m_buffer, m_buffer_size);
     m_buffer = nullptr;
 }
 
 void XBlock::Alloc(const size_t blockSize)
 {
-    delete[] m_buffer;
+    utils::ReleaseVirtualMemory(m_buffer, m_buffer_size);
+    m_used_size = 0;
 
     if (blockSize > 0)
     {
-        m_buffer = new uint8_t[blockSize];
+        m_buffer = static_cast<uint8_t*>(utils::ReserveVirtualMemory(blockSize));
+        if (m_buffer == nullptr)
+        {
+            m_buffer_size = 0;
+            throw std::bad_alloc();
+        }
+
         m_buffer_size = blockSize;
     }
     else
@@ -32,3 +43,8 @@ void XBlock::Alloc(const size_t blockSize)
         m_buffer_size = 0;
     }
 }
+
+void XBlock::Discard()
+{
+    utils::DiscardVirtualMemory(m_buffer, m_buffer_size);
+}
@@ -20,8 +20,21 @@ public:
     uint8_t* m_buffer;
     size_t m_buffer_size;
 
+    // The highest amount of bytes of the buffer that has been in use at once
+    size_t m_used_size;
+
     XBlock(const std::string& name, int index, Type type);
     ~XBlock();
 
+    /**
+     * \brief Allocates a zero-initialized buffer for the block.
+     * Physical memory is only committed once the buffer is accessed.
+     */
     void Alloc(size_t blockSize);
+
+    /**
+     * \brief Returns the physical memory of the buffer to the system when its content is not needed anymore.
+     * The buffer stays accessible but its content is undefined afterwards.
+     */
+    void Discard();
 };
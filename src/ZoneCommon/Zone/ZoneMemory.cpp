@@ -1,8 +1,26 @@
 #include "ZoneMemory.h"
 
+#include "Utils/VirtualMemory.h"
+
 ZoneMemory::ZoneMemory() = default;
 
 void ZoneMemory::AddBlock(std::unique_ptr<XBlock> block)
 {
     m_blocks.emplace_back(std::move(block));
 }
+
+const std::vector<std::unique_ptr<XBlock>>& ZoneMemory::GetBlocks() const
+{
+    return m_blocks;
+}
+
+size_t ZoneMemory::GetResidentSize() const
+{
+    auto residentSize = GetAllocatedSize();
+
+    // Temp blocks are discarded after loading and runtime blocks are never written, so only their committed pages count
+    for (const auto& block : m_blocks)
+        residentSize += utils::GetResidentVirtualMemorySize(block->m_buffer, block->m_buffer_size);
+
+    return residentSize;
+}
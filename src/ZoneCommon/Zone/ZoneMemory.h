@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Utils/ClassUtils.h"
 #include "Utils/MemoryManager.h"
 #include "Zone/XBlock.h"
 
@@ -14,4 +15,12 @@ public:
     ZoneMemory();
 
     void AddBlock(std::unique_ptr<XBlock> block);
+
+    _NODISCARD const std::vector<std::unique_ptr<XBlock>>& GetBlocks() const;
+
+    /**
+     * \brief Returns the amount of bytes of the zone that are backed by physical memory.
+     * This consists of all allocations and the pages of all blocks that are currently committed.
+     */
+    _NODISCARD size_t GetResidentSize() const;
 };
@@ -0,0 +1,139 @@
+#include "AssetDiffRecorder.h"
+
+#include <cassert>
+
+AssetDiffRecorder::AssetDiffRecorder(const Zone* zone)
+    : m_zone(zone)
+{
+}
+
+std::vector<AssetDiffRecord>& AssetDiffRecorder::GetRecords()
+{
+    return m_records;
+}
+
+void AssetDiffRecorder::PushPath(const char* memberName)
+{
+    m_path_lengths.push_back(m_path.size());
+    m_path = MakePath(memberName);
+}
+
+void AssetDiffRecorder::PushIndex(const size_t index)
+{
+    m_path_lengths.push_back(m_path.size());
+    m_path += '[';
+    m_path += std::to_string(index);
+    m_path += ']';
+}
+
+void AssetDiffRecorder::PopPath()
+{
+    assert(!m_path_lengths.empty());
+
+    m_path.resize(m_path_lengths.back());
+    m_path_lengths.pop_back();
+}
+
+std::string AssetDiffRecorder::MakePath(const char* memberName) const
+{
+    if (memberName == nullptr)
+        return m_path;
+
+    if (m_path.empty())
+        return memberName;
+
+    std::string path;
+    path.reserve(m_path.size() + 1 + std::char_traits<char>::length(memberName));
+    path += m_path;
+    path += '.';
+    path += memberName;
+
+    return path;
+}
+
+void AssetDiffRecorder::AddRecord(const char* memberName, std::string value)
+{
+    m_records.emplace_back(MakePath(memberName), std::move(value));
+}
+
+void AssetDiffRecorder::Record_Data(const char* memberName, const void* data, const size_t size)
+{
+    assert(data != nullptr || size == 0);
+
+    if (data == nullptr)
+        return;
+
+    AddRecord(memberName, std::string(static_cast<const char*>(data), size));
+}
+
+void AssetDiffRecorder::Record_Data(const char* memberName, const volatile void* data, const size_t size)
+{
+    Record_Data(memberName, const_cast<const void*>(data), size);
+}
+
+void AssetDiffRecorder::RecordArray_Data(const char* memberName, const void* data, const size_t elementSize, const size_t count)
+{
+    // Arrays of plain data are compared as a whole to not create a record for every element
+    Record_Data(memberName, data, elementSize * count);
+}
+
+void AssetDiffRecorder::Record_Value(const char* memberName, const int64_t value)
+{
+    AddRecord(memberName, std::to_string(value));
+}
+
+void AssetDiffRecorder::Record_String(const char* memberName, const char* str)
+{
+    if (str == nullptr)
+        return;
+
+    AddRecord(memberName, str);
+}
+
+void AssetDiffRecorder::RecordArray_String(const char* memberName, const char* const* strArray, const size_t count)
+{
+    assert(strArray != nullptr);
+
+    PushPath(memberName);
+    for (auto index = 0uz; index < count; index++)
+    {
+        PushIndex(index);
+        Record_String(nullptr, strArray[index]);
+        PopPath();
+    }
+    PopPath();
+}
+
+void AssetDiffRecorder::Record_ScriptString(const char* memberName, const scr_string_t scrString)
+{
+    // Script string indices differ between zones, so the strings themselves are compared
+    if (scrString >= m_zone->m_script_strings.Count())
+    {
+        AddRecord(memberName, std::to_string(scrString));
+        return;
+    }
+
+    auto isNull = false;
+    const auto& value = m_zone->m_script_strings.Value(scrString, isNull);
+    if (!isNull)
+        AddRecord(memberName, value);
+}
+
+void AssetDiffRecorder::RecordArray_ScriptString(const char* memberName, const scr_string_t* scrStringArray, const size_t count)
+{
+    assert(scrStringArray != nullptr);
+
+    PushPath(memberName);
+    for (auto index = 0uz; index < count; index++)
+    {
+        PushIndex(index);
+        Record_ScriptString(nullptr, scrStringArray[index]);
+        PopPath();
+    }
+    PopPath();
+}
+
+void AssetDiffRecorder::Record_AssetName(const char* memberName, const std::string& assetName)
+{
+    AddRecord(memberName, assetName);
+}
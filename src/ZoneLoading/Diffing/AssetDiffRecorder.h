@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Zone/Zone.h"
+#include "Zone/ZoneTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * \brief A value of an asset at a path of members and array indices, e.g. "textureTable[2].u.image".
+ * Values do not contain any pointers, so records of the same asset from different zones can be compared directly.
+ */
+class AssetDiffRecord
+{
+public:
+    std::string m_path;
+    std::string m_value;
+};
+
+/**
+ * \brief Base class for the generated classes that record all comparable values of an asset.
+ * Data of pointers is recorded instead of their addresses, strings and script strings by their content and referenced assets by their name.
+ */
+class AssetDiffRecorder
+{
+public:
+    [[nodiscard]] std::vector<AssetDiffRecord>& GetRecords();
+
+protected:
+    explicit AssetDiffRecorder(const Zone* zone);
+
+    void PushPath(const char* memberName);
+    void PushIndex(size_t index);
+    void PopPath();
+
+    // A member name of nullptr records the value at the current path
+    void Record_Data(const char* memberName, const void* data, size_t size);
+    // Some members are modified by the game at runtime and are therefore declared volatile
+    void Record_Data(const char* memberName, const volatile void* data, size_t size);
+    void RecordArray_Data(const char* memberName, const void* data, size_t elementSize, size_t count);
+    void Record_Value(const char* memberName, int64_t value);
+    void Record_String(const char* memberName, const char* str);
+    void RecordArray_String(const char* memberName, const char* const* strArray, size_t count);
+    void Record_ScriptString(const char* memberName, scr_string_t scrString);
+    void RecordArray_ScriptString(const char* memberName, const scr_string_t* scrStringArray, size_t count);
+    void Record_AssetName(const char* memberName, const std::string& assetName);
+
+    const Zone* m_zone;
+
+private:
+    std::string MakePath(const char* memberName) const;
+    void AddRecord(const char* memberName, std::string value);
+
+    std::string m_path;
+    std::vector<size_t> m_path_lengths;
+    std::vector<AssetDiffRecord> m_records;
+};
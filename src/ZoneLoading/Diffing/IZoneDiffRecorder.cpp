@@ -0,0 +1,27 @@
+#include "IZoneDiffRecorder.h"
+
+#include "Game/IW3/ZoneDiffRecorderIW3.h"
+#include "Game/IW4/ZoneDiffRecorderIW4.h"
+#include "Game/IW5/ZoneDiffRecorderIW5.h"
+#include "Game/T5/ZoneDiffRecorderT5.h"
+#include "Game/T6/ZoneDiffRecorderT6.h"
+
+#include <cassert>
+
+const IZoneDiffRecorder* IZoneDiffRecorder::GetZoneDiffRecorderForGame(GameId game)
+{
+    static const IZoneDiffRecorder* zoneDiffRecorders[static_cast<unsigned>(GameId::COUNT)]{
+        new IW3::ZoneDiffRecorder(),
+        new IW4::ZoneDiffRecorder(),
+        new IW5::ZoneDiffRecorder(),
+        new T5::ZoneDiffRecorder(),
+        new T6::ZoneDiffRecorder(),
+    };
+    static_assert(std::extent_v<decltype(zoneDiffRecorders)> == static_cast<unsigned>(GameId::COUNT));
+
+    assert(static_cast<unsigned>(game) < static_cast<unsigned>(GameId::COUNT));
+    const auto* result = zoneDiffRecorders[static_cast<unsigned>(game)];
+    assert(result);
+
+    return result;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "AssetDiffRecorder.h"
+#include "Game/IGame.h"
+#include "Pool/XAssetInfo.h"
+#include "Zone/Zone.h"
+
+#include <vector>
+
+class IZoneDiffRecorder
+{
+public:
+    IZoneDiffRecorder() = default;
+    virtual ~IZoneDiffRecorder() = default;
+    IZoneDiffRecorder(const IZoneDiffRecorder& other) = default;
+    IZoneDiffRecorder(IZoneDiffRecorder&& other) noexcept = default;
+    IZoneDiffRecorder& operator=(const IZoneDiffRecorder& other) = default;
+    IZoneDiffRecorder& operator=(IZoneDiffRecorder&& other) noexcept = default;
+
+    /**
+     * \brief Records all comparable values of a loaded asset. Can be called concurrently.
+     * \param zone The zone the asset was loaded from.
+     * \param asset The asset to record.
+     * \param records The records of the asset in the order they were walked.
+     * \return \c true if the asset type can be recorded, otherwise \c false
+     */
+    virtual bool RecordAsset(const Zone& zone, const XAssetInfoGeneric& asset, std::vector<AssetDiffRecord>& records) const = 0;
+
+    static const IZoneDiffRecorder* GetZoneDiffRecorderForGame(GameId game);
+};
@@ -0,0 +1,148 @@
+#include "ZoneDiff.h"
+
+#include "IZoneDiffRecorder.h"
+#include "Utils/Parallel.h"
+
+#include <algorithm>
+#include <cassert>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+    class AssetPair
+    {
+    public:
+        const XAssetInfoGeneric* m_old_asset;
+        const XAssetInfoGeneric* m_new_asset;
+    };
+
+    std::optional<AssetDiff> CompareAssetContent(const IZoneDiffRecorder& recorder, const Zone& oldZone, const Zone& newZone, const AssetPair& pair)
+    {
+        std::vector<AssetDiffRecord> oldRecords;
+        std::vector<AssetDiffRecord> newRecords;
+        if (!recorder.RecordAsset(oldZone, *pair.m_old_asset, oldRecords) || !recorder.RecordAsset(newZone, *pair.m_new_asset, newRecords))
+            return std::nullopt;
+
+        auto fields = ZoneDiff::CompareRecords(oldRecords, newRecords);
+        if (fields.empty())
+            return std::nullopt;
+
+        return AssetDiff{pair.m_new_asset->m_type, pair.m_new_asset->m_name, DiffChange::MODIFIED, std::move(fields)};
+    }
+} // namespace
+
+std::vector<AssetDiff> ZoneDiff::Compare(const Zone& oldZone, const Zone& newZone, const std::function<bool(asset_type_t assetType)>& compareContent)
+{
+    assert(oldZone.m_game == newZone.m_game);
+
+    std::unordered_map<asset_type_t, std::unordered_map<std::string_view, const XAssetInfoGeneric*>> newAssetsByType;
+    for (const auto* asset : *newZone.m_pools)
+        newAssetsByType[asset->m_type].emplace(asset->m_name, asset);
+
+    std::vector<AssetDiff> result;
+    std::vector<AssetPair> pairsToCompare;
+    for (const auto* oldAsset : *oldZone.m_pools)
+    {
+        auto& newAssets = newAssetsByType[oldAsset->m_type];
+        const auto newAsset = newAssets.find(oldAsset->m_name);
+        if (newAsset == newAssets.end())
+        {
+            result.emplace_back(oldAsset->m_type, oldAsset->m_name, DiffChange::REMOVED, std::vector<FieldDiff>());
+            continue;
+        }
+
+        // References only consist of their name, so there is no content to compare
+        if (compareContent(oldAsset->m_type) && !oldAsset->IsReference() && !newAsset->second->IsReference())
+            pairsToCompare.emplace_back(oldAsset, newAsset->second);
+
+        newAssets.erase(newAsset);
+    }
+
+    for (const auto& newAssets : newAssetsByType | std::views::values)
+    {
+        for (const auto* newAsset : newAssets | std::views::values)
+            result.emplace_back(newAsset->m_type, newAsset->m_name, DiffChange::ADDED, std::vector<FieldDiff>());
+    }
+
+    const auto* recorder = IZoneDiffRecorder::GetZoneDiffRecorderForGame(newZone.m_game->GetId());
+    std::vector<std::optional<AssetDiff>> modifiedAssets(pairsToCompare.size());
+    utils::ParallelFor(pairsToCompare.size(),
+                       [recorder, &oldZone, &newZone, &pairsToCompare, &modifiedAssets](const size_t index)
+                       {
+                           modifiedAssets[index] = CompareAssetContent(*recorder, oldZone, newZone, pairsToCompare[index]);
+                       });
+
+    for (auto& modifiedAsset : modifiedAssets)
+    {
+        if (modifiedAsset)
+            result.emplace_back(std::move(*modifiedAsset));
+    }
+
+    std::ranges::sort(result,
+                      [](const AssetDiff& lhs, const AssetDiff& rhs)
+                      {
+                          return std::tie(lhs.m_type, lhs.m_name) < std::tie(rhs.m_type, rhs.m_name);
+                      });
+
+    return result;
+}
+
+std::vector<FieldDiff> ZoneDiff::CompareRecords(const std::vector<AssetDiffRecord>& oldRecords, const std::vector<AssetDiffRecord>& newRecords)
+{
+    std::vector<FieldDiff> result;
+
+    // Most assets are unchanged and walked in the same order, so try comparing them record by record first
+    if (oldRecords.size() == newRecords.size())
+    {
+        auto sameLayout = true;
+        const auto recordCount = oldRecords.size();
+        for (auto i = 0uz; i < recordCount; i++)
+        {
+            if (oldRecords[i].m_path != newRecords[i].m_path)
+            {
+                sameLayout = false;
+                result.clear();
+                break;
+            }
+
+            if (oldRecords[i].m_value != newRecords[i].m_value)
+                result.emplace_back(newRecords[i].m_path, DiffChange::MODIFIED);
+        }
+
+        if (sameLayout)
+            return result;
+    }
+
+    std::unordered_map<std::string_view, const AssetDiffRecord*> oldRecordsByPath;
+    oldRecordsByPath.reserve(oldRecords.size());
+    for (const auto& oldRecord : oldRecords)
+        oldRecordsByPath.emplace(oldRecord.m_path, &oldRecord);
+
+    for (const auto& newRecord : newRecords)
+    {
+        const auto oldRecord = oldRecordsByPath.find(newRecord.m_path);
+        if (oldRecord == oldRecordsByPath.end())
+        {
+            result.emplace_back(newRecord.m_path, DiffChange::ADDED);
+            continue;
+        }
+
+        if (oldRecord->second->m_value != newRecord.m_value)
+            result.emplace_back(newRecord.m_path, DiffChange::MODIFIED);
+
+        oldRecordsByPath.erase(oldRecord);
+    }
+
+    for (const auto& oldRecord : oldRecords)
+    {
+        if (oldRecordsByPath.contains(oldRecord.m_path))
+            result.emplace_back(oldRecord.m_path, DiffChange::REMOVED);
+    }
+
+    return result;
+}
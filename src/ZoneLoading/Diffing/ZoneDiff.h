@@ -0,0 +1,55 @@
+#pragma once
+
+#include "AssetDiffRecorder.h"
+#include "Zone/Zone.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+enum class DiffChange : std::uint8_t
+{
+    ADDED,
+    REMOVED,
+    MODIFIED
+};
+
+class FieldDiff
+{
+public:
+    std::string m_path;
+    DiffChange m_change;
+};
+
+class AssetDiff
+{
+public:
+    asset_type_t m_type;
+    std::string m_name;
+    DiffChange m_change;
+
+    // The fields that differ when the asset was modified
+    std::vector<FieldDiff> m_fields;
+};
+
+class ZoneDiff
+{
+public:
+    /**
+     * \brief Compares the assets of two zones of the same game by their type and name.
+     * The content of assets that exist in both zones is compared concurrently using the generated diff recorders.
+     * \param oldZone The zone to compare against.
+     * \param newZone The zone whose changes should be found.
+     * \param compareContent A predicate that decides for each asset type whether the content of its assets is compared.
+     * Assets of other types are only checked for being added or removed, e.g. because they were only scanned when loading.
+     * \return All added, removed and modified assets ordered by asset type and name.
+     */
+    static std::vector<AssetDiff> Compare(const Zone& oldZone, const Zone& newZone, const std::function<bool(asset_type_t assetType)>& compareContent);
+
+    /**
+     * \brief Compares the records of two versions of the same asset by their path.
+     * \return The differing fields in the order they appear in the new records followed by removed fields in their old order.
+     */
+    static std::vector<FieldDiff> CompareRecords(const std::vector<AssetDiffRecord>& oldRecords, const std::vector<AssetDiffRecord>& newRecords);
+};
@@ -0,0 +1,81 @@
+#include "ZoneDiffRecorderIW3.h"
+
+#include "Game/IW3/IW3.h"
+#include "Game/IW3/XAssets/clipmap_t/clipmap_t_diff_db.h"
+#include "Game/IW3/XAssets/comworld/comworld_diff_db.h"
+#include "Game/IW3/XAssets/font_s/font_s_diff_db.h"
+#include "Game/IW3/XAssets/fxeffectdef/fxeffectdef_diff_db.h"
+#include "Game/IW3/XAssets/fximpacttable/fximpacttable_diff_db.h"
+#include "Game/IW3/XAssets/gameworldmp/gameworldmp_diff_db.h"
+#include "Game/IW3/XAssets/gameworldsp/gameworldsp_diff_db.h"
+#include "Game/IW3/XAssets/gfximage/gfximage_diff_db.h"
+#include "Game/IW3/XAssets/gfxlightdef/gfxlightdef_diff_db.h"
+#include "Game/IW3/XAssets/gfxworld/gfxworld_diff_db.h"
+#include "Game/IW3/XAssets/loadedsound/loadedsound_diff_db.h"
+#include "Game/IW3/XAssets/localizeentry/localizeentry_diff_db.h"
+#include "Game/IW3/XAssets/mapents/mapents_diff_db.h"
+#include "Game/IW3/XAssets/material/material_diff_db.h"
+#include "Game/IW3/XAssets/materialtechniqueset/materialtechniqueset_diff_db.h"
+#include "Game/IW3/XAssets/menudef_t/menudef_t_diff_db.h"
+#include "Game/IW3/XAssets/menulist/menulist_diff_db.h"
+#include "Game/IW3/XAssets/physpreset/physpreset_diff_db.h"
+#include "Game/IW3/XAssets/rawfile/rawfile_diff_db.h"
+#include "Game/IW3/XAssets/snd_alias_list_t/snd_alias_list_t_diff_db.h"
+#include "Game/IW3/XAssets/sndcurve/sndcurve_diff_db.h"
+#include "Game/IW3/XAssets/stringtable/stringtable_diff_db.h"
+#include "Game/IW3/XAssets/weapondef/weapondef_diff_db.h"
+#include "Game/IW3/XAssets/xanimparts/xanimparts_diff_db.h"
+#include "Game/IW3/XAssets/xmodel/xmodel_diff_db.h"
+
+#include <cassert>
+
+using namespace IW3;
+
+bool ZoneDiffRecorder::RecordAsset(const Zone& zone, const XAssetInfoGeneric& asset, std::vector<AssetDiffRecord>& records) const
+{
+#define RECORD_ASSET(type_index, typeName)                                                                                                                     \
+    case type_index:                                                                                                                                           \
+    {                                                                                                                                                          \
+        DiffRecorder_##typeName recorder(&zone);                                                                                                               \
+        recorder.Record(static_cast<typeName*>(asset.m_ptr));                                                                                                  \
+        records = std::move(recorder.GetRecords());                                                                                                            \
+        return true;                                                                                                                                           \
+    }
+
+    assert(asset.m_ptr != nullptr);
+
+    switch (asset.m_type)
+    {
+        RECORD_ASSET(ASSET_TYPE_PHYSPRESET, PhysPreset)
+        RECORD_ASSET(ASSET_TYPE_XANIMPARTS, XAnimParts)
+        RECORD_ASSET(ASSET_TYPE_XMODEL, XModel)
+        RECORD_ASSET(ASSET_TYPE_MATERIAL, Material)
+        RECORD_ASSET(ASSET_TYPE_TECHNIQUE_SET, MaterialTechniqueSet)
+        RECORD_ASSET(ASSET_TYPE_IMAGE, GfxImage)
+        RECORD_ASSET(ASSET_TYPE_SOUND, snd_alias_list_t)
+        RECORD_ASSET(ASSET_TYPE_SOUND_CURVE, SndCurve)
+        RECORD_ASSET(ASSET_TYPE_LOADED_SOUND, LoadedSound)
+        RECORD_ASSET(ASSET_TYPE_CLIPMAP, clipMap_t)
+        RECORD_ASSET(ASSET_TYPE_CLIPMAP_PVS, clipMap_t)
+        RECORD_ASSET(ASSET_TYPE_COMWORLD, ComWorld)
+        RECORD_ASSET(ASSET_TYPE_GAMEWORLD_SP, GameWorldSp)
+        RECORD_ASSET(ASSET_TYPE_GAMEWORLD_MP, GameWorldMp)
+        RECORD_ASSET(ASSET_TYPE_MAP_ENTS, MapEnts)
+        RECORD_ASSET(ASSET_TYPE_GFXWORLD, GfxWorld)
+        RECORD_ASSET(ASSET_TYPE_LIGHT_DEF, GfxLightDef)
+        RECORD_ASSET(ASSET_TYPE_FONT, Font_s)
+        RECORD_ASSET(ASSET_TYPE_MENULIST, MenuList)
+        RECORD_ASSET(ASSET_TYPE_MENU, menuDef_t)
+        RECORD_ASSET(ASSET_TYPE_LOCALIZE_ENTRY, LocalizeEntry)
+        RECORD_ASSET(ASSET_TYPE_WEAPON, WeaponDef)
+        RECORD_ASSET(ASSET_TYPE_FX, FxEffectDef)
+        RECORD_ASSET(ASSET_TYPE_IMPACT_FX, FxImpactTable)
+        RECORD_ASSET(ASSET_TYPE_RAWFILE, RawFile)
+        RECORD_ASSET(ASSET_TYPE_STRINGTABLE, StringTable)
+
+    default:
+        return false;
+    }
+
+#undef RECORD_ASSET
+}
@@ -37,6 +37,7 @@
 #include "Game/IW4/XAssets/xanimparts/xanimparts_load_db.h"
 #include "Game/IW4/XAssets/xmodel/xmodel_load_db.h"
 #include "Loading/Exception/UnsupportedAssetTypeException.h"
+#include "Utils/Tracing.h"
 
 #include <cassert>
 
@@ -44,7 +45,8 @@ using namespace IW4;
 
 ContentLoader::ContentLoader()
     : varXAsset(nullptr),
-      varScriptStringList(nullptr)
+      varScriptStringList(nullptr),
+      m_scan_only_asset_types(nullptr)
 {
 }
 
@@ -77,7 +79,9 @@ void ContentLoader::LoadXAsset(const bool atStreamStart) const
 #define LOAD_ASSET(type_index, typeName, headerEntry)                                                                                                          \
     case type_index:                                                                                                                                           \
     {                                                                                                                                                          \
+        const utils::TraceScope assetTrace("load_asset", #typeName);                                                                                           \
         Loader_##typeName loader(m_zone, m_stream);                                                                                                            \
+        loader.SetScanOnlyAssetTypes(*m_scan_only_asset_types);                                                                                                \
         loader.Load(&varXAsset->header.headerEntry);                                                                                                           \
         break;                                                                                                                                                 \
     }
@@ -153,10 +157,11 @@ void ContentLoader::LoadXAssetArray(const bool atStreamStart, const size_t count
     }
 }
 
-void ContentLoader::Load(Zone* zone, IZoneInputStream* stream)
+void ContentLoader::Load(Zone* zone, IZoneInputStream* stream, const std::vector<bool>& scanOnlyAssetTypes)
 {
     m_zone = zone;
     m_stream = stream;
+    m_scan_only_asset_types = &scanOnlyAssetTypes;
 
     m_stream->PushBlock(XFILE_BLOCK_VIRTUAL);
 
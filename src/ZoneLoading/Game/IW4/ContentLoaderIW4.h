@@ -11,7 +11,7 @@ namespace IW4
     public:
         ContentLoader();
 
-        void Load(Zone* zone, IZoneInputStream* stream) override;
+        void Load(Zone* zone, IZoneInputStream* stream, const std::vector<bool>& scanOnlyAssetTypes) override;
 
     private:
         void LoadScriptStringList(bool atStreamStart);
@@ -21,5 +21,6 @@ namespace IW4
 
         XAsset* varXAsset;
         ScriptStringList* varScriptStringList;
+        const std::vector<bool>* m_scan_only_asset_types;
     };
 } // namespace IW4
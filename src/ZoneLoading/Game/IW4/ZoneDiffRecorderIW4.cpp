@@ -0,0 +1,101 @@
+#include "ZoneDiffRecorderIW4.h"
+
+#include "Game/IW4/IW4.h"
+#include "Game/IW4/XAssets/addonmapents/addonmapents_diff_db.h"
+#include "Game/IW4/XAssets/clipmap_t/clipmap_t_diff_db.h"
+#include "Game/IW4/XAssets/comworld/comworld_diff_db.h"
+#include "Game/IW4/XAssets/font_s/font_s_diff_db.h"
+#include "Game/IW4/XAssets/fxeffectdef/fxeffectdef_diff_db.h"
+#include "Game/IW4/XAssets/fximpacttable/fximpacttable_diff_db.h"
+#include "Game/IW4/XAssets/fxworld/fxworld_diff_db.h"
+#include "Game/IW4/XAssets/gameworldmp/gameworldmp_diff_db.h"
+#include "Game/IW4/XAssets/gameworldsp/gameworldsp_diff_db.h"
+#include "Game/IW4/XAssets/gfximage/gfximage_diff_db.h"
+#include "Game/IW4/XAssets/gfxlightdef/gfxlightdef_diff_db.h"
+#include "Game/IW4/XAssets/gfxworld/gfxworld_diff_db.h"
+#include "Game/IW4/XAssets/leaderboarddef/leaderboarddef_diff_db.h"
+#include "Game/IW4/XAssets/loadedsound/loadedsound_diff_db.h"
+#include "Game/IW4/XAssets/localizeentry/localizeentry_diff_db.h"
+#include "Game/IW4/XAssets/mapents/mapents_diff_db.h"
+#include "Game/IW4/XAssets/material/material_diff_db.h"
+#include "Game/IW4/XAssets/materialpixelshader/materialpixelshader_diff_db.h"
+#include "Game/IW4/XAssets/materialtechniqueset/materialtechniqueset_diff_db.h"
+#include "Game/IW4/XAssets/materialvertexdeclaration/materialvertexdeclaration_diff_db.h"
+#include "Game/IW4/XAssets/materialvertexshader/materialvertexshader_diff_db.h"
+#include "Game/IW4/XAssets/menudef_t/menudef_t_diff_db.h"
+#include "Game/IW4/XAssets/menulist/menulist_diff_db.h"
+#include "Game/IW4/XAssets/physcollmap/physcollmap_diff_db.h"
+#include "Game/IW4/XAssets/physpreset/physpreset_diff_db.h"
+#include "Game/IW4/XAssets/rawfile/rawfile_diff_db.h"
+#include "Game/IW4/XAssets/snd_alias_list_t/snd_alias_list_t_diff_db.h"
+#include "Game/IW4/XAssets/sndcurve/sndcurve_diff_db.h"
+#include "Game/IW4/XAssets/stringtable/stringtable_diff_db.h"
+#include "Game/IW4/XAssets/structureddatadefset/structureddatadefset_diff_db.h"
+#include "Game/IW4/XAssets/tracerdef/tracerdef_diff_db.h"
+#include "Game/IW4/XAssets/vehicledef/vehicledef_diff_db.h"
+#include "Game/IW4/XAssets/weaponcompletedef/weaponcompletedef_diff_db.h"
+#include "Game/IW4/XAssets/xanimparts/xanimparts_diff_db.h"
+#include "Game/IW4/XAssets/xmodel/xmodel_diff_db.h"
+
+#include <cassert>
+
+using namespace IW4;
+
+bool ZoneDiffRecorder::RecordAsset(const Zone& zone, const XAssetInfoGeneric& asset, std::vector<AssetDiffRecord>& records) const
+{
+#define RECORD_ASSET(type_index, typeName)                                                                                                                     \
+    case type_index:                                                                                                                                           \
+    {                                                                                                                                                          \
+        DiffRecorder_##typeName recorder(&zone);                                                                                                               \
+        recorder.Record(static_cast<typeName*>(asset.m_ptr));                                                                                                  \
+        records = std::move(recorder.GetRecords());                                                                                                            \
+        return true;                                                                                                                                           \
+    }
+
+    assert(asset.m_ptr != nullptr);
+
+    switch (asset.m_type)
+    {
+        RECORD_ASSET(ASSET_TYPE_PHYSPRESET, PhysPreset)
+        RECORD_ASSET(ASSET_TYPE_PHYSCOLLMAP, PhysCollmap)
+        RECORD_ASSET(ASSET_TYPE_XANIMPARTS, XAnimParts)
+        RECORD_ASSET(ASSET_TYPE_XMODEL, XModel)
+        RECORD_ASSET(ASSET_TYPE_MATERIAL, Material)
+        RECORD_ASSET(ASSET_TYPE_PIXELSHADER, MaterialPixelShader)
+        RECORD_ASSET(ASSET_TYPE_VERTEXSHADER, MaterialVertexShader)
+        RECORD_ASSET(ASSET_TYPE_VERTEXDECL, MaterialVertexDeclaration)
+        RECORD_ASSET(ASSET_TYPE_TECHNIQUE_SET, MaterialTechniqueSet)
+        RECORD_ASSET(ASSET_TYPE_IMAGE, GfxImage)
+        RECORD_ASSET(ASSET_TYPE_SOUND, snd_alias_list_t)
+        RECORD_ASSET(ASSET_TYPE_SOUND_CURVE, SndCurve)
+        RECORD_ASSET(ASSET_TYPE_LOADED_SOUND, LoadedSound)
+        RECORD_ASSET(ASSET_TYPE_CLIPMAP_SP, clipMap_t)
+        RECORD_ASSET(ASSET_TYPE_CLIPMAP_MP, clipMap_t)
+        RECORD_ASSET(ASSET_TYPE_COMWORLD, ComWorld)
+        RECORD_ASSET(ASSET_TYPE_GAMEWORLD_SP, GameWorldSp)
+        RECORD_ASSET(ASSET_TYPE_GAMEWORLD_MP, GameWorldMp)
+        RECORD_ASSET(ASSET_TYPE_MAP_ENTS, MapEnts)
+        RECORD_ASSET(ASSET_TYPE_FXWORLD, FxWorld)
+        RECORD_ASSET(ASSET_TYPE_GFXWORLD, GfxWorld)
+        RECORD_ASSET(ASSET_TYPE_LIGHT_DEF, GfxLightDef)
+        RECORD_ASSET(ASSET_TYPE_FONT, Font_s)
+        RECORD_ASSET(ASSET_TYPE_MENULIST, MenuList)
+        RECORD_ASSET(ASSET_TYPE_MENU, menuDef_t)
+        RECORD_ASSET(ASSET_TYPE_LOCALIZE_ENTRY, LocalizeEntry)
+        RECORD_ASSET(ASSET_TYPE_WEAPON, WeaponCompleteDef)
+        RECORD_ASSET(ASSET_TYPE_FX, FxEffectDef)
+        RECORD_ASSET(ASSET_TYPE_IMPACT_FX, FxImpactTable)
+        RECORD_ASSET(ASSET_TYPE_RAWFILE, RawFile)
+        RECORD_ASSET(ASSET_TYPE_STRINGTABLE, StringTable)
+        RECORD_ASSET(ASSET_TYPE_LEADERBOARD, LeaderboardDef)
+        RECORD_ASSET(ASSET_TYPE_STRUCTURED_DATA_DEF, StructuredDataDefSet)
+        RECORD_ASSET(ASSET_TYPE_TRACER, TracerDef)
+        RECORD_ASSET(ASSET_TYPE_VEHICLE, VehicleDef)
+        RECORD_ASSET(ASSET_TYPE_ADDON_MAP_ENTS, AddonMapEnts)
+
+    default:
+        return false;
+    }
+
+#undef RECORD_ASSET
+}
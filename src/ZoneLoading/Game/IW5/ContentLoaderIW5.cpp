@@ -42,6 +42,7 @@
 #include "Game/IW5/XAssets/xmodel/xmodel_load_db.h"
 #include "Game/IW5/XAssets/xmodelsurfs/xmodelsurfs_load_db.h"
 #include "Loading/Exception/UnsupportedAssetTypeException.h"
+#include "Utils/Tracing.h"
 
 #include <cassert>
 
@@ -49,7 +50,8 @@ using namespace IW5;
 
 ContentLoader::ContentLoader()
     : varXAsset(nullptr),
-      varScriptStringList(nullptr)
+      varScriptStringList(nullptr),
+      m_scan_only_asset_types(nullptr)
 {
 }
 
@@ -82,7 +84,9 @@ void ContentLoader::LoadXAsset(const bool atStreamStart) const
 #define LOAD_ASSET(type_index, typeName, headerEntry)                                                                                                          \
     case type_index:                                                                                                                                           \
     {                                                                                                                                                          \
+        const utils::TraceScope assetTrace("load_asset", #typeName);                                                                                           \
         Loader_##typeName loader(m_zone, m_stream);                                                                                                            \
+        loader.SetScanOnlyAssetTypes(*m_scan_only_asset_types);                                                                                                \
         loader.Load(&varXAsset->header.headerEntry);                                                                                                           \
         break;                                                                                                                                                 \
     }
@@ -162,10 +166,11 @@ void ContentLoader::LoadXAssetArray(const bool atStreamStart, const size_t count
     }
 }
 
-void ContentLoader::Load(Zone* zone, IZoneInputStream* stream)
+void ContentLoader::Load(Zone* zone, IZoneInputStream* stream, const std::vector<bool>& scanOnlyAssetTypes)
 {
     m_zone = zone;
     m_stream = stream;
+    m_scan_only_asset_types = &scanOnlyAssetTypes;
 
     m_stream->PushBlock(XFILE_BLOCK_VIRTUAL);
 
@@ -9,6 +9,7 @@ namespace IW5
     {
         XAsset* varXAsset;
         ScriptStringList* varScriptStringList;
+        const std::vector<bool>* m_scan_only_asset_types;
 
         void LoadScriptStringList(bool atStreamStart);
 
@@ -18,6 +19,6 @@ namespace IW5
     public:
         ContentLoader();
 
-        void Load(Zone* zone, IZoneInputStream* stream) override;
+        void Load(Zone* zone, IZoneInputStream* stream, const std::vector<bool>& scanOnlyAssetTypes) override;
     };
 } // namespace IW5
@@ -0,0 +1,110 @@
+#include "ZoneDiffRecorderIW5.h"
+
+#include "Game/IW5/IW5.h"
+#include "Game/IW5/XAssets/addonmapents/addonmapents_diff_db.h"
+#include "Game/IW5/XAssets/clipmap_t/clipmap_t_diff_db.h"
+#include "Game/IW5/XAssets/comworld/comworld_diff_db.h"
+#include "Game/IW5/XAssets/font_s/font_s_diff_db.h"
+#include "Game/IW5/XAssets/fxeffectdef/fxeffectdef_diff_db.h"
+#include "Game/IW5/XAssets/fximpacttable/fximpacttable_diff_db.h"
+#include "Game/IW5/XAssets/fxworld/fxworld_diff_db.h"
+#include "Game/IW5/XAssets/gfximage/gfximage_diff_db.h"
+#include "Game/IW5/XAssets/gfxlightdef/gfxlightdef_diff_db.h"
+#include "Game/IW5/XAssets/gfxworld/gfxworld_diff_db.h"
+#include "Game/IW5/XAssets/glassworld/glassworld_diff_db.h"
+#include "Game/IW5/XAssets/leaderboarddef/leaderboarddef_diff_db.h"
+#include "Game/IW5/XAssets/loadedsound/loadedsound_diff_db.h"
+#include "Game/IW5/XAssets/localizeentry/localizeentry_diff_db.h"
+#include "Game/IW5/XAssets/mapents/mapents_diff_db.h"
+#include "Game/IW5/XAssets/material/material_diff_db.h"
+#include "Game/IW5/XAssets/materialpixelshader/materialpixelshader_diff_db.h"
+#include "Game/IW5/XAssets/materialtechniqueset/materialtechniqueset_diff_db.h"
+#include "Game/IW5/XAssets/materialvertexdeclaration/materialvertexdeclaration_diff_db.h"
+#include "Game/IW5/XAssets/materialvertexshader/materialvertexshader_diff_db.h"
+#include "Game/IW5/XAssets/menudef_t/menudef_t_diff_db.h"
+#include "Game/IW5/XAssets/menulist/menulist_diff_db.h"
+#include "Game/IW5/XAssets/pathdata/pathdata_diff_db.h"
+#include "Game/IW5/XAssets/physcollmap/physcollmap_diff_db.h"
+#include "Game/IW5/XAssets/physpreset/physpreset_diff_db.h"
+#include "Game/IW5/XAssets/rawfile/rawfile_diff_db.h"
+#include "Game/IW5/XAssets/scriptfile/scriptfile_diff_db.h"
+#include "Game/IW5/XAssets/snd_alias_list_t/snd_alias_list_t_diff_db.h"
+#include "Game/IW5/XAssets/sndcurve/sndcurve_diff_db.h"
+#include "Game/IW5/XAssets/stringtable/stringtable_diff_db.h"
+#include "Game/IW5/XAssets/structureddatadefset/structureddatadefset_diff_db.h"
+#include "Game/IW5/XAssets/surfacefxtable/surfacefxtable_diff_db.h"
+#include "Game/IW5/XAssets/tracerdef/tracerdef_diff_db.h"
+#include "Game/IW5/XAssets/vehicledef/vehicledef_diff_db.h"
+#include "Game/IW5/XAssets/vehicletrack/vehicletrack_diff_db.h"
+#include "Game/IW5/XAssets/weaponattachment/weaponattachment_diff_db.h"
+#include "Game/IW5/XAssets/weaponcompletedef/weaponcompletedef_diff_db.h"
+#include "Game/IW5/XAssets/xanimparts/xanimparts_diff_db.h"
+#include "Game/IW5/XAssets/xmodel/xmodel_diff_db.h"
+#include "Game/IW5/XAssets/xmodelsurfs/xmodelsurfs_diff_db.h"
+
+#include <cassert>
+
+using namespace IW5;
+
+bool ZoneDiffRecorder::RecordAsset(const Zone& zone, const XAssetInfoGeneric& asset, std::vector<AssetDiffRecord>& records) const
+{
+#define RECORD_ASSET(type_index, typeName)                                                                                                                     \
+    case type_index:                                                                                                                                           \
+    {                                                                                                                                                          \
+        DiffRecorder_##typeName recorder(&zone);                                                                                                               \
+        recorder.Record(static_cast<typeName*>(asset.m_ptr));                                                                                                  \
+        records = std::move(recorder.GetRecords());                                                                                                            \
+        return true;                                                                                                                                           \
+    }
+
+    assert(asset.m_ptr != nullptr);
+
+    switch (asset.m_type)
+    {
+        RECORD_ASSET(ASSET_TYPE_PHYSPRESET, PhysPreset)
+        RECORD_ASSET(ASSET_TYPE_PHYSCOLLMAP, PhysCollmap)
+        RECORD_ASSET(ASSET_TYPE_XANIMPARTS, XAnimParts)
+        RECORD_ASSET(ASSET_TYPE_XMODEL_SURFS, XModelSurfs)
+        RECORD_ASSET(ASSET_TYPE_XMODEL, XModel)
+        RECORD_ASSET(ASSET_TYPE_MATERIAL, Material)
+        RECORD_ASSET(ASSET_TYPE_PIXELSHADER, MaterialPixelShader)
+        RECORD_ASSET(ASSET_TYPE_VERTEXSHADER, MaterialVertexShader)
+        RECORD_ASSET(ASSET_TYPE_VERTEXDECL, MaterialVertexDeclaration)
+        RECORD_ASSET(ASSET_TYPE_TECHNIQUE_SET, MaterialTechniqueSet)
+        RECORD_ASSET(ASSET_TYPE_IMAGE, GfxImage)
+        RECORD_ASSET(ASSET_TYPE_SOUND, snd_alias_list_t)
+        RECORD_ASSET(ASSET_TYPE_SOUND_CURVE, SndCurve)
+        RECORD_ASSET(ASSET_TYPE_LOADED_SOUND, LoadedSound)
+        RECORD_ASSET(ASSET_TYPE_CLIPMAP, clipMap_t)
+        RECORD_ASSET(ASSET_TYPE_COMWORLD, ComWorld)
+        RECORD_ASSET(ASSET_TYPE_GLASSWORLD, GlassWorld)
+        RECORD_ASSET(ASSET_TYPE_PATHDATA, PathData)
+        RECORD_ASSET(ASSET_TYPE_VEHICLE_TRACK, VehicleTrack)
+        RECORD_ASSET(ASSET_TYPE_MAP_ENTS, MapEnts)
+        RECORD_ASSET(ASSET_TYPE_FXWORLD, FxWorld)
+        RECORD_ASSET(ASSET_TYPE_GFXWORLD, GfxWorld)
+        RECORD_ASSET(ASSET_TYPE_LIGHT_DEF, GfxLightDef)
+        RECORD_ASSET(ASSET_TYPE_FONT, Font_s)
+        RECORD_ASSET(ASSET_TYPE_MENULIST, MenuList)
+        RECORD_ASSET(ASSET_TYPE_MENU, menuDef_t)
+        RECORD_ASSET(ASSET_TYPE_LOCALIZE_ENTRY, LocalizeEntry)
+        RECORD_ASSET(ASSET_TYPE_ATTACHMENT, WeaponAttachment)
+        RECORD_ASSET(ASSET_TYPE_WEAPON, WeaponCompleteDef)
+        RECORD_ASSET(ASSET_TYPE_FX, FxEffectDef)
+        RECORD_ASSET(ASSET_TYPE_IMPACT_FX, FxImpactTable)
+        RECORD_ASSET(ASSET_TYPE_SURFACE_FX, SurfaceFxTable)
+        RECORD_ASSET(ASSET_TYPE_RAWFILE, RawFile)
+        RECORD_ASSET(ASSET_TYPE_SCRIPTFILE, ScriptFile)
+        RECORD_ASSET(ASSET_TYPE_STRINGTABLE, StringTable)
+        RECORD_ASSET(ASSET_TYPE_LEADERBOARD, LeaderboardDef)
+        RECORD_ASSET(ASSET_TYPE_STRUCTURED_DATA_DEF, StructuredDataDefSet)
+        RECORD_ASSET(ASSET_TYPE_TRACER, TracerDef)
+        RECORD_ASSET(ASSET_TYPE_VEHICLE, VehicleDef)
+        RECORD_ASSET(ASSET_TYPE_ADDON_MAP_ENTS, AddonMapEnts)
+
+    default:
+        return false;
+    }
+
+#undef RECORD_ASSET
+}
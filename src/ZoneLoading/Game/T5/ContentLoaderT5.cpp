@@ -34,6 +34,7 @@
 #include "Game/T5/XAssets/xglobals/xglobals_load_db.h"
 #include "Game/T5/XAssets/xmodel/xmodel_load_db.h"
 #include "Loading/Exception/UnsupportedAssetTypeException.h"
+#include "Utils/Tracing.h"
 
 #include <cassert>
 
@@ -41,7 +42,8 @@ using namespace T5;
 
 ContentLoader::ContentLoader()
     : varXAsset(nullptr),
-      varScriptStringList(nullptr)
+      varScriptStringList(nullptr),
+      m_scan_only_asset_types(nullptr)
 {
 }
 
@@ -74,7 +76,9 @@ void ContentLoader::LoadXAsset(const bool atStreamStart) const
 #define LOAD_ASSET(type_index, typeName, headerEntry)                                                                                                          \
     case type_index:                                                                                                                                           \
     {                                                                                                                                                          \
+        const utils::TraceScope assetTrace("load_asset", #typeName);                                                                                           \
         Loader_##typeName loader(m_zone, m_stream);                                                                                                            \
+        loader.SetScanOnlyAssetTypes(*m_scan_only_asset_types);                                                                                                \
         loader.Load(&varXAsset->header.headerEntry);                                                                                                           \
         break;                                                                                                                                                 \
     }
@@ -146,10 +150,11 @@ void ContentLoader::LoadXAssetArray(const bool atStreamStart, const size_t count
     }
 }
 
-void ContentLoader::Load(Zone* zone, IZoneInputStream* stream)
+void ContentLoader::Load(Zone* zone, IZoneInputStream* stream, const std::vector<bool>& scanOnlyAssetTypes)
 {
     m_zone = zone;
     m_stream = stream;
+    m_scan_only_asset_types = &scanOnlyAssetTypes;
 
     m_stream->PushBlock(XFILE_BLOCK_VIRTUAL);
 
@@ -0,0 +1,95 @@
+#include "ZoneDiffRecorderT5.h"
+
+#include "Game/T5/T5.h"
+#include "Game/T5/XAssets/clipmap_t/clipmap_t_diff_db.h"
+#include "Game/T5/XAssets/comworld/comworld_diff_db.h"
+#include "Game/T5/XAssets/ddlroot_t/ddlroot_t_diff_db.h"
+#include "Game/T5/XAssets/destructibledef/destructibledef_diff_db.h"
+#include "Game/T5/XAssets/emblemset/emblemset_diff_db.h"
+#include "Game/T5/XAssets/font_s/font_s_diff_db.h"
+#include "Game/T5/XAssets/fxeffectdef/fxeffectdef_diff_db.h"
+#include "Game/T5/XAssets/fximpacttable/fximpacttable_diff_db.h"
+#include "Game/T5/XAssets/gameworldmp/gameworldmp_diff_db.h"
+#include "Game/T5/XAssets/gameworldsp/gameworldsp_diff_db.h"
+#include "Game/T5/XAssets/gfximage/gfximage_diff_db.h"
+#include "Game/T5/XAssets/gfxlightdef/gfxlightdef_diff_db.h"
+#include "Game/T5/XAssets/gfxworld/gfxworld_diff_db.h"
+#include "Game/T5/XAssets/glasses/glasses_diff_db.h"
+#include "Game/T5/XAssets/localizeentry/localizeentry_diff_db.h"
+#include "Game/T5/XAssets/mapents/mapents_diff_db.h"
+#include "Game/T5/XAssets/material/material_diff_db.h"
+#include "Game/T5/XAssets/materialtechniqueset/materialtechniqueset_diff_db.h"
+#include "Game/T5/XAssets/menudef_t/menudef_t_diff_db.h"
+#include "Game/T5/XAssets/menulist/menulist_diff_db.h"
+#include "Game/T5/XAssets/packindex/packindex_diff_db.h"
+#include "Game/T5/XAssets/physconstraints/physconstraints_diff_db.h"
+#include "Game/T5/XAssets/physpreset/physpreset_diff_db.h"
+#include "Game/T5/XAssets/rawfile/rawfile_diff_db.h"
+#include "Game/T5/XAssets/sndbank/sndbank_diff_db.h"
+#include "Game/T5/XAssets/snddriverglobals/snddriverglobals_diff_db.h"
+#include "Game/T5/XAssets/sndpatch/sndpatch_diff_db.h"
+#include "Game/T5/XAssets/stringtable/stringtable_diff_db.h"
+#include "Game/T5/XAssets/weaponvariantdef/weaponvariantdef_diff_db.h"
+#include "Game/T5/XAssets/xanimparts/xanimparts_diff_db.h"
+#include "Game/T5/XAssets/xglobals/xglobals_diff_db.h"
+#include "Game/T5/XAssets/xmodel/xmodel_diff_db.h"
+
+#include <cassert>
+
+using namespace T5;
+
+bool ZoneDiffRecorder::RecordAsset(const Zone& zone, const XAssetInfoGeneric& asset, std::vector<AssetDiffRecord>& records) const
+{
+#define RECORD_ASSET(type_index, typeName)                                                                                                                     \
+    case type_index:                                                                                                                                           \
+    {                                                                                                                                                          \
+        DiffRecorder_##typeName recorder(&zone);                                                                                                               \
+        recorder.Record(static_cast<typeName*>(asset.m_ptr));                                                                                                  \
+        records = std::move(recorder.GetRecords());                                                                                                            \
+        return true;                                                                                                                                           \
+    }
+
+    assert(asset.m_ptr != nullptr);
+
+    switch (asset.m_type)
+    {
+        RECORD_ASSET(ASSET_TYPE_PHYSPRESET, PhysPreset)
+        RECORD_ASSET(ASSET_TYPE_PHYSCONSTRAINTS, PhysConstraints)
+        RECORD_ASSET(ASSET_TYPE_DESTRUCTIBLEDEF, DestructibleDef)
+        RECORD_ASSET(ASSET_TYPE_XANIMPARTS, XAnimParts)
+        RECORD_ASSET(ASSET_TYPE_XMODEL, XModel)
+        RECORD_ASSET(ASSET_TYPE_MATERIAL, Material)
+        RECORD_ASSET(ASSET_TYPE_TECHNIQUE_SET, MaterialTechniqueSet)
+        RECORD_ASSET(ASSET_TYPE_IMAGE, GfxImage)
+        RECORD_ASSET(ASSET_TYPE_SOUND, SndBank)
+        RECORD_ASSET(ASSET_TYPE_SOUND_PATCH, SndPatch)
+        RECORD_ASSET(ASSET_TYPE_CLIPMAP, clipMap_t)
+        RECORD_ASSET(ASSET_TYPE_CLIPMAP_PVS, clipMap_t)
+        RECORD_ASSET(ASSET_TYPE_COMWORLD, ComWorld)
+        RECORD_ASSET(ASSET_TYPE_GAMEWORLD_SP, GameWorldSp)
+        RECORD_ASSET(ASSET_TYPE_GAMEWORLD_MP, GameWorldMp)
+        RECORD_ASSET(ASSET_TYPE_MAP_ENTS, MapEnts)
+        RECORD_ASSET(ASSET_TYPE_GFXWORLD, GfxWorld)
+        RECORD_ASSET(ASSET_TYPE_LIGHT_DEF, GfxLightDef)
+        RECORD_ASSET(ASSET_TYPE_FONT, Font_s)
+        RECORD_ASSET(ASSET_TYPE_MENULIST, MenuList)
+        RECORD_ASSET(ASSET_TYPE_MENU, menuDef_t)
+        RECORD_ASSET(ASSET_TYPE_LOCALIZE_ENTRY, LocalizeEntry)
+        RECORD_ASSET(ASSET_TYPE_WEAPON, WeaponVariantDef)
+        RECORD_ASSET(ASSET_TYPE_SNDDRIVER_GLOBALS, SndDriverGlobals)
+        RECORD_ASSET(ASSET_TYPE_FX, FxEffectDef)
+        RECORD_ASSET(ASSET_TYPE_IMPACT_FX, FxImpactTable)
+        RECORD_ASSET(ASSET_TYPE_RAWFILE, RawFile)
+        RECORD_ASSET(ASSET_TYPE_STRINGTABLE, StringTable)
+        RECORD_ASSET(ASSET_TYPE_PACK_INDEX, PackIndex)
+        RECORD_ASSET(ASSET_TYPE_XGLOBALS, XGlobals)
+        RECORD_ASSET(ASSET_TYPE_DDL, ddlRoot_t)
+        RECORD_ASSET(ASSET_TYPE_GLASSES, Glasses)
+        RECORD_ASSET(ASSET_TYPE_EMBLEMSET, EmblemSet)
+
+    default:
+        return false;
+    }
+
+#undef RECORD_ASSET
+}
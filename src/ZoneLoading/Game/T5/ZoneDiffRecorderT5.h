@@ -0,0 +1,12 @@
+#pragma once
+
+#include "Diffing/IZoneDiffRecorder.h"
+
+namespace T5
+{
+    class ZoneDiffRecorder final : public IZoneDiffRecorder
+    {
+    public:
+        bool RecordAsset(const Zone& zone, const XAssetInfoGeneric& asset, std::vector<AssetDiffRecord>& records) const override;
+    };
+} // namespace T5
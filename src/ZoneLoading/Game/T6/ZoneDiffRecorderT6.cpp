@@ -0,0 +1,127 @@
+#include "ZoneDiffRecorderT6.h"
+
+#include "Game/T6/T6.h"
+#include "Game/T6/XAssets/addonmapents/addonmapents_diff_db.h"
+#include "Game/T6/XAssets/clipmap_t/clipmap_t_diff_db.h"
+#include "Game/T6/XAssets/comworld/comworld_diff_db.h"
+#include "Game/T6/XAssets/ddlroot_t/ddlroot_t_diff_db.h"
+#include "Game/T6/XAssets/destructibledef/destructibledef_diff_db.h"
+#include "Game/T6/XAssets/emblemset/emblemset_diff_db.h"
+#include "Game/T6/XAssets/font_s/font_s_diff_db.h"
+#include "Game/T6/XAssets/fonticon/fonticon_diff_db.h"
+#include "Game/T6/XAssets/footstepfxtabledef/footstepfxtabledef_diff_db.h"
+#include "Game/T6/XAssets/footsteptabledef/footsteptabledef_diff_db.h"
+#include "Game/T6/XAssets/fxeffectdef/fxeffectdef_diff_db.h"
+#include "Game/T6/XAssets/fximpacttable/fximpacttable_diff_db.h"
+#include "Game/T6/XAssets/gameworldmp/gameworldmp_diff_db.h"
+#include "Game/T6/XAssets/gameworldsp/gameworldsp_diff_db.h"
+#include "Game/T6/XAssets/gfximage/gfximage_diff_db.h"
+#include "Game/T6/XAssets/gfxlightdef/gfxlightdef_diff_db.h"
+#include "Game/T6/XAssets/gfxworld/gfxworld_diff_db.h"
+#include "Game/T6/XAssets/glasses/glasses_diff_db.h"
+#include "Game/T6/XAssets/keyvaluepairs/keyvaluepairs_diff_db.h"
+#include "Game/T6/XAssets/leaderboarddef/leaderboarddef_diff_db.h"
+#include "Game/T6/XAssets/localizeentry/localizeentry_diff_db.h"
+#include "Game/T6/XAssets/mapents/mapents_diff_db.h"
+#include "Game/T6/XAssets/material/material_diff_db.h"
+#include "Game/T6/XAssets/materialtechniqueset/materialtechniqueset_diff_db.h"
+#include "Game/T6/XAssets/memoryblock/memoryblock_diff_db.h"
+#include "Game/T6/XAssets/menudef_t/menudef_t_diff_db.h"
+#include "Game/T6/XAssets/menulist/menulist_diff_db.h"
+#include "Game/T6/XAssets/physconstraints/physconstraints_diff_db.h"
+#include "Game/T6/XAssets/physpreset/physpreset_diff_db.h"
+#include "Game/T6/XAssets/qdb/qdb_diff_db.h"
+#include "Game/T6/XAssets/rawfile/rawfile_diff_db.h"
+#include "Game/T6/XAssets/scriptparsetree/scriptparsetree_diff_db.h"
+#include "Game/T6/XAssets/skinnedvertsdef/skinnedvertsdef_diff_db.h"
+#include "Game/T6/XAssets/slug/slug_diff_db.h"
+#include "Game/T6/XAssets/sndbank/sndbank_diff_db.h"
+#include "Game/T6/XAssets/snddriverglobals/snddriverglobals_diff_db.h"
+#include "Game/T6/XAssets/sndpatch/sndpatch_diff_db.h"
+#include "Game/T6/XAssets/stringtable/stringtable_diff_db.h"
+#include "Game/T6/XAssets/tracerdef/tracerdef_diff_db.h"
+#include "Game/T6/XAssets/vehicledef/vehicledef_diff_db.h"
+#include "Game/T6/XAssets/weaponattachment/weaponattachment_diff_db.h"
+#include "Game/T6/XAssets/weaponattachmentunique/weaponattachmentunique_diff_db.h"
+#include "Game/T6/XAssets/weaponcamo/weaponcamo_diff_db.h"
+#include "Game/T6/XAssets/weaponvariantdef/weaponvariantdef_diff_db.h"
+#include "Game/T6/XAssets/xanimparts/xanimparts_diff_db.h"
+#include "Game/T6/XAssets/xglobals/xglobals_diff_db.h"
+#include "Game/T6/XAssets/xmodel/xmodel_diff_db.h"
+#include "Game/T6/XAssets/zbarrierdef/zbarrierdef_diff_db.h"
+
+#include <cassert>
+
+using namespace T6;
+
+bool ZoneDiffRecorder::RecordAsset(const Zone& zone, const XAssetInfoGeneric& asset, std::vector<AssetDiffRecord>& records) const
+{
+#define RECORD_ASSET(type_index, typeName)                                                                                                                     \
+    case type_index:                                                                                                                                           \
+    {                                                                                                                                                          \
+        DiffRecorder_##typeName recorder(&zone);                                                                                                               \
+        recorder.Record(static_cast<typeName*>(asset.m_ptr));                                                                                                  \
+        records = std::move(recorder.GetRecords());                                                                                                            \
+        return true;                                                                                                                                           \
+    }
+
+    assert(asset.m_ptr != nullptr);
+
+    switch (asset.m_type)
+    {
+        RECORD_ASSET(ASSET_TYPE_PHYSPRESET, PhysPreset)
+        RECORD_ASSET(ASSET_TYPE_PHYSCONSTRAINTS, PhysConstraints)
+        RECORD_ASSET(ASSET_TYPE_DESTRUCTIBLEDEF, DestructibleDef)
+        RECORD_ASSET(ASSET_TYPE_XANIMPARTS, XAnimParts)
+        RECORD_ASSET(ASSET_TYPE_XMODEL, XModel)
+        RECORD_ASSET(ASSET_TYPE_MATERIAL, Material)
+        RECORD_ASSET(ASSET_TYPE_TECHNIQUE_SET, MaterialTechniqueSet)
+        RECORD_ASSET(ASSET_TYPE_IMAGE, GfxImage)
+        RECORD_ASSET(ASSET_TYPE_SOUND, SndBank)
+        RECORD_ASSET(ASSET_TYPE_SOUND_PATCH, SndPatch)
+        RECORD_ASSET(ASSET_TYPE_CLIPMAP, clipMap_t)
+        RECORD_ASSET(ASSET_TYPE_CLIPMAP_PVS, clipMap_t)
+        RECORD_ASSET(ASSET_TYPE_COMWORLD, ComWorld)
+        RECORD_ASSET(ASSET_TYPE_GAMEWORLD_SP, GameWorldSp)
+        RECORD_ASSET(ASSET_TYPE_GAMEWORLD_MP, GameWorldMp)
+        RECORD_ASSET(ASSET_TYPE_MAP_ENTS, MapEnts)
+        RECORD_ASSET(ASSET_TYPE_GFXWORLD, GfxWorld)
+        RECORD_ASSET(ASSET_TYPE_LIGHT_DEF, GfxLightDef)
+        RECORD_ASSET(ASSET_TYPE_FONT, Font_s)
+        RECORD_ASSET(ASSET_TYPE_FONTICON, FontIcon)
+        RECORD_ASSET(ASSET_TYPE_MENULIST, MenuList)
+        RECORD_ASSET(ASSET_TYPE_MENU, menuDef_t)
+        RECORD_ASSET(ASSET_TYPE_LOCALIZE_ENTRY, LocalizeEntry)
+        RECORD_ASSET(ASSET_TYPE_WEAPON, WeaponVariantDef)
+        RECORD_ASSET(ASSET_TYPE_ATTACHMENT, WeaponAttachment)
+        RECORD_ASSET(ASSET_TYPE_ATTACHMENT_UNIQUE, WeaponAttachmentUnique)
+        RECORD_ASSET(ASSET_TYPE_WEAPON_CAMO, WeaponCamo)
+        RECORD_ASSET(ASSET_TYPE_SNDDRIVER_GLOBALS, SndDriverGlobals)
+        RECORD_ASSET(ASSET_TYPE_FX, FxEffectDef)
+        RECORD_ASSET(ASSET_TYPE_IMPACT_FX, FxImpactTable)
+        RECORD_ASSET(ASSET_TYPE_RAWFILE, RawFile)
+        RECORD_ASSET(ASSET_TYPE_STRINGTABLE, StringTable)
+        RECORD_ASSET(ASSET_TYPE_LEADERBOARD, LeaderboardDef)
+        RECORD_ASSET(ASSET_TYPE_XGLOBALS, XGlobals)
+        RECORD_ASSET(ASSET_TYPE_DDL, ddlRoot_t)
+        RECORD_ASSET(ASSET_TYPE_GLASSES, Glasses)
+        RECORD_ASSET(ASSET_TYPE_EMBLEMSET, EmblemSet)
+        RECORD_ASSET(ASSET_TYPE_SCRIPTPARSETREE, ScriptParseTree)
+        RECORD_ASSET(ASSET_TYPE_KEYVALUEPAIRS, KeyValuePairs)
+        RECORD_ASSET(ASSET_TYPE_VEHICLEDEF, VehicleDef)
+        RECORD_ASSET(ASSET_TYPE_MEMORYBLOCK, MemoryBlock)
+        RECORD_ASSET(ASSET_TYPE_ADDON_MAP_ENTS, AddonMapEnts)
+        RECORD_ASSET(ASSET_TYPE_TRACER, TracerDef)
+        RECORD_ASSET(ASSET_TYPE_SKINNEDVERTS, SkinnedVertsDef)
+        RECORD_ASSET(ASSET_TYPE_QDB, Qdb)
+        RECORD_ASSET(ASSET_TYPE_SLUG, Slug)
+        RECORD_ASSET(ASSET_TYPE_FOOTSTEP_TABLE, FootstepTableDef)
+        RECORD_ASSET(ASSET_TYPE_FOOTSTEPFX_TABLE, FootstepFXTableDef)
+        RECORD_ASSET(ASSET_TYPE_ZBARRIER, ZBarrierDef)
+
+    default:
+        return false;
+    }
+
+#undef RECORD_ASSET
+}
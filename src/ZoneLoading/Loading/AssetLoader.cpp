@@ -6,10 +6,16 @@
 AssetLoader::AssetLoader(const asset_type_t assetType, Zone* zone, IZoneInputStream* stream)
     : ContentLoaderBase(zone, stream),
       m_asset_type(assetType),
-      varScriptString(nullptr)
+      varScriptString(nullptr),
+      m_scan_only(false)
 {
 }
 
+void AssetLoader::SetScanOnlyAssetTypes(const std::vector<bool>& scanOnlyAssetTypes)
+{
+    m_scan_only = static_cast<size_t>(m_asset_type) < scanOnlyAssetTypes.size() && scanOnlyAssetTypes[m_asset_type];
+}
+
 XAssetInfoGeneric* AssetLoader::LinkAsset(std::string name,
                                           void* asset,
                                           std::vector<XAssetInfoGeneric*> dependencies,
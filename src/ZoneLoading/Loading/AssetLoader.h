@@ -13,6 +13,7 @@ class AssetLoader : public ContentLoaderBase
 
 protected:
     scr_string_t* varScriptString;
+    bool m_scan_only;
 
     AssetLoader(asset_type_t assetType, Zone* zone, IZoneInputStream* stream);
 
@@ -23,4 +24,13 @@ protected:
                                  std::vector<IndirectAssetReference> indirectAssetReferences) const;
 
     _NODISCARD XAssetInfoGeneric* GetAssetInfo(const std::string& name) const;
+
+public:
+    /**
+     * \brief Makes this loader only scan assets instead of fully loading them when its asset type is marked in the specified bitfield.
+     * Scanned assets are still read from the stream and linked with their name, but are not marked and do not run any loading actions.
+     * Only the name of scanned assets is kept. All of their other members are zeroed, since they may point into temp block memory.
+     * \param scanOnlyAssetTypes A bitfield with an entry for each asset type that is \c true when the asset type should only be scanned.
+     */
+    void SetScanOnlyAssetTypes(const std::vector<bool>& scanOnlyAssetTypes);
 };
@@ -1,34 +1,116 @@
 #include "AssetMarker.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 
+namespace
+{
+    /**
+     * \brief Remembers for every script string index which marker used it last.
+     * Every marker takes a new epoch so the table never needs to be cleared between assets.
+     */
+    class ScriptStringStampTable
+    {
+    public:
+        uint32_t NextEpoch()
+        {
+            if (++m_epoch == 0)
+            {
+                std::ranges::fill(m_stamps, 0u);
+                m_epoch = 1;
+            }
+
+            return m_epoch;
+        }
+
+        bool Stamp(const scr_string_t scrString, const size_t scriptStringCount, const uint32_t epoch)
+        {
+            if (m_stamps.size() < scriptStringCount)
+                m_stamps.resize(scriptStringCount, 0u);
+
+            if (m_stamps[scrString] == epoch)
+                return false;
+
+            m_stamps[scrString] = epoch;
+            return true;
+        }
+
+    private:
+        std::vector<uint32_t> m_stamps;
+        uint32_t m_epoch = 0;
+    };
+
+    /**
+     * \brief Keeps the cleared vectors of destroyed markers so the next markers on the same thread can reuse their allocations.
+     * Markers of dependencies are created while another marker is alive, so more than one vector can be handed out at a time.
+     */
+    template<typename T> class VectorRecycler
+    {
+    public:
+        std::vector<T> Take()
+        {
+            if (m_vectors.empty())
+                return {};
+
+            auto vec = std::move(m_vectors.back());
+            m_vectors.pop_back();
+            return vec;
+        }
+
+        void Return(std::vector<T> vec)
+        {
+            vec.clear();
+            m_vectors.emplace_back(std::move(vec));
+        }
+
+    private:
+        std::vector<std::vector<T>> m_vectors;
+    };
+
+    thread_local ScriptStringStampTable scriptStringStamps;
+    thread_local VectorRecycler<XAssetInfoGeneric*> dependencyVectors;
+    thread_local VectorRecycler<scr_string_t> scriptStringVectors;
+
+    // Shared by all threads, so two markers never stamp an asset info with the same epoch
+    std::atomic_uint64_t lastDependencyEpoch = 0u;
+} // namespace
+
 AssetMarker::AssetMarker(const asset_type_t assetType, Zone* zone)
     : m_asset_type(assetType),
+      m_dependencies(dependencyVectors.Take()),
+      m_used_script_strings(scriptStringVectors.Take()),
+      m_dependency_epoch(lastDependencyEpoch.fetch_add(1u, std::memory_order_relaxed) + 1u),
+      m_script_string_epoch(scriptStringStamps.NextEpoch()),
       m_zone(zone)
 {
 }
 
-void AssetMarker::AddDependency(XAssetInfoGeneric* assetInfo)
+AssetMarker::~AssetMarker()
 {
-    if (assetInfo == nullptr)
-        return;
+    dependencyVectors.Return(std::move(m_dependencies));
+    scriptStringVectors.Return(std::move(m_used_script_strings));
+}
 
-    const auto existingEntry = m_dependencies.find(assetInfo);
-    if (existingEntry != m_dependencies.end())
+void AssetMarker::AddDependency(XAssetInfoGeneric* assetInfo)
+{
+    if (assetInfo == nullptr || assetInfo->m_mark_epoch == m_dependency_epoch)
         return;
 
-    m_dependencies.emplace(assetInfo);
+    assetInfo->m_mark_epoch = m_dependency_epoch;
+    m_dependencies.push_back(assetInfo);
 }
 
 void AssetMarker::Mark_ScriptString(const scr_string_t scrString)
 {
-    assert(scrString < m_zone->m_script_strings.Count());
+    const auto scriptStringCount = m_zone->m_script_strings.Count();
+    assert(scrString < scriptStringCount);
 
-    if (scrString >= m_zone->m_script_strings.Count())
+    if (scrString >= scriptStringCount)
         return;
 
-    m_used_script_strings.emplace(scrString);
+    if (scriptStringStamps.Stamp(scrString, scriptStringCount, m_script_string_epoch))
+        m_used_script_strings.push_back(scrString);
 }
 
 void AssetMarker::MarkArray_ScriptString(const scr_string_t* scrStringArray, const size_t count)
@@ -62,28 +144,13 @@ XAssetInfoGeneric* AssetMarker::GetAssetInfoByName(const std::string& name) cons
 
 std::vector<XAssetInfoGeneric*> AssetMarker::GetDependencies() const
 {
-    std::vector<XAssetInfoGeneric*> dependencies;
-    if (!m_dependencies.empty())
-    {
-        dependencies.reserve(m_dependencies.size());
-        for (auto dependency : m_dependencies)
-            dependencies.push_back(dependency);
-    }
-
-    return dependencies;
+    return m_dependencies;
 }
 
 std::vector<scr_string_t> AssetMarker::GetUsedScriptStrings() const
 {
-    std::vector<scr_string_t> usedScriptStrings;
-    if (!m_used_script_strings.empty())
-    {
-        usedScriptStrings.reserve(m_used_script_strings.size());
-        for (auto scrString : m_used_script_strings)
-            usedScriptStrings.push_back(scrString);
-
-        std::ranges::sort(usedScriptStrings);
-    }
+    auto usedScriptStrings = m_used_script_strings;
+    std::ranges::sort(usedScriptStrings);
 
     return usedScriptStrings;
 }
@@ -5,18 +5,30 @@
 #include "Utils/ClassUtils.h"
 #include "Zone/ZoneTypes.h"
 
+#include <cstdint>
 #include <unordered_set>
+#include <vector>
 
 class AssetMarker
 {
     asset_type_t m_asset_type;
 
-    std::unordered_set<XAssetInfoGeneric*> m_dependencies;
-    std::unordered_set<scr_string_t> m_used_script_strings;
+    // Dependencies and script strings are kept in marking order and are deduplicated with epoch stamps instead of hashing:
+    // Dependencies are stamped on their asset info, script strings are dense indices with a per-thread stamp table.
+    // Their vectors are recycled when the marker is destroyed so following markers on the same thread reuse their capacity.
+    std::vector<XAssetInfoGeneric*> m_dependencies;
+    std::vector<scr_string_t> m_used_script_strings;
     std::unordered_set<IndirectAssetReference> m_indirect_asset_references;
+    uint64_t m_dependency_epoch;
+    uint32_t m_script_string_epoch;
 
 protected:
     AssetMarker(asset_type_t assetType, Zone* zone);
+    ~AssetMarker();
+    AssetMarker(const AssetMarker& other) = delete;
+    AssetMarker(AssetMarker&& other) noexcept = delete;
+    AssetMarker& operator=(const AssetMarker& other) = delete;
+    AssetMarker& operator=(AssetMarker&& other) noexcept = delete;
 
     void AddDependency(XAssetInfoGeneric* assetInfo);
 
@@ -3,10 +3,12 @@
 #include "Zone/Stream/IZoneInputStream.h"
 #include "Zone/Zone.h"
 
+#include <vector>
+
 class IContentLoadingEntryPoint
 {
 public:
     virtual ~IContentLoadingEntryPoint() = default;
 
-    virtual void Load(Zone* zone, IZoneInputStream* stream) = 0;
+    virtual void Load(Zone* zone, IZoneInputStream* stream, const std::vector<bool>& scanOnlyAssetTypes) = 0;
 };
@@ -2,6 +2,7 @@
 
 #include "Exception/LoadingException.h"
 #include "LoadingFileStream.h"
+#include "Utils/Tracing.h"
 
 #include <algorithm>
 
@@ -63,6 +64,20 @@ void ZoneLoader::RemoveStreamProcessor(StreamProcessor* streamProcessor)
     }
 }
 
+void ZoneLoader::SetScanOnlyAssetTypes(const std::function<bool(const Zone& zone, asset_type_t assetType)>& scanOnly)
+{
+    const auto assetTypeCount = m_zone->m_pools->GetAssetTypeCount();
+
+    m_scan_only_asset_types = std::vector<bool>(assetTypeCount);
+    for (asset_type_t assetType = 0; assetType < assetTypeCount; assetType++)
+        m_scan_only_asset_types[assetType] = scanOnly(*m_zone, assetType);
+}
+
+const std::vector<bool>& ZoneLoader::GetScanOnlyAssetTypes() const
+{
+    return m_scan_only_asset_types;
+}
+
 std::unique_ptr<Zone> ZoneLoader::LoadZone(std::istream& stream)
 {
     LoadingFileStream fileStream(stream);
@@ -72,6 +87,7 @@ std::unique_ptr<Zone> ZoneLoader::LoadZone(std::istream& stream)
     {
         for (const auto& step : m_steps)
         {
+            const utils::TraceScope stepTrace("loading_step", utils::IsTracingEnabled() ? utils::GetTraceTypeName(typeid(*step)) : std::string());
             step->PerformStep(this, endStream);
 
             if (m_processor_chain_dirty)
@@ -88,6 +104,13 @@ std::unique_ptr<Zone> ZoneLoader::LoadZone(std::istream& stream)
         return nullptr;
     }
 
+    // Temp blocks only hold data while an asset is being loaded
+    for (auto* block : m_blocks)
+    {
+        if (block->m_type == XBlock::Type::BLOCK_TYPE_TEMP)
+            block->Discard();
+    }
+
     m_zone->Register();
 
     return std::move(m_zone);
@@ -5,6 +5,7 @@
 #include "Zone/XBlock.h"
 #include "Zone/Zone.h"
 
+#include <functional>
 #include <istream>
 #include <memory>
 #include <vector>
@@ -19,6 +20,7 @@ class ZoneLoader
     bool m_processor_chain_dirty;
 
     std::unique_ptr<Zone> m_zone;
+    std::vector<bool> m_scan_only_asset_types;
 
     ILoadingStream* BuildLoadingChain(ILoadingStream* rootStream);
 
@@ -33,5 +35,8 @@ public:
 
     void RemoveStreamProcessor(StreamProcessor* streamProcessor);
 
+    void SetScanOnlyAssetTypes(const std::function<bool(const Zone& zone, asset_type_t assetType)>& scanOnly);
+    _NODISCARD const std::vector<bool>& GetScanOnlyAssetTypes() const;
+
     std::unique_ptr<Zone> LoadZone(std::istream& stream);
 };
@@ -5,6 +5,7 @@
 #include "Loading/Exception/InvalidOffsetBlockOffsetException.h"
 #include "Loading/Exception/OutOfBlockBoundsException.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
@@ -125,7 +126,8 @@ void XBlockInputStream::LoadDataInBlock(void* dst, const size_t size)
         break;
 
     case XBlock::Type::BLOCK_TYPE_RUNTIME:
-        memset(dst, 0, size);
+        // Block buffers are zero-initialized and runtime data is never loaded twice at the same position.
+        // Not writing the zeros here means runtime blocks do not need to be committed to physical memory.
         break;
 
     case XBlock::Type::BLOCK_TYPE_DELAY:
@@ -143,8 +145,9 @@ void XBlockInputStream::IncBlockPos(const size_t size)
     if (m_block_stack.empty())
         return;
 
-    const XBlock* block = m_block_stack.top();
+    XBlock* block = m_block_stack.top();
     m_block_offsets[block->m_index] += size;
+    block->m_used_size = std::max(block->m_used_size, m_block_offsets[block->m_index]);
 }
 
 void XBlockInputStream::LoadNullTerminated(void* dst)
@@ -178,6 +181,7 @@ void XBlockInputStream::LoadNullTerminated(void* dst)
     } while (byte != 0);
 
     m_block_offsets[block->m_index] = offset;
+    block->m_used_size = std::max(block->m_used_size, offset);
 }
 
 void** XBlockInputStream::InsertPointer()
@@ -3,6 +3,7 @@
 #include "Loading/IZoneLoaderFactory.h"
 #include "Loading/ZoneLoader.h"
 #include "Utils/ObjFileStream.h"
+#include "Utils/Tracing.h"
 
 #include <filesystem>
 #include <format>
@@ -12,8 +13,15 @@
 namespace fs = std::filesystem;
 
 std::unique_ptr<Zone> ZoneLoading::LoadZone(const std::string& path)
+{
+    return LoadZone(path, nullptr);
+}
+
+std::unique_ptr<Zone> ZoneLoading::LoadZone(const std::string& path, const std::function<bool(const Zone& zone, asset_type_t assetType)>& scanOnly)
 {
     auto zoneName = fs::path(path).filename().replace_extension().string();
+    const utils::TraceScope trace("zone", "LoadZone", zoneName);
+
     std::ifstream file(path, std::fstream::in | std::fstream::binary);
 
     if (!file.is_open())
@@ -46,6 +54,9 @@ std::unique_ptr<Zone> ZoneLoading::LoadZone(const std::string& path)
         return nullptr;
     }
 
+    if (scanOnly)
+        zoneLoader->SetScanOnlyAssetTypes(scanOnly);
+
     auto loadedZone = zoneLoader->LoadZone(file);
 
     file.close();
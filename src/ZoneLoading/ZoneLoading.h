@@ -1,10 +1,23 @@
 #pragma once
 #include "Zone/Zone.h"
 
+#include <functional>
 #include <string>
 
 class ZoneLoading
 {
 public:
     static std::unique_ptr<Zone> LoadZone(const std::string& path);
+
+    /**
+     * \brief Loads a zone, only scanning assets of types that the specified predicate returns \c true for.
+     * Scanned assets are added to the zone with their name, but are not marked and do not run any loading actions.
+     * All of their members except their name are zeroed, so their content must not be used. They also have no dependencies, script strings or
+     * indirect asset references.
+     * This is useful when the content of certain asset types is not needed, e.g. for listing or for comparing only some asset types.
+     * \param path The path of the zone file.
+     * \param scanOnly A predicate that decides for each asset type whether it should only be scanned.
+     * \return The loaded zone or \c nullptr when loading failed.
+     */
+    static std::unique_ptr<Zone> LoadZone(const std::string& path, const std::function<bool(const Zone& zone, asset_type_t assetType)>& scanOnly);
 };
@@ -40,6 +40,7 @@
 #include "Game/IW5/XAssets/xanimparts/xanimparts_write_db.h"
 #include "Game/IW5/XAssets/xmodel/xmodel_write_db.h"
 #include "Game/IW5/XAssets/xmodelsurfs/xmodelsurfs_write_db.h"
+#include "Utils/Tracing.h"
 #include "Writing/WritingException.h"
 
 #include <cassert>
@@ -118,6 +119,7 @@ void ContentWriter::WriteXAsset(const bool atStreamStart)
 #define WRITE_ASSET(type_index, typeName, headerEntry)                                                                                                         \
     case type_index:                                                                                                                                           \
     {                                                                                                                                                          \
+        const utils::TraceScope assetTrace("write_asset", #typeName);                                                                                          \
         Writer_##typeName writer(varXAsset->header.headerEntry, m_zone, *m_stream);                                                                            \
         writer.Write(&varXAsset->header.headerEntry);                                                                                                          \
         break;                                                                                                                                                 \
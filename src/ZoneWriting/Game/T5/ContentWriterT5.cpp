@@ -32,6 +32,7 @@
 #include "Game/T5/XAssets/xanimparts/xanimparts_write_db.h"
 #include "Game/T5/XAssets/xglobals/xglobals_write_db.h"
 #include "Game/T5/XAssets/xmodel/xmodel_write_db.h"
+#include "Utils/Tracing.h"
 #include "Writing/WritingException.h"
 
 #include <cassert>
@@ -110,6 +111,7 @@ void ContentWriter::WriteXAsset(const bool atStreamStart)
 #define WRITE_ASSET(type_index, typeName, headerEntry)                                                                                                         \
     case type_index:                                                                                                                                           \
     {                                                                                                                                                          \
+        const utils::TraceScope assetTrace("write_asset", #typeName);                                                                                          \
         Writer_##typeName writer(varXAsset->header.headerEntry, m_zone, *m_stream);                                                                            \
         writer.Write(&varXAsset->header.headerEntry);                                                                                                          \
         break;                                                                                                                                                 \
@@ -1,6 +1,7 @@
 #include "ZoneWriter.h"
 
 #include "WritingException.h"
+#include "Utils/Tracing.h"
 #include "WritingFileStream.h"
 
 #include <format>
@@ -65,6 +66,7 @@ bool ZoneWriter::WriteZone(std::ostream& stream)
     {
         for (const auto& step : m_steps)
         {
+            const utils::TraceScope stepTrace("writing_step", utils::IsTracingEnabled() ? utils::GetTraceTypeName(typeid(*step)) : std::string());
             step->PerformStep(this, endStream);
 
             if (m_processor_chain_dirty)
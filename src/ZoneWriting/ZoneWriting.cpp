@@ -1,5 +1,6 @@
 #include "ZoneWriting.h"
 
+#include "Utils/Tracing.h"
 #include "Writing/IZoneWriterFactory.h"
 
 #include <chrono>
@@ -9,6 +10,7 @@
 bool ZoneWriting::WriteZone(std::ostream& stream, const Zone& zone)
 {
     const auto start = std::chrono::high_resolution_clock::now();
+    const utils::TraceScope trace("zone", "WriteZone", zone.m_name);
 
     const auto factory = IZoneWriterFactory::GetZoneWriterFactoryForGame(zone.m_game->GetId());
 
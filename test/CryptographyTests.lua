@@ -0,0 +1,57 @@
+CryptographyTests = {}
+
+function CryptographyTests:include(includes)
+	if includes:handle(self:name()) then
+		includedirs {
+			path.join(TestFolder(), "CryptographyTests")
+		}
+	end
+end
+
+function CryptographyTests:link(links)
+	
+end
+
+function CryptographyTests:use()
+	
+end
+
+function CryptographyTests:name()
+    return "CryptographyTests"
+end
+
+function CryptographyTests:project()
+	local folder = TestFolder()
+	local includes = Includes:create()
+	local links = Links:create()
+
+	project(self:name())
+        targetdir(TargetDirectoryTest)
+		location "%{wks.location}/test/%{prj.name}"
+		kind "ConsoleApp"
+		language "C++"
+		
+		files {
+			path.join(folder, "CryptographyTests/**.h"), 
+			path.join(folder, "CryptographyTests/**.cpp")
+		}
+		
+        vpaths {
+			["*"] = {
+				path.join(folder, "CryptographyTests")
+			}
+		}
+		
+		self:include(includes)
+		Catch2Common:include(includes)
+		Cryptography:include(includes)
+		libtomcrypt:include(includes)
+		libtommath:include(includes)
+		salsa20:include(includes)
+		catch2:include(includes)
+
+		links:linkto(Cryptography)
+		links:linkto(catch2)
+		links:linkto(Catch2Common)
+		links:linkall()
+end
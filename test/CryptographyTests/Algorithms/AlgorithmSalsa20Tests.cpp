@@ -0,0 +1,130 @@
+#include "Algorithms/AlgorithmSalsa20.h"
+#include "Internal/CpuFeatures.h"
+#include "Internal/Salsa20Simd.h"
+#include "salsa20.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace cryptography;
+
+namespace test::algorithms::salsa20
+{
+    namespace
+    {
+        std::vector<uint8_t> CreateRandomData(std::mt19937& random, const size_t size)
+        {
+            std::vector<uint8_t> data(size);
+            for (auto& value : data)
+                value = static_cast<uint8_t>(random());
+
+            return data;
+        }
+
+        salsa20_ctx CreateReferenceContext(const std::vector<uint8_t>& key, const std::vector<uint8_t>& iv)
+        {
+            salsa20_ctx context{};
+            Salsa20_KeySetup(&context, key.data(), static_cast<uint32_t>(key.size() * 8u));
+            Salsa20_IVSetup(&context, iv.data());
+
+            return context;
+        }
+
+        std::vector<uint8_t> EncryptWithReference(salsa20_ctx& context, const std::vector<uint8_t>& plainText, const std::vector<size_t>& chunkSizes)
+        {
+            std::vector<uint8_t> cipherText(plainText.size());
+
+            size_t offset = 0;
+            for (const auto chunkSize : chunkSizes)
+            {
+                Salsa20_Encrypt_Bytes(&context, &plainText[offset], &cipherText[offset], static_cast<uint32_t>(chunkSize));
+                offset += chunkSize;
+            }
+
+            return cipherText;
+        }
+
+        std::vector<size_t> CreateChunkSizes(std::mt19937& random, size_t totalSize)
+        {
+            std::vector<size_t> chunkSizes;
+            while (totalSize > 0)
+            {
+                const auto chunkSize = std::min<size_t>(totalSize, random() % 2000u + 1u);
+                chunkSizes.emplace_back(chunkSize);
+                totalSize -= chunkSize;
+            }
+
+            return chunkSizes;
+        }
+    } // namespace
+
+    TEST_CASE("AlgorithmSalsa20: Produces the same output as the reference implementation", "[cryptography][salsa20]")
+    {
+        const auto keySize = GENERATE(16u, 32u);
+        const auto dataSize = GENERATE(0u, 1u, 63u, 64u, 65u, 256u, 511u, 512u, 4096u, 20000u);
+
+        std::mt19937 random(static_cast<unsigned>(keySize * 100000u + dataSize));
+        const auto key = CreateRandomData(random, keySize);
+        const auto iv = CreateRandomData(random, 8u);
+        const auto plainText = CreateRandomData(random, dataSize);
+        const auto chunkSizes = CreateChunkSizes(random, dataSize);
+
+        auto referenceContext = CreateReferenceContext(key, iv);
+        const auto expectedCipherText = EncryptWithReference(referenceContext, plainText, chunkSizes);
+
+        const auto cipher = CreateSalsa20(key.data(), key.size());
+        cipher->SetIv(iv.data(), iv.size());
+
+        std::vector<uint8_t> cipherText(plainText.size());
+        size_t offset = 0;
+        for (const auto chunkSize : chunkSizes)
+        {
+            cipher->Process(&plainText[offset], &cipherText[offset], chunkSize);
+            offset += chunkSize;
+        }
+
+        REQUIRE(cipherText == expectedCipherText);
+    }
+
+    TEST_CASE("AlgorithmSalsa20: Vectorized implementations produce the same output as the reference implementation", "[cryptography][salsa20]")
+    {
+        const auto& cpuFeatures = internal::CpuFeatures::Get();
+        const auto useAvx2 = GENERATE(false, true);
+        if ((useAvx2 && !cpuFeatures.m_avx2) || (!useAvx2 && !cpuFeatures.m_sse2))
+            return;
+
+        const auto blocksPerCall = useAvx2 ? internal::SALSA20_AVX2_BLOCK_COUNT : internal::SALSA20_SSE2_BLOCK_COUNT;
+        const auto callCount = GENERATE(1u, 3u);
+
+        // Start right before the low word of the block counter overflows to verify the carry into the high word
+        const auto initialCounter = GENERATE(0u, 0xFFFFFFFEu);
+
+        std::mt19937 random(initialCounter + callCount);
+        const auto key = CreateRandomData(random, 32u);
+        const auto iv = CreateRandomData(random, 8u);
+        const auto plainText = CreateRandomData(random, blocksPerCall * callCount * internal::SALSA20_BLOCK_SIZE);
+
+        auto referenceContext = CreateReferenceContext(key, iv);
+        referenceContext.m_input[8] = initialCounter;
+        auto vectorizedContext = referenceContext;
+
+        const auto expectedCipherText = EncryptWithReference(referenceContext, plainText, {plainText.size()});
+
+        std::vector<uint8_t> cipherText(plainText.size());
+        const auto callSize = blocksPerCall * internal::SALSA20_BLOCK_SIZE;
+        for (auto call = 0u; call < callCount; call++)
+        {
+            if (useAvx2)
+                internal::Salsa20EncryptBlocksAvx2(vectorizedContext.m_input, &plainText[call * callSize], &cipherText[call * callSize], blocksPerCall);
+            else
+                internal::Salsa20EncryptBlocksSse2(vectorizedContext.m_input, &plainText[call * callSize], &cipherText[call * callSize], blocksPerCall);
+        }
+
+        REQUIRE(cipherText == expectedCipherText);
+        REQUIRE(vectorizedContext.m_input[8] == referenceContext.m_input[8]);
+        REQUIRE(vectorizedContext.m_input[9] == referenceContext.m_input[9]);
+    }
+} // namespace test::algorithms::salsa20
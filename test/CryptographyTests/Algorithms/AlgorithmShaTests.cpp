@@ -0,0 +1,82 @@
+#include "Algorithms/AlgorithmSha1.h"
+#include "Algorithms/AlgorithmSha256.h"
+#include "Internal/CryptoLibrary.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace cryptography;
+
+namespace test::algorithms::sha
+{
+    namespace
+    {
+        std::vector<uint8_t> CreateRandomData(const size_t size)
+        {
+            std::mt19937 random(static_cast<unsigned>(size));
+
+            std::vector<uint8_t> data(size);
+            for (auto& value : data)
+                value = static_cast<uint8_t>(random());
+
+            return data;
+        }
+
+        std::vector<uint8_t> HashInChunks(IHashFunction& hashFunction, const std::vector<uint8_t>& data, const size_t chunkSize)
+        {
+            hashFunction.Init();
+            for (size_t offset = 0; offset < data.size(); offset += chunkSize)
+                hashFunction.Process(&data[offset], std::min(chunkSize, data.size() - offset));
+
+            std::vector<uint8_t> hash(hashFunction.GetHashSize());
+            hashFunction.Finish(hash.data());
+
+            return hash;
+        }
+    } // namespace
+
+    TEST_CASE("AlgorithmSha1: Produces the same hash as the reference implementation", "[cryptography][sha1]")
+    {
+        const auto dataSize = GENERATE(0u, 1u, 55u, 56u, 63u, 64u, 65u, 119u, 120u, 128u, 1000u, 65536u);
+        const auto chunkSize = GENERATE(1u, 7u, 64u, 100000u);
+
+        const auto data = CreateRandomData(dataSize);
+
+        hash_state state{};
+        sha1_init(&state);
+        if (!data.empty())
+            sha1_process(&state, data.data(), static_cast<unsigned long>(data.size()));
+        std::vector<uint8_t> expectedHash(20u);
+        sha1_done(&state, expectedHash.data());
+
+        const auto hashFunction = CreateSha1();
+        REQUIRE(HashInChunks(*hashFunction, data, chunkSize) == expectedHash);
+
+        // Hash functions must be reusable after being initialized again
+        REQUIRE(HashInChunks(*hashFunction, data, chunkSize) == expectedHash);
+    }
+
+    TEST_CASE("AlgorithmSha256: Produces the same hash as the reference implementation", "[cryptography][sha256]")
+    {
+        const auto dataSize = GENERATE(0u, 1u, 55u, 56u, 63u, 64u, 65u, 119u, 120u, 128u, 1000u, 65536u);
+        const auto chunkSize = GENERATE(1u, 7u, 64u, 100000u);
+
+        const auto data = CreateRandomData(dataSize);
+
+        hash_state state{};
+        sha256_init(&state);
+        if (!data.empty())
+            sha256_process(&state, data.data(), static_cast<unsigned long>(data.size()));
+        std::vector<uint8_t> expectedHash(32u);
+        sha256_done(&state, expectedHash.data());
+
+        const auto hashFunction = CreateSha256();
+        REQUIRE(HashInChunks(*hashFunction, data, chunkSize) == expectedHash);
+
+        // Hash functions must be reusable after being initialized again
+        REQUIRE(HashInChunks(*hashFunction, data, chunkSize) == expectedHash);
+    }
+} // namespace test::algorithms::sha
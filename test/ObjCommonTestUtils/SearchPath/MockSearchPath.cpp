@@ -1,5 +1,6 @@
 #include "MockSearchPath.h"
 
+#include <ranges>
 #include <sstream>
 
 void MockSearchPath::AddFileData(std::string fileName, std::string fileData)
@@ -23,4 +24,8 @@ const std::string& MockSearchPath::GetPath()
     return NAME;
 }
 
-void MockSearchPath::Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) {}
+void MockSearchPath::Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback)
+{
+    for (const auto& fileName : m_file_data_map | std::views::keys)
+        callback(fileName);
+}
@@ -47,10 +47,12 @@ function ObjCommonTests:project()
 		Catch2Common:include(includes)
 		ObjCommon:include(includes)
 		ObjImage:include(includes)
+		ObjCommonTestUtils:include(includes)
 		catch2:include(includes)
 
 		links:linkto(ObjCommon)
 		links:linkto(ObjImage)
+		links:linkto(ObjCommonTestUtils)
 		links:linkto(catch2)
 		links:linkto(Catch2Common)
 		links:linkall()
@@ -0,0 +1,123 @@
+#include "Image/DdsWriter.h"
+#include "Image/IwiLoader.h"
+#include "Image/IwiWriter13.h"
+#include "Image/IwiWriter27.h"
+#include "Image/IwiWriter6.h"
+#include "Image/IwiWriter8.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace image::iwi_passthrough
+{
+    void FillTexture(Texture& texture)
+    {
+        texture.Allocate();
+
+        const auto mipCount = texture.HasMipMaps() ? texture.GetMipMapCount() : 1;
+        for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
+        {
+            auto* buffer = texture.GetBufferForMipLevel(mipLevel);
+            const auto mipLevelSize = texture.GetSizeOfMipLevel(mipLevel) * texture.GetFaceCount();
+            for (auto i = 0uz; i < mipLevelSize; i++)
+                buffer[i] = static_cast<uint8_t>(i * 31u + static_cast<size_t>(mipLevel) * 7u);
+        }
+    }
+
+    std::string CreateIwi(Texture& texture)
+    {
+        FillTexture(texture);
+
+        std::ostringstream ss;
+        iwi8::IwiWriter writer;
+        writer.DumpImage(ss, &texture);
+
+        return ss.str();
+    }
+
+    std::unique_ptr<Texture> CreateTexture(const int textureType, const ImageFormat* format)
+    {
+        switch (textureType)
+        {
+        case 0:
+            return std::make_unique<Texture2D>(format, 64u, 32u, true);
+        case 1:
+            return std::make_unique<Texture2D>(format, 16u, 16u, false);
+        default:
+            return std::make_unique<Texture3D>(format, 16u, 16u, 4u, true);
+        }
+    }
+
+    std::unique_ptr<IImageWriter> CreateWriter(const int writerType)
+    {
+        switch (writerType)
+        {
+        case 0:
+            return std::make_unique<DdsWriter>();
+        case 1:
+            return std::make_unique<iwi6::IwiWriter>();
+        case 2:
+            return std::make_unique<iwi8::IwiWriter>();
+        case 3:
+            return std::make_unique<iwi13::IwiWriter>();
+        default:
+            return std::make_unique<iwi27::IwiWriter>();
+        }
+    }
+
+    TEST_CASE("IwiPassthrough: Ensure passthrough output is identical to decoded output", "[image]")
+    {
+        const auto textureType = GENERATE(0, 1, 2);
+        const auto writerType = GENERATE(0, 1, 2, 3, 4);
+        const auto* format = GENERATE(&ImageFormat::FORMAT_BC1, &ImageFormat::FORMAT_BC3, &ImageFormat::FORMAT_R8_G8_B8_A8);
+
+        const auto texture = CreateTexture(textureType, format);
+        const auto iwiData = CreateIwi(*texture);
+        const auto writer = CreateWriter(writerType);
+
+        std::istringstream decodedInput(iwiData);
+        const auto decodedTexture = iwi::LoadIwi(decodedInput);
+        REQUIRE(decodedTexture);
+
+        std::ostringstream decodedOutput;
+        writer->DumpImage(decodedOutput, decodedTexture.get());
+
+        std::istringstream passthroughInput(iwiData);
+        const auto headerTexture = iwi::LoadIwiHeader(passthroughInput);
+        REQUIRE(headerTexture);
+        REQUIRE(headerTexture->Empty());
+        REQUIRE(writer->SupportsIwiPassthrough(headerTexture->GetFormat()));
+
+        std::ostringstream passthroughOutput;
+        REQUIRE(writer->DumpIwiPassthrough(passthroughOutput, headerTexture.get(), passthroughInput));
+
+        REQUIRE(passthroughOutput.str() == decodedOutput.str());
+    }
+
+    TEST_CASE("IwiPassthrough: Ensure truncated iwis are reported", "[image]")
+    {
+        const auto writerType = GENERATE(0, 2);
+
+        Texture2D texture(&ImageFormat::FORMAT_BC1, 64u, 64u, true);
+        const auto iwiData = CreateIwi(texture);
+        const auto writer = CreateWriter(writerType);
+
+        std::istringstream input(iwiData.substr(0, iwiData.size() - 8u));
+        const auto headerTexture = iwi::LoadIwiHeader(input);
+        REQUIRE(headerTexture);
+
+        std::ostringstream output;
+        REQUIRE(!writer->DumpIwiPassthrough(output, headerTexture.get(), input));
+    }
+
+    TEST_CASE("IwiPassthrough: Ensure dds does not support passthrough of converted formats", "[image]")
+    {
+        DdsWriter writer;
+
+        REQUIRE(!writer.SupportsIwiPassthrough(&ImageFormat::FORMAT_R8_G8_B8));
+        REQUIRE(writer.SupportsIwiPassthrough(&ImageFormat::FORMAT_BC1));
+    }
+} // namespace image::iwi_passthrough
@@ -0,0 +1,66 @@
+#include "SearchPath/MockOutputPath.h"
+#include "SearchPath/OutputPathAsync.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <format>
+#include <string>
+
+namespace test::search_path::output_path_async
+{
+    TEST_CASE("OutputPathAsync: Writes all files", "[searchpath]")
+    {
+        MockOutputPath target;
+        OutputPathAsync outputPath(target, 1u, OutputPathAsync::DEFAULT_MEMORY_BUDGET);
+
+        for (auto i = 0u; i < 100u; i++)
+            *outputPath.Open(std::format("file_{}.txt", i)) << std::format("content_{}", i);
+
+        REQUIRE(outputPath.Flush());
+        REQUIRE(target.GetMockedFileList().size() == 100u);
+
+        for (auto i = 0u; i < 100u; i++)
+        {
+            const auto* file = target.GetMockedFile(std::format("file_{}.txt", i));
+            REQUIRE(file);
+            REQUIRE(file->AsString() == std::format("content_{}", i));
+        }
+    }
+
+    TEST_CASE("OutputPathAsync: Writes stream that was opened last when same file is opened multiple times", "[searchpath]")
+    {
+        MockOutputPath target;
+        OutputPathAsync outputPath(target, 1u, OutputPathAsync::DEFAULT_MEMORY_BUDGET);
+
+        {
+            auto firstStream = outputPath.Open("file.txt");
+            auto secondStream = outputPath.Open("file.txt");
+
+            *firstStream << "first";
+            *secondStream << "second";
+
+            // Finish the latest stream first to make sure the older stream does not overwrite it
+            secondStream.reset();
+        }
+
+        REQUIRE(outputPath.Flush());
+        REQUIRE(target.GetMockedFileList().size() == 1u);
+        REQUIRE(target.GetMockedFile("file.txt")->AsString() == "second");
+    }
+
+    TEST_CASE("OutputPathAsync: Writes file again when it is opened after it was written", "[searchpath]")
+    {
+        MockOutputPath target;
+        OutputPathAsync outputPath(target, 1u, OutputPathAsync::DEFAULT_MEMORY_BUDGET);
+
+        *outputPath.Open("file.txt") << "first";
+        REQUIRE(outputPath.Flush());
+
+        *outputPath.Open("file.txt") << "second";
+        REQUIRE(outputPath.Flush());
+
+        const auto& files = target.GetMockedFileList();
+        REQUIRE(files.size() == 2u);
+        REQUIRE(files[0].AsString() == "first");
+        REQUIRE(files[1].AsString() == "second");
+    }
+} // namespace test::search_path::output_path_async
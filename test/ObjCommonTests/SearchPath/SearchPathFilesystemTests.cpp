@@ -0,0 +1,129 @@
+#include "SearchPath/SearchPathFilesystem.h"
+
+#include "Utils/FileUtils.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace test::search_path::search_path_filesystem
+{
+    class TemporaryDirectory
+    {
+    public:
+        TemporaryDirectory()
+            : m_path(FileUtils::MakeTemporaryFilePath(fs::temp_directory_path() / "oat_search_path_filesystem_tests"))
+        {
+            fs::create_directories(m_path);
+        }
+
+        ~TemporaryDirectory()
+        {
+            std::error_code ec;
+            fs::remove_all(m_path, ec);
+        }
+
+        TemporaryDirectory(const TemporaryDirectory& other) = delete;
+        TemporaryDirectory(TemporaryDirectory&& other) noexcept = delete;
+        TemporaryDirectory& operator=(const TemporaryDirectory& other) = delete;
+        TemporaryDirectory& operator=(TemporaryDirectory&& other) noexcept = delete;
+
+        void WriteFile(const std::string& relativePath, const std::string& content) const
+        {
+            const auto filePath = m_path / relativePath;
+            fs::create_directories(filePath.parent_path());
+
+            std::ofstream stream(filePath, std::ios::out | std::ios::binary);
+            stream << content;
+        }
+
+        fs::path m_path;
+    };
+
+    std::string ReadContent(ISearchPath& searchPath, const std::string& fileName)
+    {
+        const auto content = searchPath.ReadFile(fileName);
+        REQUIRE(content);
+
+        return *content;
+    }
+
+    TEST_CASE("SearchPathFilesystem: Opens indexed files in subdirectories", "[searchpath]")
+    {
+        const TemporaryDirectory directory;
+        directory.WriteFile("materials/mc/test.json", "material");
+
+        SearchPathFilesystem searchPath(directory.m_path.string(), true);
+
+        REQUIRE(ReadContent(searchPath, "materials/mc/test.json") == "material");
+        REQUIRE(ReadContent(searchPath, "materials\\mc\\test.json") == "material");
+        REQUIRE(ReadContent(searchPath, "./materials//mc/test.json") == "material");
+    }
+
+    TEST_CASE("SearchPathFilesystem: Does not find missing indexed files", "[searchpath]")
+    {
+        const TemporaryDirectory directory;
+        directory.WriteFile("materials/test.json", "material");
+
+        SearchPathFilesystem searchPath(directory.m_path.string(), true);
+
+        REQUIRE(!searchPath.Open("materials/missing.json").IsOpen());
+        REQUIRE(!searchPath.Open("missing/test.json").IsOpen());
+        REQUIRE(!searchPath.Open("materials").IsOpen());
+        REQUIRE(!searchPath.Open("materials/test.json/child").IsOpen());
+    }
+
+    TEST_CASE("SearchPathFilesystem: Finds files created after indexing once invalidated", "[searchpath]")
+    {
+        const TemporaryDirectory directory;
+        directory.WriteFile("materials/existing.json", "existing");
+
+        SearchPathFilesystem searchPath(directory.m_path.string(), true);
+        REQUIRE(!searchPath.Open("materials/created.json").IsOpen());
+        REQUIRE(!searchPath.Open("created/created.json").IsOpen());
+
+        directory.WriteFile("materials/created.json", "created");
+        directory.WriteFile("created/created.json", "created");
+
+        // The index is only rebuilt when invalidated, so files created in the meantime are not found
+        REQUIRE(!searchPath.Open("materials/created.json").IsOpen());
+
+        searchPath.Invalidate();
+
+        REQUIRE(ReadContent(searchPath, "materials/created.json") == "created");
+        REQUIRE(ReadContent(searchPath, "created/created.json") == "created");
+        REQUIRE(ReadContent(searchPath, "materials/existing.json") == "existing");
+    }
+
+    TEST_CASE("SearchPathFilesystem: Matches indexed file names case-insensitively", "[searchpath]")
+    {
+        const TemporaryDirectory directory;
+        directory.WriteFile("Materials/MC/Test.json", "material");
+
+        SearchPathFilesystem searchPath(directory.m_path.string(), true);
+
+        REQUIRE(ReadContent(searchPath, "materials/mc/test.json") == "material");
+        REQUIRE(ReadContent(searchPath, "MATERIALS/Mc/TEST.JSON") == "material");
+        REQUIRE(ReadContent(searchPath, "Materials/MC/Test.json") == "material");
+    }
+
+    TEST_CASE("SearchPathFilesystem: Prefers indexed file names with the exact case", "[searchpath]")
+    {
+        const TemporaryDirectory directory;
+        directory.WriteFile("test.json", "lower");
+        directory.WriteFile("TEST.json", "upper");
+
+        // Only filesystems that are case-sensitive can contain both files
+        SearchPathFilesystem unindexedSearchPath(directory.m_path.string());
+        if (ReadContent(unindexedSearchPath, "test.json") != "lower")
+            return;
+
+        SearchPathFilesystem searchPath(directory.m_path.string(), true);
+
+        REQUIRE(ReadContent(searchPath, "test.json") == "lower");
+        REQUIRE(ReadContent(searchPath, "TEST.json") == "upper");
+    }
+} // namespace test::search_path::search_path_filesystem
@@ -70,7 +70,7 @@ namespace test::game::t6::keyvaluepairs
         TestContext testContext;
         const auto sut = testContext.CreateSut();
 
-        sut->FinalizeZone(testContext.m_context);
+        REQUIRE(sut->FinalizeZone(testContext.m_context));
 
         REQUIRE(testContext.m_memory.GetAllocationCount() == 0u);
         REQUIRE(testContext.m_zone.m_pools->GetTotalAssetCount() == 0u);
@@ -83,7 +83,7 @@ namespace test::game::t6::keyvaluepairs
 
         testContext.m_kvp_creator.AddKeyValuePair(CommonKeyValuePair("ipak_read", "test_ipak"));
 
-        sut->FinalizeZone(testContext.m_context);
+        REQUIRE(sut->FinalizeZone(testContext.m_context));
 
         REQUIRE(testContext.m_memory.GetAllocationCount() > 0u);
         REQUIRE(testContext.m_zone.m_pools->GetTotalAssetCount() == 1u);
@@ -109,7 +109,7 @@ namespace test::game::t6::keyvaluepairs
 
         testContext.m_kvp_creator.AddKeyValuePair(CommonKeyValuePair(0xDDEEFFAA, "hello_there"));
 
-        sut->FinalizeZone(testContext.m_context);
+        REQUIRE(sut->FinalizeZone(testContext.m_context));
 
         REQUIRE(testContext.m_memory.GetAllocationCount() > 0u);
         REQUIRE(testContext.m_zone.m_pools->GetTotalAssetCount() == 1u);
@@ -269,7 +269,7 @@ namespace test::image
         XAssetInfo<GfxImage> imageAsset1(ASSET_TYPE_IMAGE, "testImage1", nullptr);
         sut->PostProcessAsset(imageAsset1, testContext.m_context);
 
-        sut->FinalizeZone(testContext.m_context);
+        REQUIRE(sut->FinalizeZone(testContext.m_context));
 
         const auto* mockFile = testContext.m_out_dir.GetMockedFile("testIwd.iwd");
         REQUIRE(mockFile);
@@ -47,6 +47,7 @@ function ObjLoadingTests:project()
 		ObjCommonTestUtils:include(includes)
 		ParserTestUtils:include(includes)
 		ObjLoading:include(includes)
+		zlib:include(includes)
 		catch2:include(includes)
 
 		links:linkto(ObjCommonTestUtils)
@@ -0,0 +1,128 @@
+#include "Asset/AssetCreatorCollection.h"
+
+#include "Game/IW4/IW4.h"
+#include "SearchPath/MockSearchPath.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace IW4;
+
+namespace
+{
+    class MockAssetCreator final : public IAssetCreator
+    {
+    public:
+        MockAssetCreator(std::string name, std::vector<std::string> probedFileNames, const bool takesAction, std::vector<std::string>& calls)
+            : m_name(std::move(name)),
+              m_probed_file_names(std::move(probedFileNames)),
+              m_takes_action(takesAction),
+              m_calls(calls)
+        {
+        }
+
+        [[nodiscard]] std::optional<asset_type_t> GetHandlingAssetType() const override
+        {
+            return ASSET_TYPE_RAWFILE;
+        }
+
+        [[nodiscard]] std::vector<std::string> GetProbedFileNames(const std::string& assetName) const override
+        {
+            return m_probed_file_names;
+        }
+
+        AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) override
+        {
+            m_calls.emplace_back(m_name);
+
+            return m_takes_action ? AssetCreationResult::Failure() : AssetCreationResult::NoAction();
+        }
+
+    private:
+        std::string m_name;
+        std::vector<std::string> m_probed_file_names;
+        bool m_takes_action;
+        std::vector<std::string>& m_calls;
+    };
+
+    class CreatorCollectionTestHelper
+    {
+    public:
+        CreatorCollectionTestHelper()
+            : m_zone("MockZone", 0, IGame::GetGameById(GameId::IW4)),
+              m_creators(m_zone),
+              m_context(m_zone, &m_creators, &m_ignored_asset_lookup)
+        {
+        }
+
+        void AddCreator(std::string name, std::vector<std::string> probedFileNames, const bool takesAction)
+        {
+            m_creators.AddAssetCreator(std::make_unique<MockAssetCreator>(std::move(name), std::move(probedFileNames), takesAction, m_calls));
+        }
+
+        AssetCreationResult CreateAsset()
+        {
+            return m_creators.CreateAsset(ASSET_TYPE_RAWFILE, "test", m_context);
+        }
+
+        Zone m_zone;
+        MockSearchPath m_search_path;
+        AssetCreatorCollection m_creators;
+        IgnoredAssetLookup m_ignored_asset_lookup;
+        AssetCreationContext m_context;
+        std::vector<std::string> m_calls;
+    };
+
+    TEST_CASE("AssetCreatorCollection: Tries all creators in order without source index", "[asset][index]")
+    {
+        CreatorCollectionTestHelper helper;
+        helper.AddCreator("first", {"first.txt"}, false);
+        helper.AddCreator("second", {}, false);
+        helper.AddCreator("third", {"third.txt"}, true);
+
+        REQUIRE(helper.CreateAsset().HasTakenAction());
+        REQUIRE(helper.m_calls == std::vector<std::string>{"first", "second", "third"});
+    }
+
+    TEST_CASE("AssetCreatorCollection: Skips creators whose files are not indexed", "[asset][index]")
+    {
+        CreatorCollectionTestHelper helper;
+        helper.m_search_path.AddFileData("third.txt", "");
+        helper.AddCreator("first", {"first.txt"}, false);
+        helper.AddCreator("second", {}, false);
+        helper.AddCreator("third", {"third.txt"}, true);
+        helper.m_creators.BuildSourceIndex(helper.m_search_path);
+
+        REQUIRE(helper.CreateAsset().HasTakenAction());
+        REQUIRE(helper.m_calls == std::vector<std::string>{"second", "third"});
+    }
+
+    TEST_CASE("AssetCreatorCollection: Tries skipped creators in order when no other creator took action", "[asset][index]")
+    {
+        CreatorCollectionTestHelper helper;
+        helper.m_search_path.AddFileData("second.txt", "");
+        helper.AddCreator("first", {"first.txt"}, false);
+        helper.AddCreator("second", {"second.txt"}, false);
+        helper.AddCreator("third", {}, false);
+        helper.AddCreator("fourth", {"fourth.txt"}, true);
+        helper.m_creators.BuildSourceIndex(helper.m_search_path);
+
+        // The file of the fourth creator was added after building the index
+        REQUIRE(helper.CreateAsset().HasTakenAction());
+        REQUIRE(helper.m_calls == std::vector<std::string>{"second", "third", "first", "fourth"});
+    }
+
+    TEST_CASE("AssetCreatorCollection: Tries skipped creators after all other creators", "[asset][index]")
+    {
+        CreatorCollectionTestHelper helper;
+        helper.AddCreator("first", {"first.txt"}, true);
+        helper.AddCreator("second", {}, true);
+        helper.m_creators.BuildSourceIndex(helper.m_search_path);
+
+        // The file of the first creator was added after building the index, so the creator only gets to take action when no other creator does
+        REQUIRE(helper.CreateAsset().HasTakenAction());
+        REQUIRE(helper.m_calls == std::vector<std::string>{"second"});
+    }
+} // namespace
@@ -0,0 +1,42 @@
+#include "Asset/AssetSourceIndex.h"
+
+#include "SearchPath/MockSearchPath.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    TEST_CASE("AssetSourceIndex: Contains files of search path", "[asset][index]")
+    {
+        MockSearchPath searchPath;
+        searchPath.AddFileData("images/test.iwi", "");
+        searchPath.AddFileData("weapons/mp/test_mp", "");
+
+        AssetSourceIndex index;
+        index.AddFilesOfSearchPath(searchPath);
+
+        REQUIRE(index.ContainsFile("images/test.iwi"));
+        REQUIRE(index.ContainsFile("weapons/mp/test_mp"));
+        REQUIRE(!index.ContainsFile("images/other.iwi"));
+        REQUIRE(!index.ContainsFile("test.iwi.json"));
+    }
+
+    TEST_CASE("AssetSourceIndex: Ignores case and path separators", "[asset][index]")
+    {
+        AssetSourceIndex index;
+        index.AddFile("Materials\\Test_Material.json");
+
+        REQUIRE(index.ContainsFile("materials/test_material.json"));
+        REQUIRE(index.ContainsFile("MATERIALS\\TEST_MATERIAL.JSON"));
+    }
+
+    TEST_CASE("AssetSourceIndex: Contains files prefixed with search path", "[asset][index]")
+    {
+        AssetSourceIndex index;
+        index.AddFile("/home/user/raw/xmodel/test.json");
+
+        REQUIRE(index.ContainsFile("xmodel/test.json"));
+        REQUIRE(index.ContainsFile("test.json"));
+        REQUIRE(!index.ContainsFile("xmodel/other.json"));
+    }
+} // namespace
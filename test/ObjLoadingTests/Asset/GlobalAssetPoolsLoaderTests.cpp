@@ -0,0 +1,174 @@
+#include "Asset/GlobalAssetPoolsLoader.h"
+
+#include "Asset/AssetCreatorCollection.h"
+#include "Game/IW4/IW4.h"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace IW4;
+
+namespace
+{
+    class MockImageCreator final : public AssetCreator<AssetImage>
+    {
+    public:
+        MockImageCreator(std::string imageName, GfxImage& image)
+            : m_image_name(std::move(imageName)),
+              m_image(image)
+        {
+        }
+
+        AssetCreationResult CreateAsset(const std::string& assetName, AssetCreationContext& context) override
+        {
+            if (assetName != m_image_name)
+                return AssetCreationResult::NoAction();
+
+            return AssetCreationResult::Success(context.AddAsset<AssetImage>(assetName, &m_image));
+        }
+
+    private:
+        std::string m_image_name;
+        GfxImage& m_image;
+    };
+
+    class ReuseTestHelper
+    {
+    public:
+        ReuseTestHelper()
+            : m_source_zone("SourceZone", 0, IGame::GetGameById(GameId::IW4)),
+              m_other_source_zone("OtherSourceZone", 0, IGame::GetGameById(GameId::IW4)),
+              m_zone("MockZone", 0, IGame::GetGameById(GameId::IW4)),
+              m_creators(m_zone),
+              m_context(m_zone, &m_creators, &m_ignored_asset_lookup)
+        {
+        }
+
+        void AddReuseCreators()
+        {
+            m_creators.AddAssetCreator(std::make_unique<GlobalAssetPoolsLoader<AssetMaterial>>(m_zone));
+            m_creators.AddAssetCreator(std::make_unique<GlobalAssetPoolsLoader<AssetImage>>(m_zone));
+        }
+
+        XAssetInfoGeneric* AddSourceImage(Zone& sourceZone, const std::string& name, GfxImage& image)
+        {
+            return sourceZone.m_pools->AddAsset(ASSET_TYPE_IMAGE, name, &image, {}, {}, {});
+        }
+
+        XAssetInfoGeneric* AddSourceMaterial(
+            Zone& sourceZone, const std::string& name, Material& material, std::vector<XAssetInfoGeneric*> dependencies, std::vector<scr_string_t> usedScriptStrings)
+        {
+            return sourceZone.m_pools->AddAsset(ASSET_TYPE_MATERIAL, name, &material, std::move(dependencies), std::move(usedScriptStrings), {});
+        }
+
+        [[nodiscard]] std::vector<std::string> ScriptStrings() const
+        {
+            return std::vector<std::string>(m_zone.m_script_strings.begin(), m_zone.m_script_strings.end());
+        }
+
+        GfxImage m_source_image0{};
+        GfxImage m_source_image1{};
+        GfxImage m_loose_image{};
+        Material m_source_material0{};
+        Material m_source_material1{};
+        Material m_other_source_material{};
+
+        Zone m_source_zone;
+        Zone m_other_source_zone;
+        Zone m_zone;
+        AssetCreatorCollection m_creators;
+        IgnoredAssetLookup m_ignored_asset_lookup;
+        AssetCreationContext m_context;
+    };
+
+    TEST_CASE("GlobalAssetPoolsLoader: Reuses assets of loaded zones with their dependencies", "[asset][reuse]")
+    {
+        ReuseTestHelper helper;
+        auto* sourceImage0 = helper.AddSourceImage(helper.m_source_zone, "image0", helper.m_source_image0);
+        auto* sourceImage1 = helper.AddSourceImage(helper.m_source_zone, "image1", helper.m_source_image1);
+        helper.AddSourceMaterial(helper.m_source_zone, "material0", helper.m_source_material0, {sourceImage0, sourceImage1}, {});
+        helper.AddSourceMaterial(helper.m_source_zone, "material1", helper.m_source_material1, {sourceImage1}, {});
+        helper.AddReuseCreators();
+
+        auto* material0 = helper.m_context.LoadDependency<AssetMaterial>("material0");
+        auto* material1 = helper.m_context.LoadDependency<AssetMaterial>("material1");
+        REQUIRE(material0);
+        REQUIRE(material1);
+        REQUIRE(material0->Asset() == &helper.m_source_material0);
+        REQUIRE(material0->m_zone == &helper.m_source_zone);
+
+        auto* image0 = helper.m_zone.m_pools->GetAsset(ASSET_TYPE_IMAGE, "image0");
+        auto* image1 = helper.m_zone.m_pools->GetAsset(ASSET_TYPE_IMAGE, "image1");
+        REQUIRE(image0);
+        REQUIRE(image1);
+        REQUIRE(image0->m_zone == &helper.m_source_zone);
+        REQUIRE(material0->m_dependencies.size() == 2u);
+        REQUIRE(std::ranges::find(material0->m_dependencies, image0) != material0->m_dependencies.end());
+        REQUIRE(std::ranges::find(material0->m_dependencies, image1) != material0->m_dependencies.end());
+
+        // The shared dependency is only added to the zone once
+        REQUIRE(material1->m_dependencies == std::vector{image1});
+        REQUIRE(helper.m_zone.m_pools->GetTotalAssetCount() == 4u);
+    }
+
+    TEST_CASE("GlobalAssetPoolsLoader: Dependencies of reused assets are still created by other creators", "[asset][reuse]")
+    {
+        ReuseTestHelper helper;
+        auto* sourceImage0 = helper.AddSourceImage(helper.m_source_zone, "image0", helper.m_source_image0);
+        auto* sourceImage1 = helper.AddSourceImage(helper.m_source_zone, "image1", helper.m_source_image1);
+        helper.AddSourceMaterial(helper.m_source_zone, "material0", helper.m_source_material0, {sourceImage0, sourceImage1}, {});
+        helper.AddSourceMaterial(helper.m_source_zone, "material1", helper.m_source_material1, {sourceImage1}, {});
+
+        // A loose image takes precedence over the image of the loaded zone
+        helper.m_creators.AddAssetCreator(std::make_unique<MockImageCreator>("image1", helper.m_loose_image));
+        helper.AddReuseCreators();
+
+        auto* material0 = helper.m_context.LoadDependency<AssetMaterial>("material0");
+        auto* material1 = helper.m_context.LoadDependency<AssetMaterial>("material1");
+        REQUIRE(material0);
+        REQUIRE(material1);
+
+        auto* image1 = helper.m_zone.m_pools->GetAsset(ASSET_TYPE_IMAGE, "image1");
+        REQUIRE(image1);
+        REQUIRE(image1->m_ptr == &helper.m_loose_image);
+        REQUIRE(image1->m_zone == &helper.m_zone);
+        REQUIRE(std::ranges::find(material0->m_dependencies, image1) != material0->m_dependencies.end());
+        REQUIRE(material1->m_dependencies == std::vector{image1});
+    }
+
+    TEST_CASE("GlobalAssetPoolsLoader: Imports the script strings of reused assets once", "[asset][reuse]")
+    {
+        ReuseTestHelper helper;
+        const auto sourceFoo = helper.m_source_zone.m_script_strings.AddOrGetScriptString("foo");
+        const auto sourceBar = helper.m_source_zone.m_script_strings.AddOrGetScriptString("bar");
+        const auto sourceUnused = helper.m_source_zone.m_script_strings.AddOrGetScriptString("unused");
+        const auto otherSourceBaz = helper.m_other_source_zone.m_script_strings.AddOrGetScriptString("baz");
+        const auto otherSourceFoo = helper.m_other_source_zone.m_script_strings.AddOrGetScriptString("foo");
+        REQUIRE(sourceUnused != sourceFoo);
+        REQUIRE(otherSourceFoo != sourceFoo);
+
+        helper.AddSourceMaterial(helper.m_source_zone, "material0", helper.m_source_material0, {}, {sourceFoo, sourceBar});
+        helper.AddSourceMaterial(helper.m_source_zone, "material1", helper.m_source_material1, {}, {sourceBar, sourceFoo});
+        helper.AddSourceMaterial(helper.m_other_source_zone, "material2", helper.m_other_source_material, {}, {otherSourceBaz, otherSourceFoo});
+        helper.m_zone.m_script_strings.AddOrGetScriptString("existing");
+        helper.AddReuseCreators();
+
+        REQUIRE(helper.m_context.LoadDependency<AssetMaterial>("material0"));
+        REQUIRE(helper.m_context.LoadDependency<AssetMaterial>("material1"));
+        REQUIRE(helper.m_context.LoadDependency<AssetMaterial>("material2"));
+
+        REQUIRE(helper.ScriptStrings() == std::vector<std::string>{"", "existing", "foo", "bar", "baz"});
+    }
+
+    TEST_CASE("GlobalAssetPoolsLoader: Does not take action for assets that are not loaded", "[asset][reuse]")
+    {
+        ReuseTestHelper helper;
+        helper.AddReuseCreators();
+
+        GlobalAssetPoolsLoader<AssetMaterial> loader(helper.m_zone);
+        REQUIRE(!loader.CreateAsset("material0", helper.m_context).HasTakenAction());
+    }
+} // namespace
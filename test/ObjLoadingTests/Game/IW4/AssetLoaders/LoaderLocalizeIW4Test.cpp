@@ -0,0 +1,121 @@
+#include "Game/IW4/Localize/LoaderLocalizeIW4.h"
+
+#include "Game/IW4/CommonIW4.h"
+#include "Game/IW4/GameIW4.h"
+#include "SearchPath/MockSearchPath.h"
+#include "Utils/MemoryManager.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <format>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace IW4;
+using namespace std::literals;
+
+namespace
+{
+    class CerrCapture
+    {
+    public:
+        CerrCapture()
+            : m_previous_buffer(std::cerr.rdbuf(m_stream.rdbuf()))
+        {
+        }
+
+        ~CerrCapture()
+        {
+            std::cerr.rdbuf(m_previous_buffer);
+        }
+
+        CerrCapture(const CerrCapture& other) = delete;
+        CerrCapture(CerrCapture&& other) noexcept = delete;
+        CerrCapture& operator=(const CerrCapture& other) = delete;
+        CerrCapture& operator=(CerrCapture&& other) noexcept = delete;
+
+        [[nodiscard]] std::string GetOutput() const
+        {
+            return m_stream.str();
+        }
+
+    private:
+        std::ostringstream m_stream;
+        std::streambuf* m_previous_buffer;
+    };
+
+    TEST_CASE("LoaderLocalize(IW4): Creates entries of prepared localize files", "[iw4][localize][assetloader]")
+    {
+        MockSearchPath searchPath;
+        searchPath.AddFileData("english/localizedstrings/menu.str",
+                               "VERSION \"1\"\n"
+                               "REFERENCE MENU_PLAY\n"
+                               "LANG_ENGLISH \"Play\"\n"
+                               "ENDMARKER\n");
+        searchPath.AddFileData("english/localizedstrings/game.str",
+                               "VERSION \"1\"\n"
+                               "REFERENCE GAME_WIN\n"
+                               "LANG_ENGLISH \"You win\"\n"
+                               "REFERENCE GAME_LOSE\n"
+                               "LANG_ENGLISH \"You lose\"\n"
+                               "ENDMARKER\n");
+
+        Zone zone("MockZone", 0, IGame::GetGameById(GameId::IW4));
+        zone.m_language = GameLanguage::LANGUAGE_ENGLISH;
+
+        MemoryManager memory;
+        AssetCreatorCollection creatorCollection(zone);
+        IgnoredAssetLookup ignoredAssetLookup;
+        AssetCreationContext context(zone, &creatorCollection, &ignoredAssetLookup);
+
+        auto loader = CreateLocalizeLoader(memory, searchPath, zone);
+        loader->PrepareAssets({"menu", "game"});
+
+        REQUIRE(loader->CreateAsset("menu", context).HasBeenSuccessful());
+        REQUIRE(loader->CreateAsset("game", context).HasBeenSuccessful());
+        REQUIRE(!loader->CreateAsset("missing", context).HasTakenAction());
+
+        const auto* playEntry = zone.m_pools->GetAsset(ASSET_TYPE_LOCALIZE_ENTRY, "MENU_PLAY");
+        REQUIRE(playEntry);
+        REQUIRE(static_cast<LocalizeEntry*>(playEntry->m_ptr)->value == "Play"s);
+
+        const auto* loseEntry = zone.m_pools->GetAsset(ASSET_TYPE_LOCALIZE_ENTRY, "GAME_LOSE");
+        REQUIRE(loseEntry);
+        REQUIRE(static_cast<LocalizeEntry*>(loseEntry->m_ptr)->value == "You lose"s);
+    }
+
+    TEST_CASE("LoaderLocalize(IW4): Prints parsing errors of prepared localize files in order", "[iw4][localize][assetloader]")
+    {
+        constexpr auto FILE_COUNT = 16u;
+
+        MockSearchPath searchPath;
+        std::vector<std::string> assetNames;
+        for (auto i = 0u; i < FILE_COUNT; i++)
+        {
+            assetNames.emplace_back(std::format("broken_{}", i));
+            searchPath.AddFileData(std::format("english/localizedstrings/broken_{}.str", i), "REFERENCE\n");
+        }
+
+        Zone zone("MockZone", 0, IGame::GetGameById(GameId::IW4));
+        zone.m_language = GameLanguage::LANGUAGE_ENGLISH;
+
+        MemoryManager memory;
+        auto loader = CreateLocalizeLoader(memory, searchPath, zone);
+
+        std::string output;
+        {
+            const CerrCapture capture;
+            loader->PrepareAssets(assetNames);
+            output = capture.GetOutput();
+        }
+
+        auto lastPosition = 0uz;
+        for (const auto& assetName : assetNames)
+        {
+            const auto position = output.find(std::format("{} L", assetName), lastPosition);
+            REQUIRE(position != std::string::npos);
+            lastPosition = position;
+        }
+    }
+} // namespace
@@ -9,6 +9,7 @@
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 using namespace menu;
@@ -379,4 +380,166 @@ namespace test::game::iw4::menu::parsing::it
         REQUIRE(item->action->eventHandlers[1]->eventData.unconditionalScript != nullptr);
         REQUIRE(item->action->eventHandlers[1]->eventData.unconditionalScript == R"("play" "lol" ; )"s);
     }
+
+    TEST_CASE("MenuParsingIW4IT: Menu files can use functions of previously loaded menu files", "[parsing][converting][menu][it]")
+    {
+        MenuParsingItHelper helper;
+
+        helper.AddFile(R"testmenu(
+{
+	loadMenu { "ui/first.menu" }
+	loadMenu { "ui/second.menu" }
+}
+			)testmenu");
+
+        helper.AddFile("ui/first.menu", R"testmenu(
+{
+	functionDef
+	{
+		name "IsVisible"
+		value ( dvarBool( "ui_visible" ) )
+	}
+	menuDef
+	{
+		name "First"
+		visible when ( IsVisible() )
+	}
+}
+			)testmenu");
+
+        helper.AddFile("ui/second.menu", R"testmenu(
+{
+	functionDef
+	{
+		name "IsVisible"
+		value ( dvarBool( "ui_visible" ) )
+	}
+	menuDef
+	{
+		name "Second"
+		visible when ( IsVisible() )
+	}
+}
+			)testmenu");
+
+        const auto result = helper.RunIntegrationTest();
+        REQUIRE(result.HasBeenSuccessful());
+
+        const auto* menuList = (MenuList*)result.GetAssetInfo()->m_ptr;
+        const auto* firstMenu = helper.GetMenuAsset("First");
+        const auto* secondMenu = helper.GetMenuAsset("Second");
+
+        REQUIRE(menuList->menuCount == 2);
+        REQUIRE(menuList->menus[0] == firstMenu);
+        REQUIRE(menuList->menus[1] == secondMenu);
+
+        REQUIRE(firstMenu->visibleExp != nullptr);
+        REQUIRE(secondMenu->visibleExp != nullptr);
+        REQUIRE(secondMenu->visibleExp->numEntries == firstMenu->visibleExp->numEntries);
+    }
+
+    TEST_CASE("MenuParsingIW4IT: Menu files cannot redefine functions of previously loaded menu files", "[parsing][converting][menu][it]")
+    {
+        MenuParsingItHelper helper;
+
+        helper.AddFile(R"testmenu(
+{
+	loadMenu { "ui/first.menu" }
+	loadMenu { "ui/second.menu" }
+}
+			)testmenu");
+
+        helper.AddFile("ui/first.menu", R"testmenu(
+{
+	functionDef
+	{
+		name "IsVisible"
+		value ( 1 )
+	}
+	menuDef
+	{
+		name "First"
+	}
+}
+			)testmenu");
+
+        helper.AddFile("ui/second.menu", R"testmenu(
+{
+	functionDef
+	{
+		name "IsVisible"
+		value ( 0 )
+	}
+	menuDef
+	{
+		name "Second"
+	}
+}
+			)testmenu");
+
+        const auto result = helper.RunIntegrationTest();
+        REQUIRE(result.HasBeenSuccessful());
+
+        const auto* menuList = (MenuList*)result.GetAssetInfo()->m_ptr;
+        REQUIRE(menuList->menuCount == 1);
+        REQUIRE(menuList->menus[0] == helper.GetMenuAsset("First"));
+    }
+
+    TEST_CASE("MenuParsingIW4IT: Errors of menu files are printed once in the order of the menu files", "[parsing][converting][menu][it]")
+    {
+        MenuParsingItHelper helper;
+
+        helper.AddFile(R"testmenu(
+{
+	loadMenu { "ui/first.menu" }
+	loadMenu { "ui/second.menu" }
+	loadMenu { "ui/third.menu" }
+}
+			)testmenu");
+
+        helper.AddFile("ui/first.menu", R"testmenu(
+{
+	menuDef
+	{
+		name "First"
+		notAProperty
+	}
+}
+			)testmenu");
+
+        helper.AddFile("ui/second.menu", R"testmenu(
+{
+	menuDef
+	{
+		name "Second"
+	}
+}
+			)testmenu");
+
+        helper.AddFile("ui/third.menu", R"testmenu(
+{
+	menuDef
+	{
+		name "Third"
+		notAProperty
+	}
+}
+			)testmenu");
+
+        std::ostringstream errors;
+        auto* previousErrorBuffer = std::cerr.rdbuf(errors.rdbuf());
+        const auto result = helper.RunIntegrationTest();
+        std::cerr.rdbuf(previousErrorBuffer);
+
+        REQUIRE(result.HasBeenSuccessful());
+
+        const auto output = errors.str();
+        const auto firstError = output.find("Error: ui/first.menu");
+        const auto thirdError = output.find("Error: ui/third.menu");
+        REQUIRE(firstError != std::string::npos);
+        REQUIRE(thirdError != std::string::npos);
+        REQUIRE(firstError < thirdError);
+        REQUIRE(output.rfind("Error: ui/first.menu") == firstError);
+        REQUIRE(output.rfind("Error: ui/third.menu") == thirdError);
+    }
 } // namespace test::game::iw4::menu::parsing::it
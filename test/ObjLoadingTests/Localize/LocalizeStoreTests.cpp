@@ -0,0 +1,96 @@
+#include "Localize/LocalizeStore.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    const std::string FIRST_FILE = R"(VERSION "1"
+CONFIG "C:\trees\cod3\cod3\bin\StringEd.cfg"
+FILENOTES ""
+
+REFERENCE MENU_PLAY
+LANG_ENGLISH "Play"
+LANG_FRENCH "Jouer"
+
+REFERENCE MENU_QUIT
+LANG_ENGLISH "Quit"
+
+ENDMARKER
+)";
+
+    const std::string SECOND_FILE = R"(VERSION "1"
+CONFIG "C:\trees\cod3\cod3\bin\StringEd.cfg"
+FILENOTES ""
+
+REFERENCE MENU_QUIT
+LANG_ENGLISH "Quit game"
+
+ENDMARKER
+)";
+
+    TEST_CASE("LocalizeStore: Parses entries of the zone language", "[localize]")
+    {
+        LocalizeStore store;
+        std::ostringstream diagnostics;
+
+        const auto file = store.GetOrParse("english/localizedstrings/menu.str", "menu", GameLanguage::LANGUAGE_ENGLISH, FIRST_FILE, diagnostics);
+        REQUIRE(file);
+        REQUIRE(diagnostics.str().empty());
+
+        REQUIRE(file->m_entries.size() == 2u);
+        REQUIRE(file->m_entries[0].m_key == "MENU_PLAY");
+        REQUIRE(file->m_entries[0].m_value == "Play");
+        REQUIRE(file->m_entries[1].m_key == "MENU_QUIT");
+        REQUIRE(file->m_entries[1].m_value == "Quit");
+
+        REQUIRE(file->m_interned_keys.size() == 2u);
+        REQUIRE(*file->m_interned_keys[0] == "MENU_PLAY");
+        REQUIRE(*file->m_interned_keys[1] == "MENU_QUIT");
+    }
+
+    TEST_CASE("LocalizeStore: Shares files with the same content", "[localize]")
+    {
+        LocalizeStore store;
+        std::ostringstream diagnostics;
+
+        const auto file = store.GetOrParse("english/localizedstrings/menu.str", "menu", GameLanguage::LANGUAGE_ENGLISH, FIRST_FILE, diagnostics);
+        const auto sameFile =
+            store.GetOrParse("english/localizedstrings/menu.str", "menu", GameLanguage::LANGUAGE_ENGLISH, std::string(FIRST_FILE), diagnostics);
+        const auto changedFile = store.GetOrParse("english/localizedstrings/menu.str", "menu", GameLanguage::LANGUAGE_ENGLISH, SECOND_FILE, diagnostics);
+
+        REQUIRE(file);
+        REQUIRE(file == sameFile);
+        REQUIRE(changedFile);
+        REQUIRE(changedFile != file);
+        REQUIRE(changedFile->m_entries[0].m_value == "Quit game");
+    }
+
+    TEST_CASE("LocalizeStore: Interns equal keys of different files", "[localize]")
+    {
+        LocalizeStore store;
+        std::ostringstream diagnostics;
+
+        const auto firstFile = store.GetOrParse("english/localizedstrings/menu.str", "menu", GameLanguage::LANGUAGE_ENGLISH, FIRST_FILE, diagnostics);
+        const auto secondFile = store.GetOrParse("english/localizedstrings/game.str", "game", GameLanguage::LANGUAGE_ENGLISH, SECOND_FILE, diagnostics);
+
+        REQUIRE(firstFile);
+        REQUIRE(secondFile);
+        REQUIRE(firstFile->m_interned_keys[1] == secondFile->m_interned_keys[0]);
+        REQUIRE(firstFile->m_interned_keys[0] != secondFile->m_interned_keys[0]);
+    }
+
+    TEST_CASE("LocalizeStore: Prints parsing errors to the diagnostic stream", "[localize]")
+    {
+        LocalizeStore store;
+        std::ostringstream diagnostics;
+
+        const auto file =
+            store.GetOrParse("english/localizedstrings/broken.str", "broken", GameLanguage::LANGUAGE_ENGLISH, "REFERENCE\nLANG_ENGLISH\n", diagnostics);
+
+        REQUIRE(!file);
+        REQUIRE(diagnostics.str().find("broken") != std::string::npos);
+        REQUIRE(diagnostics.str().find("Parsing localization file failed!") != std::string::npos);
+    }
+} // namespace
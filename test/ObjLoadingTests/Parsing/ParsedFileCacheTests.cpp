@@ -0,0 +1,61 @@
+#include "Parsing/ParsedFileCache.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+
+using namespace std::string_literals;
+
+namespace
+{
+    TEST_CASE("ParsedFileCache: Parses identical files only once", "[parsing][cache]")
+    {
+        ParsedFileCache<std::string> cache;
+        auto parseCount = 0u;
+        const auto parse = [&parseCount](const std::string& content)
+        {
+            parseCount++;
+            return std::make_unique<std::string>(content + " parsed");
+        };
+
+        const auto first = cache.GetOrParse("techsets/test.techset", "content", parse);
+        const auto second = cache.GetOrParse("techsets/test.techset", "content", parse);
+
+        REQUIRE(parseCount == 1u);
+        REQUIRE(first);
+        REQUIRE(first == second);
+        REQUIRE(*first == "content parsed"s);
+    }
+
+    TEST_CASE("ParsedFileCache: Parses files with the same name but different content separately", "[parsing][cache]")
+    {
+        ParsedFileCache<std::string> cache;
+        const auto parse = [](const std::string& content)
+        {
+            return std::make_unique<std::string>(content);
+        };
+
+        const auto first = cache.GetOrParse("techsets/test.techset", "first", parse);
+        const auto second = cache.GetOrParse("techsets/test.techset", "second", parse);
+        const auto firstAgain = cache.GetOrParse("techsets/test.techset", "first", parse);
+
+        REQUIRE(*first == "first"s);
+        REQUIRE(*second == "second"s);
+        REQUIRE(first == firstAgain);
+    }
+
+    TEST_CASE("ParsedFileCache: Does not cache parse failures", "[parsing][cache]")
+    {
+        ParsedFileCache<std::string> cache;
+        auto parseCount = 0u;
+        const auto parse = [&parseCount](const std::string& content) -> std::unique_ptr<std::string>
+        {
+            parseCount++;
+            return nullptr;
+        };
+
+        REQUIRE(!cache.GetOrParse("techsets/test.techset", "content", parse));
+        REQUIRE(!cache.GetOrParse("techsets/test.techset", "content", parse));
+        REQUIRE(parseCount == 2u);
+    }
+} // namespace
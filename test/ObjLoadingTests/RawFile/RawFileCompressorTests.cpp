@@ -0,0 +1,208 @@
+#include "RawFile/RawFileCompressor.h"
+
+#include "Utils/FileUtils.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    class TemporaryCacheDirectory
+    {
+    public:
+        TemporaryCacheDirectory()
+            : m_path(FileUtils::MakeTemporaryFilePath(fs::temp_directory_path() / "oat_rawfile_compressor_tests"))
+        {
+            fs::create_directories(m_path);
+        }
+
+        ~TemporaryCacheDirectory()
+        {
+            std::error_code ec;
+            fs::remove_all(m_path, ec);
+        }
+
+        TemporaryCacheDirectory(const TemporaryCacheDirectory& other) = delete;
+        TemporaryCacheDirectory(TemporaryCacheDirectory&& other) noexcept = delete;
+        TemporaryCacheDirectory& operator=(const TemporaryCacheDirectory& other) = delete;
+        TemporaryCacheDirectory& operator=(TemporaryCacheDirectory&& other) noexcept = delete;
+
+        [[nodiscard]] std::vector<fs::path> GetCacheFiles() const
+        {
+            std::vector<fs::path> cacheFiles;
+            for (const auto& entry : fs::recursive_directory_iterator(m_path))
+            {
+                if (entry.is_regular_file())
+                    cacheFiles.emplace_back(entry.path());
+            }
+
+            return cacheFiles;
+        }
+
+        fs::path m_path;
+    };
+
+    std::string Inflate(const std::vector<char>& compressedData, const int windowBits, const size_t uncompressedSize)
+    {
+        z_stream_s zs{};
+        REQUIRE(inflateInit2(&zs, windowBits) == Z_OK);
+
+        std::string data(uncompressedSize, '\0');
+        zs.avail_in = static_cast<uInt>(compressedData.size());
+        zs.avail_out = static_cast<uInt>(data.size());
+        zs.next_in = reinterpret_cast<const Bytef*>(compressedData.data());
+        zs.next_out = reinterpret_cast<Bytef*>(data.data());
+
+        const auto ret = inflate(&zs, Z_FINISH);
+        inflateEnd(&zs);
+
+        REQUIRE(ret == Z_STREAM_END);
+        REQUIRE(zs.avail_out == 0u);
+
+        return data;
+    }
+
+    std::vector<char> CompressSingle(RawFileCompressor& compressor, std::string data, const int windowBits)
+    {
+        std::vector<char> result;
+        compressor.Enqueue("test", std::move(data), windowBits,
+                           [&result](const std::span<const char> compressedData)
+                           {
+                               result.assign(compressedData.begin(), compressedData.end());
+                           });
+        REQUIRE(compressor.CompressQueued());
+
+        return result;
+    }
+
+    std::string CreateTestData(const unsigned seed)
+    {
+        std::string data;
+        for (auto i = 0u; i < 1000u; i++)
+            data += std::format("line {} of file {}\n", i, seed);
+
+        return data;
+    }
+
+    TEST_CASE("RawFileCompressor: Compresses zlib and raw deflate streams", "[rawfile]")
+    {
+        RawFileCompressor compressor;
+        const auto data = CreateTestData(0u);
+
+        const auto zlibData = CompressSingle(compressor, data, MAX_WBITS);
+        REQUIRE(zlibData.size() < data.size());
+        REQUIRE(Inflate(zlibData, MAX_WBITS, data.size()) == data);
+
+        const auto deflateData = CompressSingle(compressor, data, -MAX_WBITS);
+        REQUIRE(deflateData.size() < data.size());
+        REQUIRE(Inflate(deflateData, -MAX_WBITS, data.size()) == data);
+    }
+
+    TEST_CASE("RawFileCompressor: Calls callbacks in the order data was queued", "[rawfile]")
+    {
+        RawFileCompressor compressor;
+
+        std::vector<unsigned> callbackOrder;
+        for (auto i = 0u; i < 64u; i++)
+        {
+            compressor.Enqueue(std::format("test_{}", i),
+                               CreateTestData(i),
+                               MAX_WBITS,
+                               [i, &callbackOrder](const std::span<const char> compressedData)
+                               {
+                                   const std::vector data(compressedData.begin(), compressedData.end());
+                                   REQUIRE(Inflate(data, MAX_WBITS, CreateTestData(i).size()) == CreateTestData(i));
+                                   callbackOrder.emplace_back(i);
+                               });
+        }
+
+        REQUIRE(compressor.CompressQueued());
+
+        REQUIRE(callbackOrder.size() == 64u);
+        for (auto i = 0u; i < 64u; i++)
+            REQUIRE(callbackOrder[i] == i);
+    }
+
+    TEST_CASE("RawFileCompressor: Reads compressed data from cache", "[rawfile]")
+    {
+        const TemporaryCacheDirectory cacheDirectory;
+        const auto data = CreateTestData(0u);
+
+        RawFileCompressor firstCompressor;
+        firstCompressor.SetCacheDirectory(cacheDirectory.m_path);
+        const auto compressedData = CompressSingle(firstCompressor, data, MAX_WBITS);
+
+        const auto cacheFiles = cacheDirectory.GetCacheFiles();
+        REQUIRE(cacheFiles.size() == 1u);
+
+        // Replace the cached data with a valid cache file of other data to be able to tell it was read
+        const auto otherCompressedData = CompressSingle(firstCompressor, CreateTestData(1u), MAX_WBITS);
+        const auto otherCacheFiles = cacheDirectory.GetCacheFiles();
+        REQUIRE(otherCacheFiles.size() == 2u);
+        const auto& otherCacheFile = otherCacheFiles[0] == cacheFiles[0] ? otherCacheFiles[1] : otherCacheFiles[0];
+        fs::copy_file(otherCacheFile, cacheFiles[0], fs::copy_options::overwrite_existing);
+
+        RawFileCompressor secondCompressor;
+        secondCompressor.SetCacheDirectory(cacheDirectory.m_path);
+        REQUIRE(CompressSingle(secondCompressor, data, MAX_WBITS) == otherCompressedData);
+        REQUIRE(compressedData != otherCompressedData);
+    }
+
+    TEST_CASE("RawFileCompressor: Does not use corrupted cache files", "[rawfile]")
+    {
+        const TemporaryCacheDirectory cacheDirectory;
+        const auto data = CreateTestData(0u);
+
+        RawFileCompressor firstCompressor;
+        firstCompressor.SetCacheDirectory(cacheDirectory.m_path);
+        const auto compressedData = CompressSingle(firstCompressor, data, MAX_WBITS);
+
+        const auto cacheFiles = cacheDirectory.GetCacheFiles();
+        REQUIRE(cacheFiles.size() == 1u);
+
+        // Flip the last byte of the compressed data without changing the size of the file
+        {
+            std::fstream cacheFile(cacheFiles[0], std::ios::in | std::ios::out | std::ios::binary);
+            cacheFile.seekg(-1, std::ios::end);
+            const auto lastByte = static_cast<char>(cacheFile.get());
+            cacheFile.seekp(-1, std::ios::end);
+            cacheFile.put(static_cast<char>(~lastByte));
+        }
+
+        RawFileCompressor secondCompressor;
+        secondCompressor.SetCacheDirectory(cacheDirectory.m_path);
+        const auto recompressedData = CompressSingle(secondCompressor, data, MAX_WBITS);
+        REQUIRE(recompressedData == compressedData);
+        REQUIRE(Inflate(recompressedData, MAX_WBITS, data.size()) == data);
+    }
+
+    TEST_CASE("RawFileCompressor: Removes least recently used cache files when exceeding cache size limit", "[rawfile]")
+    {
+        const TemporaryCacheDirectory cacheDirectory;
+
+        RawFileCompressor compressor;
+        compressor.SetCacheDirectory(cacheDirectory.m_path);
+        CompressSingle(compressor, CreateTestData(0u), MAX_WBITS);
+
+        const auto cacheFiles = cacheDirectory.GetCacheFiles();
+        REQUIRE(cacheFiles.size() == 1u);
+        const auto cacheFileSize = fs::file_size(cacheFiles[0]);
+
+        // Make the first file the least recently used one regardless of the timestamp resolution of the file system
+        fs::last_write_time(cacheFiles[0], fs::last_write_time(cacheFiles[0]) - std::chrono::hours(1));
+
+        compressor.SetCacheSizeLimit(static_cast<size_t>(cacheFileSize) * 3u / 2u);
+        CompressSingle(compressor, CreateTestData(1u), MAX_WBITS);
+
+        const auto remainingCacheFiles = cacheDirectory.GetCacheFiles();
+        REQUIRE(remainingCacheFiles.size() == 1u);
+        REQUIRE(remainingCacheFiles[0] != cacheFiles[0]);
+    }
+} // namespace
@@ -0,0 +1,269 @@
+#include "XModel/Tangentspace.h"
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using vec3 = std::array<float, 3>;
+
+    constexpr auto TOLERANCE = 0.0001f;
+
+    class TestVertex
+    {
+    public:
+        float position[3];
+        float normal[3];
+        float uv[2];
+    };
+
+    class TestMesh
+    {
+    public:
+        std::vector<TestVertex> m_vertices;
+        std::vector<uint16_t> m_indices;
+
+        _NODISCARD size_t TriCount() const
+        {
+            return m_indices.size() / 3u;
+        }
+    };
+
+    // The serial implementation the tangent space calculation was originally written as
+    namespace reference
+    {
+        float Normalize(vec3& vector)
+        {
+            float length = std::sqrt(vector[0] * vector[0] + vector[1] * vector[1] + vector[2] * vector[2]);
+            if (-length >= 0.0f)
+                length = 1.0f;
+            const auto lengthInv = 1.0f / length;
+            for (auto& component : vector)
+                component = lengthInv * component;
+            return length;
+        }
+
+        vec3 Cross(const vec3& v0, const vec3& v1)
+        {
+            return {v0[1] * v1[2] - v0[2] * v1[1], v0[2] * v1[0] - v0[0] * v1[2], v0[0] * v1[1] - v1[0] * v0[1]};
+        }
+
+        float Dot(const vec3& a, const vec3& b)
+        {
+            return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+        }
+
+        vec3 Sub(const float (&a)[3], const float (&b)[3])
+        {
+            return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+        }
+
+        float Angle(const vec3& a, const vec3& b)
+        {
+            const auto cosine = Dot(a, b);
+            if (cosine <= -1.0f)
+                return -std::numbers::pi_v<float>;
+            if (cosine >= 1.0f)
+                return std::numbers::pi_v<float>;
+
+            return static_cast<float>(std::acos(static_cast<double>(cosine)));
+        }
+
+        vec3 Perpendicular(const vec3& src)
+        {
+            const float squares[3]{src[0] * src[0], src[1] * src[1], src[2] * src[2]};
+            auto axis = squares[0] > squares[1] ? 1 : 0;
+            if (squares[axis] > squares[2])
+                axis = 2;
+
+            const auto scale = -src[axis];
+            vec3 result{src[0] * scale, src[1] * scale, src[2] * scale};
+            result[axis] += 1.0f;
+            Normalize(result);
+            return result;
+        }
+
+        void CalculateTangentSpace(const TestMesh& mesh, std::vector<vec3>& tangents, std::vector<vec3>& binormals)
+        {
+            tangents.assign(mesh.m_vertices.size(), vec3{});
+            binormals.assign(mesh.m_vertices.size(), vec3{});
+
+            for (auto triIndex = 0uz; triIndex < mesh.TriCount(); triIndex++)
+            {
+                const uint16_t indices[3]{mesh.m_indices[triIndex * 3u], mesh.m_indices[triIndex * 3u + 1u], mesh.m_indices[triIndex * 3u + 2u]};
+                const auto& v0 = mesh.m_vertices[indices[0]];
+                const auto& v1 = mesh.m_vertices[indices[1]];
+                const auto& v2 = mesh.m_vertices[indices[2]];
+
+                const auto uv0_1m0 = v1.uv[0] - v0.uv[0];
+                const auto uv0_2m0 = v2.uv[0] - v0.uv[0];
+                const auto uv1_1m0 = v1.uv[1] - v0.uv[1];
+                const auto uv1_2m0 = v2.uv[1] - v0.uv[1];
+                const auto p_1m0 = Sub(v1.position, v0.position);
+                const auto p_2m0 = Sub(v2.position, v0.position);
+                const auto sign = uv1_2m0 * uv0_1m0 >= uv1_1m0 * uv0_2m0 ? 1.0f : -1.0f;
+
+                vec3 vector, cross;
+                for (auto i = 0u; i < 3u; i++)
+                {
+                    vector[i] = sign * (p_1m0[i] * uv1_2m0 - p_2m0[i] * uv1_1m0);
+                    cross[i] = sign * (p_2m0[i] * uv0_1m0 - p_1m0[i] * uv0_2m0);
+                }
+                Normalize(vector);
+                Normalize(cross);
+
+                auto L10 = Sub(v0.position, v1.position);
+                auto L21 = Sub(v1.position, v2.position);
+                auto L02 = Sub(v2.position, v0.position);
+                Normalize(L10);
+                Normalize(L21);
+                Normalize(L02);
+                const float exteriorAngles[3]{Angle(L10, L02), Angle(L21, L10), Angle(L02, L21)};
+
+                for (auto corner = 0u; corner < 3u; corner++)
+                {
+                    for (auto i = 0u; i < 3u; i++)
+                    {
+                        tangents[indices[corner]][i] += vector[i] * exteriorAngles[corner];
+                        binormals[indices[corner]][i] += cross[i] * exteriorAngles[corner];
+                    }
+                }
+            }
+
+            for (auto vertexIndex = 0uz; vertexIndex < mesh.m_vertices.size(); vertexIndex++)
+            {
+                const auto& vertexNormal = mesh.m_vertices[vertexIndex].normal;
+                const vec3 normal{vertexNormal[0], vertexNormal[1], vertexNormal[2]};
+                auto& tangent = tangents[vertexIndex];
+                auto& binormal = binormals[vertexIndex];
+
+                const auto dotNormalTangent = Dot(normal, tangent);
+                for (auto i = 0u; i < 3u; i++)
+                    tangent[i] = normal[i] * -dotNormalTangent + tangent[i];
+
+                if (Normalize(tangent) < 0.001f)
+                {
+                    tangent = Cross(binormal, normal);
+                    if (Normalize(tangent) < 0.001f)
+                        tangent = Perpendicular(normal);
+                }
+
+                const auto cross = Cross(normal, tangent);
+                const auto sign = Dot(binormal, cross) >= 0.0f ? 1.0f : -1.0f;
+                for (auto i = 0u; i < 3u; i++)
+                    binormal[i] = sign * cross[i];
+            }
+        }
+    } // namespace reference
+
+    /**
+     * \brief Creates a bumpy grid of quads with randomized uvs, including some degenerate triangles.
+     */
+    TestMesh CreateGridMesh(const unsigned width, const unsigned height)
+    {
+        std::mt19937 random(1337u);
+        std::uniform_real_distribution<float> offsetDistribution(-0.25f, 0.25f);
+
+        TestMesh mesh;
+        for (auto y = 0u; y <= height; y++)
+        {
+            for (auto x = 0u; x <= width; x++)
+            {
+                const auto z = std::sin(static_cast<float>(x) * 0.3f) * std::cos(static_cast<float>(y) * 0.2f);
+                vec3 normal{-0.3f * std::cos(static_cast<float>(x) * 0.3f), 0.2f * std::sin(static_cast<float>(y) * 0.2f), 1.0f};
+                reference::Normalize(normal);
+
+                mesh.m_vertices.emplace_back(TestVertex{
+                    {static_cast<float>(x) + offsetDistribution(random), static_cast<float>(y) + offsetDistribution(random), z},
+                    {normal[0],                                          normal[1],                                          normal[2]},
+                    {static_cast<float>(x) / static_cast<float>(width) + offsetDistribution(random) * 0.01f,
+                     static_cast<float>(y) / static_cast<float>(height)},
+                });
+            }
+        }
+
+        const auto rowLength = width + 1u;
+        for (auto y = 0u; y < height; y++)
+        {
+            for (auto x = 0u; x < width; x++)
+            {
+                const auto i0 = static_cast<uint16_t>(y * rowLength + x);
+                const auto i1 = static_cast<uint16_t>(i0 + 1u);
+                const auto i2 = static_cast<uint16_t>(i0 + rowLength);
+                const auto i3 = static_cast<uint16_t>(i2 + 1u);
+
+                mesh.m_indices.insert(mesh.m_indices.end(), {i0, i1, i2});
+                mesh.m_indices.insert(mesh.m_indices.end(), {i1, i3, i2});
+            }
+        }
+
+        // Degenerate triangles without area or with a duplicate vertex
+        mesh.m_indices.insert(mesh.m_indices.end(), {0u, 1u, 2u});
+        mesh.m_indices.insert(mesh.m_indices.end(), {3u, 3u, 4u});
+
+        return mesh;
+    }
+
+    void RequireMatchesReference(const TestMesh& mesh)
+    {
+        std::vector<vec3> tangents(mesh.m_vertices.size());
+        std::vector<vec3> binormals(mesh.m_vertices.size());
+        const auto& firstVertex = mesh.m_vertices[0];
+
+        const tangent_space::VertexData vertexData{
+            firstVertex.position,
+            sizeof(TestVertex),
+            firstVertex.normal,
+            sizeof(TestVertex),
+            firstVertex.uv,
+            sizeof(TestVertex),
+            tangents.data(),
+            sizeof(vec3),
+            binormals.data(),
+            sizeof(vec3),
+            mesh.m_indices.data(),
+        };
+        tangent_space::CalculateTangentSpace(vertexData, mesh.TriCount(), mesh.m_vertices.size());
+
+        std::vector<vec3> expectedTangents;
+        std::vector<vec3> expectedBinormals;
+        reference::CalculateTangentSpace(mesh, expectedTangents, expectedBinormals);
+
+        for (auto vertexIndex = 0uz; vertexIndex < mesh.m_vertices.size(); vertexIndex++)
+        {
+            for (auto i = 0u; i < 3u; i++)
+            {
+                REQUIRE(std::abs(tangents[vertexIndex][i] - expectedTangents[vertexIndex][i]) <= TOLERANCE);
+                REQUIRE(std::abs(binormals[vertexIndex][i] - expectedBinormals[vertexIndex][i]) <= TOLERANCE);
+            }
+        }
+    }
+
+    TEST_CASE("Tangentspace: Calculates tangent space of single triangle", "[xmodel][tangentspace]")
+    {
+        TestMesh mesh;
+        mesh.m_vertices = {
+            TestVertex{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f}},
+            TestVertex{{1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f}},
+            TestVertex{{0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f}},
+        };
+        mesh.m_indices = {0u, 1u, 2u};
+
+        RequireMatchesReference(mesh);
+    }
+
+    TEST_CASE("Tangentspace: Calculates tangent space of small mesh", "[xmodel][tangentspace]")
+    {
+        RequireMatchesReference(CreateGridMesh(5u, 3u));
+    }
+
+    TEST_CASE("Tangentspace: Calculates tangent space of mesh split into multiple tasks", "[xmodel][tangentspace]")
+    {
+        RequireMatchesReference(CreateGridMesh(101u, 97u));
+    }
+} // namespace
@@ -0,0 +1,131 @@
+#include "Dumping/BufferedTextWriter.h"
+
+#include <bit>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<float> CreateTestFloats()
+    {
+        std::vector<float> values{
+            0.0f,
+            -0.0f,
+            0.1f,
+            -1.5f,
+            1.0f / 3.0f,
+            123456.789f,
+            1e-7f,
+            1e20f,
+            std::numeric_limits<float>::min(),
+            std::numeric_limits<float>::denorm_min(),
+            std::numeric_limits<float>::max(),
+            std::numeric_limits<float>::lowest(),
+            std::numeric_limits<float>::epsilon(),
+        };
+
+        // Random bit patterns cover all exponents, skipping infinities and NaNs
+        std::mt19937 random(1337u);
+        while (values.size() < 10000u)
+        {
+            const auto value = std::bit_cast<float>(static_cast<uint32_t>(random()));
+            if (std::isfinite(value))
+                values.emplace_back(value);
+        }
+
+        return values;
+    }
+
+    TEST_CASE("BufferedTextWriter: Written floats parse back to identical values", "[dumping][text]")
+    {
+        const auto values = CreateTestFloats();
+
+        std::ostringstream ss;
+        {
+            BufferedTextWriter writer(ss);
+            for (const auto value : values)
+                writer << value << '\n';
+        }
+
+        std::istringstream input(ss.str());
+        std::string line;
+        for (const auto value : values)
+        {
+            REQUIRE(std::getline(input, line));
+
+            char* endPtr;
+            const auto parsedValue = std::strtof(line.c_str(), &endPtr);
+            REQUIRE(endPtr == line.c_str() + line.size());
+            REQUIRE(std::bit_cast<uint32_t>(parsedValue) == std::bit_cast<uint32_t>(value));
+        }
+    }
+
+    TEST_CASE("BufferedTextWriter: Formatted floats parse back to identical values", "[dumping][text]")
+    {
+        for (const auto value : CreateTestFloats())
+        {
+            const auto formattedValue = BufferedTextWriter::FormatFloat(value);
+            const auto parsedValue = std::strtof(formattedValue.c_str(), nullptr);
+            REQUIRE(std::bit_cast<uint32_t>(parsedValue) == std::bit_cast<uint32_t>(value));
+        }
+    }
+
+    TEST_CASE("BufferedTextWriter: Writes fixed precision floats like std::format", "[dumping][text]")
+    {
+        const std::vector values{0.0f, -0.0f, 0.1f, -1.5f, 0.0000004f, 123456.789f, 1e20f, std::numeric_limits<float>::max()};
+
+        std::ostringstream ss;
+        std::string expected;
+        {
+            BufferedTextWriter writer(ss);
+            for (const auto value : values)
+            {
+                writer << FixedFloat(value) << ' ' << FixedFloat(value, 2) << '\n';
+                expected += std::format("{:.6f} {:.2f}\n", value, value);
+            }
+        }
+
+        REQUIRE(ss.str() == expected);
+    }
+
+    TEST_CASE("BufferedTextWriter: Writes integers, characters and strings", "[dumping][text]")
+    {
+        std::ostringstream ss;
+        {
+            BufferedTextWriter writer(ss);
+            writer << std::numeric_limits<int>::min() << ' ' << std::numeric_limits<uint64_t>::max() << ' ' << 0u << ' ' << 'c' << ' ' << "text" << ' '
+                   << std::string("string");
+        }
+
+        REQUIRE(ss.str() == "-2147483648 18446744073709551615 0 c text string");
+    }
+
+    TEST_CASE("BufferedTextWriter: Keeps order of text that exceeds the buffer size", "[dumping][text]")
+    {
+        const std::string longText(BufferedTextWriter::BUFFER_SIZE + 10u, 'x');
+
+        std::ostringstream ss;
+        std::string expected;
+        {
+            BufferedTextWriter writer(ss);
+            for (auto i = 0u; i < 20000u; i++)
+            {
+                writer << i << ' ' << 0.25f << ' ';
+                expected += std::format("{} {} ", i, 0.25f);
+            }
+
+            writer << longText << 'y';
+            expected += longText + 'y';
+        }
+
+        REQUIRE(ss.str() == expected);
+    }
+} // namespace
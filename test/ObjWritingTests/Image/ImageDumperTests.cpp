@@ -0,0 +1,135 @@
+#include "Game/IGame.h"
+#include "Image/ImageDumper.h"
+#include "Image/IwiWriter27.h"
+#include "SearchPath/MockOutputPath.h"
+#include "SearchPath/MockSearchPath.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    std::string CreateIwi()
+    {
+        const std::unique_ptr<Texture> texture = std::make_unique<Texture2D>(&ImageFormat::FORMAT_BC1, 64u, 32u, true);
+        texture->Allocate();
+
+        const auto mipCount = texture->GetMipMapCount();
+        for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
+        {
+            auto* buffer = texture->GetBufferForMipLevel(mipLevel);
+            const auto mipLevelSize = texture->GetSizeOfMipLevel(mipLevel);
+            for (auto i = 0uz; i < mipLevelSize; i++)
+                buffer[i] = static_cast<uint8_t>(i * 31u + static_cast<size_t>(mipLevel) * 7u);
+        }
+
+        std::ostringstream ss;
+        iwi27::IwiWriter writer;
+        writer.DumpImage(ss, texture.get());
+
+        return ss.str();
+    }
+
+    // Streams of some sources like IPaks cannot seek, so their size is not known before reading them
+    class NonSeekableStreamBuffer final : public std::streambuf
+    {
+    public:
+        explicit NonSeekableStreamBuffer(std::string data)
+            : m_data(std::move(data))
+        {
+            setg(m_data.data(), m_data.data(), m_data.data() + m_data.size());
+        }
+
+    private:
+        std::string m_data;
+    };
+
+    class DumpIwiTestContext
+    {
+    public:
+        DumpIwiTestContext()
+            : m_zone("MockZone", 0, IGame::GetGameById(GameId::T6)),
+              m_base_path("dump"),
+              m_context(m_zone, m_base_path, m_output_path, m_search_path),
+              m_dumper(std::make_unique<iwi27::IwiWriter>())
+        {
+        }
+
+        Zone m_zone;
+        std::string m_base_path;
+        MockOutputPath m_output_path;
+        MockSearchPath m_search_path;
+        AssetDumpingContext m_context;
+        ImageDumper m_dumper;
+    };
+} // namespace
+
+namespace image::image_dumper
+{
+    TEST_CASE("ImageDumper: Reads complete iwis into memory", "[image]")
+    {
+        const auto iwiData = CreateIwi();
+        std::istringstream iwiStream(iwiData);
+
+        const auto completeIwi = ImageDumper::ReadCompleteIwi(iwiStream);
+        REQUIRE(completeIwi);
+        REQUIRE(std::string(std::istreambuf_iterator(*completeIwi), {}) == iwiData);
+    }
+
+    TEST_CASE("ImageDumper: Does not accept iwis with missing mip level data", "[image]")
+    {
+        const auto iwiData = CreateIwi();
+        const auto missingSize = GENERATE(1uz, 8uz, 64uz);
+        std::istringstream iwiStream(iwiData.substr(0u, iwiData.size() - missingSize));
+
+        REQUIRE(!ImageDumper::ReadCompleteIwi(iwiStream));
+    }
+
+    TEST_CASE("ImageDumper: Does not accept invalid iwis", "[image]")
+    {
+        std::istringstream emptyStream;
+        REQUIRE(!ImageDumper::ReadCompleteIwi(emptyStream));
+
+        std::istringstream invalidStream(std::string(256u, 'x'));
+        REQUIRE(!ImageDumper::ReadCompleteIwi(invalidStream));
+    }
+
+    TEST_CASE("ImageDumper: Dumps complete iwis", "[image]")
+    {
+        DumpIwiTestContext testContext;
+        const auto iwiData = CreateIwi();
+        const auto seekable = GENERATE(true, false);
+
+        NonSeekableStreamBuffer nonSeekableBuffer(iwiData);
+        std::istream nonSeekableStream(&nonSeekableBuffer);
+        std::istringstream seekableStream(iwiData);
+        std::istream& iwiStream = seekable ? static_cast<std::istream&>(seekableStream) : nonSeekableStream;
+
+        REQUIRE(testContext.m_dumper.DumpIwi(testContext.m_context, "images/test.iwi", iwiStream));
+
+        const auto* dumpedFile = testContext.m_output_path.GetMockedFile("images/test.iwi");
+        REQUIRE(dumpedFile);
+        REQUIRE(dumpedFile->AsString() == iwiData);
+    }
+
+    TEST_CASE("ImageDumper: Does not write a file for iwis with missing mip level data", "[image]")
+    {
+        DumpIwiTestContext testContext;
+        const auto iwiData = CreateIwi();
+        const auto missingSize = GENERATE(1uz, 8uz, 64uz);
+        const auto seekable = GENERATE(true, false);
+
+        const auto incompleteIwiData = iwiData.substr(0u, iwiData.size() - missingSize);
+        NonSeekableStreamBuffer nonSeekableBuffer(incompleteIwiData);
+        std::istream nonSeekableStream(&nonSeekableBuffer);
+        std::istringstream seekableStream(incompleteIwiData);
+        std::istream& iwiStream = seekable ? static_cast<std::istream&>(seekableStream) : nonSeekableStream;
+
+        REQUIRE(!testContext.m_dumper.DumpIwi(testContext.m_context, "images/test.iwi", iwiStream));
+        REQUIRE(testContext.m_output_path.GetMockedFileList().empty());
+    }
+} // namespace image::image_dumper
@@ -0,0 +1,110 @@
+#include "RawFile/RawFileDecompressor.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+namespace
+{
+    std::string CreateTestData(const size_t size)
+    {
+        std::string data;
+        data.reserve(size);
+        for (auto i = 0uz; i < size; i++)
+            data += static_cast<char>('a' + (i * 7u + i / 13u) % 26u);
+
+        return data;
+    }
+
+    std::vector<char> Compress(const std::string& data, const int windowBits)
+    {
+        z_stream zs{};
+        REQUIRE(deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+
+        std::vector<char> compressedData(deflateBound(&zs, static_cast<uLong>(data.size())));
+        zs.next_in = reinterpret_cast<const Bytef*>(data.data());
+        zs.avail_in = static_cast<uInt>(data.size());
+        zs.next_out = reinterpret_cast<Bytef*>(compressedData.data());
+        zs.avail_out = static_cast<uInt>(compressedData.size());
+
+        REQUIRE(deflate(&zs, Z_FINISH) == Z_STREAM_END);
+        compressedData.resize(zs.total_out);
+        deflateEnd(&zs);
+
+        return compressedData;
+    }
+} // namespace
+
+namespace raw_file::decompressor
+{
+    TEST_CASE("RawFileDecompressor: Inflates data of the expected size", "[rawfile]")
+    {
+        const auto windowBits = GENERATE(MAX_WBITS, -MAX_WBITS);
+        const auto size = GENERATE(0uz, 1uz, 0x1000uz, 100000uz);
+
+        const auto data = CreateTestData(size);
+        const auto compressedData = Compress(data, windowBits);
+
+        RawFileDecompressor decompressor;
+        const auto result = decompressor.Decompress(compressedData, data.size(), windowBits);
+
+        REQUIRE(result);
+        REQUIRE(std::string(result->data(), result->size()) == data);
+    }
+
+    TEST_CASE("RawFileDecompressor: Inflates data that is larger than expected", "[rawfile]")
+    {
+        const auto data = CreateTestData(50000uz);
+        const auto compressedData = Compress(data, MAX_WBITS);
+
+        RawFileDecompressor decompressor;
+        const auto result = decompressor.Decompress(compressedData, 10uz, MAX_WBITS);
+
+        REQUIRE(result);
+        REQUIRE(std::string(result->data(), result->size()) == data);
+    }
+
+    TEST_CASE("RawFileDecompressor: Reuses state for multiple rawfiles", "[rawfile]")
+    {
+        RawFileDecompressor decompressor;
+
+        for (auto i = 0uz; i < 5uz; i++)
+        {
+            const auto windowBits = i % 2u == 0u ? MAX_WBITS : -MAX_WBITS;
+            const auto data = CreateTestData(1000uz + i * 3000uz);
+            const auto compressedData = Compress(data, windowBits);
+
+            const auto result = decompressor.Decompress(compressedData, data.size(), windowBits);
+
+            REQUIRE(result);
+            REQUIRE(std::string(result->data(), result->size()) == data);
+        }
+    }
+
+    TEST_CASE("RawFileDecompressor: Returns inflated data of truncated streams", "[rawfile]")
+    {
+        const auto data = CreateTestData(20000uz);
+        auto compressedData = Compress(data, MAX_WBITS);
+        compressedData.resize(compressedData.size() / 2u);
+
+        RawFileDecompressor decompressor;
+        const auto result = decompressor.Decompress(compressedData, data.size(), MAX_WBITS);
+
+        REQUIRE(result);
+        REQUIRE(result->size() < data.size());
+        REQUIRE(std::string(result->data(), result->size()) == data.substr(0, result->size()));
+    }
+
+    TEST_CASE("RawFileDecompressor: Reports corrupt data", "[rawfile]")
+    {
+        const std::vector<char> corruptData{'\x78', '\x9c', '\xff', '\xff', '\xff', '\xff'};
+
+        RawFileDecompressor decompressor;
+        const auto result = decompressor.Decompress(corruptData, 100uz, MAX_WBITS);
+
+        REQUIRE(!result);
+    }
+} // namespace raw_file::decompressor
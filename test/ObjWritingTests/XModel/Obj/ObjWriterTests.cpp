@@ -0,0 +1,88 @@
+#include "XModel/Obj/ObjWriter.h"
+
+#include <bit>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    XModelVertex CreateVertex(const float x, const float y, const float z, const float u, const float v)
+    {
+        XModelVertex vertex{};
+        vertex.coordinates[0] = x;
+        vertex.coordinates[1] = y;
+        vertex.coordinates[2] = z;
+        vertex.normal[0] = x / 3.0f;
+        vertex.normal[1] = y / 7.0f;
+        vertex.normal[2] = 1.0f;
+        vertex.uv[0] = u;
+        vertex.uv[1] = v;
+
+        return vertex;
+    }
+
+    std::vector<float> ParseValues(const std::string& objData, const std::string& lineType)
+    {
+        std::vector<float> values;
+        std::istringstream input(objData);
+        std::string line;
+        while (std::getline(input, line))
+        {
+            std::istringstream lineInput(line);
+            std::string readLineType;
+            lineInput >> readLineType;
+            if (readLineType != lineType)
+                continue;
+
+            std::string value;
+            while (lineInput >> value)
+                values.emplace_back(std::strtof(value.c_str(), nullptr));
+        }
+
+        return values;
+    }
+
+    void RequireIdenticalValues(const std::vector<float>& actual, const std::vector<float>& expected)
+    {
+        REQUIRE(actual.size() == expected.size());
+        for (auto i = 0uz; i < actual.size(); i++)
+            REQUIRE(std::bit_cast<uint32_t>(actual[i]) == std::bit_cast<uint32_t>(expected[i]));
+    }
+
+    TEST_CASE("ObjWriter: Written vertex data parses back to identical values", "[xmodel][obj]")
+    {
+        XModelCommon xmodel;
+        xmodel.m_vertices = {
+            CreateVertex(1.0f / 3.0f, -123.456f, 0.1f, 0.25f, 0.75f),
+            CreateVertex(1e-7f, 98765.4321f, -0.0f, 1.0f / 7.0f, 0.3f),
+            CreateVertex(std::numeric_limits<float>::min(), 16777217.0f, 2.5e-3f, 0.999999f, 0.000001f),
+        };
+        xmodel.m_objects.emplace_back(XModelObject{"object", 0, {XModelFace{{0u, 1u, 2u}}}});
+
+        std::ostringstream ss;
+        obj::CreateObjWriter(ss, "", "game", "zone")->Write(xmodel);
+        const auto objData = ss.str();
+
+        // Obj writes faces in reversed order and converts to a y up coordinate system
+        std::vector<float> expectedPositions;
+        std::vector<float> expectedNormals;
+        std::vector<float> expectedUvs;
+        for (auto i = 3uz; i > 0uz; i--)
+        {
+            const auto& vertex = xmodel.m_vertices[i - 1u];
+            expectedPositions.insert(expectedPositions.end(), {vertex.coordinates[0], vertex.coordinates[2], -vertex.coordinates[1]});
+            expectedNormals.insert(expectedNormals.end(), {vertex.normal[0], vertex.normal[2], -vertex.normal[1]});
+            expectedUvs.insert(expectedUvs.end(), {vertex.uv[0], 1.0f - vertex.uv[1]});
+        }
+
+        RequireIdenticalValues(ParseValues(objData, "v"), expectedPositions);
+        RequireIdenticalValues(ParseValues(objData, "vn"), expectedNormals);
+        RequireIdenticalValues(ParseValues(objData, "vt"), expectedUvs);
+        REQUIRE(objData.find("f 1/1/1 2/2/2 3/3/3\n") != std::string::npos);
+    }
+} // namespace
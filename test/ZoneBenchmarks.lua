@@ -0,0 +1,69 @@
+ZoneBenchmarks = {}
+
+function ZoneBenchmarks:include(includes)
+	if includes:handle(self:name()) then
+		includedirs {
+			path.join(TestFolder(), "ZoneBenchmarks")
+		}
+	end
+end
+
+function ZoneBenchmarks:link(links)
+	
+end
+
+function ZoneBenchmarks:use()
+	
+end
+
+function ZoneBenchmarks:name()
+    return "ZoneBenchmarks"
+end
+
+function ZoneBenchmarks:project()
+	local folder = TestFolder()
+	local includes = Includes:create()
+	local links = Links:create()
+
+	project(self:name())
+        targetdir(TargetDirectoryTest)
+		location "%{wks.location}/test/%{prj.name}"
+		kind "ConsoleApp"
+		language "C++"
+		
+		-- Zones are created the same way the Linker does it
+		files {
+			path.join(folder, "ZoneBenchmarks/**.h"), 
+			path.join(folder, "ZoneBenchmarks/**.cpp"),
+			path.join(ProjectFolder(), "Linker/ZoneCreation/**.h"),
+			path.join(ProjectFolder(), "Linker/ZoneCreation/**.cpp")
+		}
+		
+        vpaths {
+			["*"] = {
+				path.join(folder, "ZoneBenchmarks"),
+				path.join(ProjectFolder(), "Linker")
+			}
+		}
+		
+		includedirs {
+			path.join(ProjectFolder(), "Linker")
+		}
+
+		self:include(includes)
+		Utils:include(includes)
+		ZoneLoading:include(includes)
+		ZoneWriting:include(includes)
+		ObjCompiling:include(includes)
+		ObjLoading:include(includes)
+		ObjWriting:include(includes)
+		json:include(includes)
+
+		links:linkto(Utils)
+		links:linkto(ObjCompiling)
+		links:linkto(ZoneLoading)
+		links:linkto(ZoneWriting)
+		links:linkto(ObjLoading)
+		links:linkto(ObjWriting)
+		links:linkall()
+end
@@ -0,0 +1,179 @@
+#include "SyntheticZone.h"
+
+#include "Zone/Zone.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <format>
+#include <optional>
+#include <random>
+#include <sstream>
+
+namespace
+{
+    constexpr auto RAW_FILE_MIN_SIZE = 512uz;
+    constexpr auto RAW_FILE_MAX_SIZE = 16uz * 1024uz;
+    constexpr auto LARGE_RAW_FILE_SIZE = 1024uz * 1024uz;
+    constexpr auto STRING_TABLE_ROW_COUNT = 64uz;
+    constexpr auto STRING_TABLE_COLUMN_COUNT = 8uz;
+
+    // A fixed seed keeps the generated data, and therefore its compression ratio, identical for every run
+    constexpr auto RANDOM_SEED = 0x4F415442u;
+
+    constexpr std::array WORDS{
+        "level",  "self",     "player", "weapon", "thread", "wait",  "notify", "endon",   "waittill", "origin",
+        "angles", "health",   "team",   "spawn",  "delete", "model", "sound",  "trigger", "vehicle",  "objective",
+        "damage", "function", "array",  "struct", "if",     "else",  "for",    "while",   "return",   "undefined",
+    };
+
+    std::optional<asset_type_t> GetAssetTypeByName(const GameId game, const std::string& assetTypeName)
+    {
+        const Zone zone("", 0, IGame::GetGameById(game));
+        const auto assetTypeCount = zone.m_pools->GetAssetTypeCount();
+
+        for (asset_type_t assetType = 0; assetType < assetTypeCount; assetType++)
+        {
+            const auto name = zone.m_pools->GetAssetTypeName(assetType);
+            if (name && assetTypeName == *name)
+                return assetType;
+        }
+
+        return std::nullopt;
+    }
+
+    class DataGenerator
+    {
+    public:
+        DataGenerator()
+            : m_random(RANDOM_SEED)
+        {
+        }
+
+        size_t NextSize(const size_t min, const size_t max)
+        {
+            return std::uniform_int_distribution(min, max)(m_random);
+        }
+
+        const char* NextWord()
+        {
+            return WORDS[std::uniform_int_distribution(0uz, WORDS.size() - 1uz)(m_random)];
+        }
+
+        std::string GenerateScript(const size_t size)
+        {
+            std::ostringstream ss;
+            auto lineIndex = 0u;
+            while (static_cast<size_t>(ss.tellp()) < size)
+            {
+                ss << std::format("\t{}.{}_{} = {}(\"{}\", {});\n", NextWord(), NextWord(), lineIndex++, NextWord(), NextWord(), m_random() % 10000u);
+            }
+
+            auto result = std::move(ss).str();
+            result.resize(size);
+            return result;
+        }
+
+        std::string GenerateStringTable(const size_t rowCount, const size_t columnCount)
+        {
+            std::ostringstream ss;
+            for (auto row = 0uz; row < rowCount; row++)
+            {
+                for (auto column = 0uz; column < columnCount; column++)
+                {
+                    if (column > 0)
+                        ss << ',';
+
+                    if (column % 2 == 0)
+                        ss << m_random() % 100000u;
+                    else
+                        ss << NextWord() << '_' << NextWord();
+                }
+                ss << '\n';
+            }
+
+            return std::move(ss).str();
+        }
+
+    private:
+        std::mt19937 m_random;
+    };
+} // namespace
+
+void SyntheticSearchPath::AddFile(std::string fileName, std::string data)
+{
+    m_total_file_size += data.size();
+    m_files.emplace(std::move(fileName), std::move(data));
+}
+
+SearchPathOpenFile SyntheticSearchPath::Open(const std::string& fileName)
+{
+    const auto foundFile = m_files.find(fileName);
+    if (foundFile == m_files.end())
+        return {};
+
+    return {std::make_unique<std::istringstream>(foundFile->second), static_cast<int64_t>(foundFile->second.size())};
+}
+
+const std::string& SyntheticSearchPath::GetPath()
+{
+    static const std::string NAME = "SyntheticFiles";
+    return NAME;
+}
+
+void SyntheticSearchPath::Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) {}
+
+size_t SyntheticSearchPath::GetTotalFileSize() const
+{
+    return m_total_file_size;
+}
+
+SyntheticZoneOptions SyntheticZoneOptions::ForScale(const size_t scale)
+{
+    return SyntheticZoneOptions{
+        .m_raw_file_count = 2000uz * scale,
+        .m_large_raw_file_count = 4uz * scale,
+        .m_string_table_count = 250uz * scale,
+    };
+}
+
+std::unique_ptr<SyntheticZone> SyntheticZone::Generate(const GameId game, const std::string& zoneName, const SyntheticZoneOptions& options)
+{
+    const auto rawFileType = GetAssetTypeByName(game, "rawfile");
+    const auto stringTableType = GetAssetTypeByName(game, "stringtable");
+    assert(rawFileType && stringTableType);
+    if (!rawFileType || !stringTableType)
+        return nullptr;
+
+    auto zone = std::make_unique<SyntheticZone>();
+    zone->m_definition = std::make_unique<ZoneDefinition>();
+    zone->m_definition->m_name = zoneName;
+    zone->m_definition->m_game = game;
+
+    auto& assets = zone->m_definition->m_assets;
+    assets.reserve(options.m_raw_file_count + options.m_large_raw_file_count + options.m_string_table_count);
+
+    DataGenerator generator;
+    for (auto i = 0uz; i < options.m_raw_file_count; i++)
+    {
+        auto fileName = std::format("benchmark/script_{}.gsc", i);
+        zone->m_search_path.AddFile(fileName, generator.GenerateScript(generator.NextSize(RAW_FILE_MIN_SIZE, RAW_FILE_MAX_SIZE)));
+        assets.emplace_back(*rawFileType, std::move(fileName), false);
+    }
+
+    for (auto i = 0uz; i < options.m_large_raw_file_count; i++)
+    {
+        auto fileName = std::format("benchmark/large_script_{}.gsc", i);
+        zone->m_search_path.AddFile(fileName, generator.GenerateScript(LARGE_RAW_FILE_SIZE));
+        assets.emplace_back(*rawFileType, std::move(fileName), false);
+    }
+
+    for (auto i = 0uz; i < options.m_string_table_count; i++)
+    {
+        auto fileName = std::format("benchmark/table_{}.csv", i);
+        zone->m_search_path.AddFile(fileName, generator.GenerateStringTable(STRING_TABLE_ROW_COUNT, STRING_TABLE_COLUMN_COUNT));
+        assets.emplace_back(*stringTableType, std::move(fileName), false);
+    }
+
+    return zone;
+}
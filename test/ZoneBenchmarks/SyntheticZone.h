@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Game/IGame.h"
+#include "SearchPath/ISearchPath.h"
+#include "Zone/Definition/ZoneDefinition.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/**
+ * \brief A search path that serves files from memory.
+ */
+class SyntheticSearchPath final : public ISearchPath
+{
+public:
+    void AddFile(std::string fileName, std::string data);
+
+    SearchPathOpenFile Open(const std::string& fileName) override;
+    const std::string& GetPath() override;
+    void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+
+    _NODISCARD size_t GetTotalFileSize() const;
+
+private:
+    std::unordered_map<std::string, std::string> m_files;
+    size_t m_total_file_size = 0u;
+};
+
+class SyntheticZoneOptions
+{
+public:
+    size_t m_raw_file_count;
+    size_t m_large_raw_file_count;
+    size_t m_string_table_count;
+
+    /**
+     * \brief Creates the default options multiplied by a scale factor.
+     */
+    static SyntheticZoneOptions ForScale(size_t scale);
+};
+
+/**
+ * \brief A zone definition with generated source files for all of its assets.
+ * All generated data is deterministic so results can be compared across commits.
+ */
+class SyntheticZone
+{
+public:
+    std::unique_ptr<ZoneDefinition> m_definition;
+    SyntheticSearchPath m_search_path;
+
+    static std::unique_ptr<SyntheticZone> Generate(GameId game, const std::string& zoneName, const SyntheticZoneOptions& options);
+};
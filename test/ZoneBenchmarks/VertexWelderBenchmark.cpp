@@ -0,0 +1,147 @@
+#include "VertexWelderBenchmark.h"
+
+#include "XModel/VertexWelder.h"
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string_view>
+#include <unordered_map>
+
+namespace
+{
+    // Position, normal, uv and two bone weights, similar to the keys the XModel loader welds
+    using benchmark_key_t = std::array<uint32_t, 12>;
+
+    class BenchmarkKeyHash
+    {
+    public:
+        size_t operator()(const benchmark_key_t& key) const
+        {
+            return std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(key.data()), sizeof(key)));
+        }
+    };
+
+    /**
+     * \brief Creates the corners of a grid of quads with two triangles each, so every inner vertex is referenced by six corners.
+     */
+    std::vector<benchmark_key_t> CreateCorners(const size_t triangleCount)
+    {
+        const auto quadCount = (triangleCount + 1u) / 2u;
+        const auto width = static_cast<size_t>(std::sqrt(static_cast<double>(quadCount))) + 1u;
+
+        std::mt19937 random(1337u);
+        std::uniform_real_distribution<float> heightDistribution(-1.0f, 1.0f);
+        std::uniform_int_distribution<uint32_t> boneDistribution(0u, 63u);
+
+        const auto createVertex = [&](const size_t x, const size_t y)
+        {
+            const auto bone = boneDistribution(random);
+            return benchmark_key_t{
+                std::bit_cast<uint32_t>(static_cast<float>(x)),
+                std::bit_cast<uint32_t>(static_cast<float>(y)),
+                std::bit_cast<uint32_t>(heightDistribution(random)),
+                std::bit_cast<uint32_t>(0.0f),
+                std::bit_cast<uint32_t>(0.0f),
+                std::bit_cast<uint32_t>(1.0f),
+                std::bit_cast<uint32_t>(static_cast<float>(x) / static_cast<float>(width)),
+                std::bit_cast<uint32_t>(static_cast<float>(y) / static_cast<float>(width)),
+                bone,
+                std::bit_cast<uint32_t>(0.75f),
+                bone + 1u,
+                std::bit_cast<uint32_t>(0.25f),
+            };
+        };
+
+        const auto rowCount = quadCount / width + 2u;
+        std::vector<benchmark_key_t> vertices;
+        vertices.reserve((width + 1u) * rowCount);
+        for (auto y = 0uz; y < rowCount; y++)
+        {
+            for (auto x = 0uz; x <= width; x++)
+                vertices.emplace_back(createVertex(x, y));
+        }
+
+        std::vector<benchmark_key_t> corners;
+        corners.reserve(triangleCount * 3u);
+        for (auto triangleIndex = 0uz; triangleIndex < triangleCount; triangleIndex++)
+        {
+            const auto quadIndex = triangleIndex / 2u;
+            const auto i0 = quadIndex / width * (width + 1u) + quadIndex % width;
+            const auto i1 = i0 + 1u;
+            const auto i2 = i0 + width + 1u;
+            const auto i3 = i2 + 1u;
+
+            if (triangleIndex % 2u == 0u)
+                corners.insert(corners.end(), {vertices[i0], vertices[i1], vertices[i2]});
+            else
+                corners.insert(corners.end(), {vertices[i1], vertices[i3], vertices[i2]});
+        }
+
+        return corners;
+    }
+
+    double SecondsSince(const std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+} // namespace
+
+VertexWelderBenchmarkResult::VertexWelderBenchmarkResult()
+    : m_triangle_count(0u),
+      m_corner_count(0u),
+      m_welded_vertex_count(0u)
+{
+}
+
+VertexWelderBenchmark::VertexWelderBenchmark(const size_t triangleCount, const unsigned iterationCount)
+    : m_triangle_count(triangleCount),
+      m_iteration_count(iterationCount)
+{
+}
+
+VertexWelderBenchmarkResult VertexWelderBenchmark::Run() const
+{
+    const auto corners = CreateCorners(m_triangle_count);
+    const auto inputSize = corners.size() * sizeof(benchmark_key_t);
+
+    VertexWelderBenchmarkResult result;
+    result.m_triangle_count = m_triangle_count;
+    result.m_corner_count = corners.size();
+    result.m_phases.emplace_back("vertex_welder", inputSize);
+    result.m_phases.emplace_back("unordered_map", inputSize);
+
+    std::vector<uint32_t> indices(corners.size());
+
+    // Kept across iterations like the XModel loader keeps it across surfaces
+    VertexWelder<benchmark_key_t> welder;
+    for (auto iteration = 0u; iteration < m_iteration_count; iteration++)
+    {
+        const auto welderStart = std::chrono::steady_clock::now();
+        welder.Reset(corners.size());
+        auto nextVertexIndex = 0u;
+        for (auto cornerIndex = 0uz; cornerIndex < corners.size(); cornerIndex++)
+        {
+            indices[cornerIndex] = welder.FindOrAdd(corners[cornerIndex], nextVertexIndex);
+            if (indices[cornerIndex] == nextVertexIndex)
+                nextVertexIndex++;
+        }
+        result.m_phases[0].m_seconds.emplace_back(SecondsSince(welderStart));
+        result.m_welded_vertex_count = welder.GetVertexCount();
+
+        const auto mapStart = std::chrono::steady_clock::now();
+        std::unordered_map<benchmark_key_t, uint32_t, BenchmarkKeyHash> vertexMap;
+        vertexMap.reserve(corners.size());
+        for (auto cornerIndex = 0uz; cornerIndex < corners.size(); cornerIndex++)
+        {
+            const auto [existingVertex, _] = vertexMap.try_emplace(corners[cornerIndex], static_cast<uint32_t>(vertexMap.size()));
+            indices[cornerIndex] = existingVertex->second;
+        }
+        result.m_phases[1].m_seconds.emplace_back(SecondsSince(mapStart));
+    }
+
+    return result;
+}
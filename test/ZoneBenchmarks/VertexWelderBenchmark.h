@@ -0,0 +1,35 @@
+#pragma once
+
+#include "ZoneBenchmark.h"
+
+#include <cstddef>
+#include <vector>
+
+class VertexWelderBenchmarkResult
+{
+public:
+    size_t m_triangle_count;
+    size_t m_corner_count;
+    size_t m_welded_vertex_count;
+    std::vector<BenchmarkPhaseResult> m_phases;
+
+    VertexWelderBenchmarkResult();
+};
+
+/**
+ * \brief Measures welding the corners of a synthetic unindexed triangle mesh into unique vertices.
+ * The VertexWelder used by the XModel loader is compared against a \c std::unordered_map doing the same work.
+ */
+class VertexWelderBenchmark
+{
+public:
+    static constexpr auto DEFAULT_TRIANGLE_COUNT = 1'000'000uz;
+
+    VertexWelderBenchmark(size_t triangleCount, unsigned iterationCount);
+
+    VertexWelderBenchmarkResult Run() const;
+
+private:
+    size_t m_triangle_count;
+    unsigned m_iteration_count;
+};
@@ -0,0 +1,256 @@
+#include "ZoneBenchmark.h"
+
+#include "IObjWriter.h"
+#include "ZoneCreation/ZoneCreator.h"
+#include "ZoneLoading.h"
+#include "ZoneWriting.h"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr auto PHASE_CREATE = 0uz;
+    constexpr auto PHASE_WRITE = 1uz;
+    constexpr auto PHASE_LOAD = 2uz;
+    constexpr auto PHASE_DUMP = 3uz;
+
+    /**
+     * \brief Counts the bytes written to it without keeping them, so dumping is not limited by the speed of the disk.
+     */
+    class CountingStreamBuffer final : public std::streambuf
+    {
+    public:
+        explicit CountingStreamBuffer(size_t& byteCount)
+            : m_byte_count(byteCount)
+        {
+        }
+
+    protected:
+        int_type overflow(const int_type c) override
+        {
+            if (!traits_type::eq_int_type(c, traits_type::eof()))
+                m_byte_count++;
+
+            return traits_type::not_eof(c);
+        }
+
+        std::streamsize xsputn(const char* ptr, const std::streamsize count) override
+        {
+            m_byte_count += static_cast<size_t>(count);
+            return count;
+        }
+
+    private:
+        size_t& m_byte_count;
+    };
+
+    class CountingOutputStream final : public std::ostream
+    {
+    public:
+        explicit CountingOutputStream(size_t& byteCount)
+            : std::ostream(&m_buffer),
+              m_buffer(byteCount)
+        {
+        }
+
+    private:
+        CountingStreamBuffer m_buffer;
+    };
+
+    class CountingOutputPath final : public IOutputPath
+    {
+    public:
+        CountingOutputPath()
+            : m_byte_count(0u)
+        {
+        }
+
+        std::unique_ptr<std::ostream> Open(const std::string& fileName) override
+        {
+            return std::make_unique<CountingOutputStream>(m_byte_count);
+        }
+
+        _NODISCARD size_t GetByteCount() const
+        {
+            return m_byte_count;
+        }
+
+    private:
+        size_t m_byte_count;
+    };
+
+    double SecondsBetween(const std::chrono::steady_clock::time_point start, const std::chrono::steady_clock::time_point end)
+    {
+        return std::chrono::duration<double>(end - start).count();
+    }
+} // namespace
+
+BenchmarkPhaseResult::BenchmarkPhaseResult(std::string name, const size_t byteCount)
+    : m_name(std::move(name)),
+      m_byte_count(byteCount)
+{
+}
+
+double BenchmarkPhaseResult::GetMedianSeconds() const
+{
+    if (m_seconds.empty())
+        return 0.0;
+
+    auto sortedSeconds = m_seconds;
+    std::ranges::sort(sortedSeconds);
+
+    const auto middle = sortedSeconds.size() / 2u;
+    if (sortedSeconds.size() % 2u == 0u)
+        return (sortedSeconds[middle - 1u] + sortedSeconds[middle]) / 2.0;
+
+    return sortedSeconds[middle];
+}
+
+double BenchmarkPhaseResult::GetMegabytesPerSecond() const
+{
+    const auto seconds = GetMedianSeconds();
+    if (seconds <= 0.0)
+        return 0.0;
+
+    return static_cast<double>(m_byte_count) / (1024.0 * 1024.0) / seconds;
+}
+
+GameBenchmarkResult::GameBenchmarkResult(std::string game)
+    : m_game(std::move(game)),
+      m_success(false),
+      m_asset_count(0u),
+      m_zone_size(0u),
+      m_dumped_size(0u)
+{
+}
+
+ZoneBenchmark::ZoneBenchmark(const GameId game, const SyntheticZoneOptions options, const unsigned iterationCount, fs::path workingDirectory)
+    : m_game(game),
+      m_options(options),
+      m_iteration_count(iterationCount),
+      m_working_directory(std::move(workingDirectory))
+{
+}
+
+GameBenchmarkResult ZoneBenchmark::Run() const
+{
+    const auto* game = IGame::GetGameById(m_game);
+    GameBenchmarkResult result(game->GetShortName());
+
+    const auto syntheticZone = SyntheticZone::Generate(m_game, std::format("benchmark_{}", game->GetShortName()), m_options);
+    if (!syntheticZone)
+    {
+        std::cerr << std::format("Failed to generate synthetic zone for {}\n", result.m_game);
+        return result;
+    }
+
+    result.m_asset_count = syntheticZone->m_definition->m_assets.size();
+    result.m_phases.emplace_back("create", syntheticZone->m_search_path.GetTotalFileSize());
+    result.m_phases.emplace_back("write", 0u);
+    result.m_phases.emplace_back("load", 0u);
+    result.m_phases.emplace_back("dump", 0u);
+
+    for (auto iteration = 0u; iteration < m_iteration_count; iteration++)
+    {
+        if (!RunIteration(*syntheticZone, result))
+            return result;
+    }
+
+    result.m_success = true;
+    return result;
+}
+
+bool ZoneBenchmark::RunIteration(SyntheticZone& syntheticZone, GameBenchmarkResult& result) const
+{
+    const auto& zoneName = syntheticZone.m_definition->m_name;
+
+    // Every iteration starts with an empty cache, otherwise only the first iteration would actually create the assets
+    const auto cacheDirectory = m_working_directory / "cache";
+    std::error_code ec;
+    fs::remove_all(cacheDirectory, ec);
+
+    const auto createStart = std::chrono::steady_clock::now();
+    ZoneCreationContext creationContext(syntheticZone.m_definition.get(), &syntheticZone.m_search_path, m_working_directory / "out", cacheDirectory);
+    const auto createdZone = zone_creator::CreateZoneForDefinition(m_game, creationContext);
+    const auto createEnd = std::chrono::steady_clock::now();
+
+    if (!createdZone)
+    {
+        std::cerr << std::format("Failed to create zone {}\n", zoneName);
+        return false;
+    }
+
+    // Writing into memory keeps the disk out of the measurement
+    std::ostringstream zoneStream;
+    const auto writeStart = std::chrono::steady_clock::now();
+    const auto writeSuccess = ZoneWriting::WriteZone(zoneStream, *createdZone);
+    const auto writeEnd = std::chrono::steady_clock::now();
+
+    if (!writeSuccess)
+    {
+        std::cerr << std::format("Failed to write zone {}\n", zoneName);
+        return false;
+    }
+
+    const auto zoneData = std::move(zoneStream).str();
+    const auto zoneFilePath = m_working_directory / std::format("{}.ff", zoneName);
+    {
+        std::ofstream zoneFile(zoneFilePath, std::fstream::out | std::fstream::binary);
+        zoneFile.write(zoneData.data(), static_cast<std::streamsize>(zoneData.size()));
+        if (!zoneFile.good())
+        {
+            std::cerr << std::format("Failed to write zone file {}\n", zoneFilePath.string());
+            return false;
+        }
+    }
+
+    // Loading reads from a file that was just written and is most likely in the file system cache
+    const auto loadStart = std::chrono::steady_clock::now();
+    const auto loadedZone = ZoneLoading::LoadZone(zoneFilePath.string());
+    const auto loadEnd = std::chrono::steady_clock::now();
+
+    if (!loadedZone)
+    {
+        std::cerr << std::format("Failed to load zone {}\n", zoneName);
+        return false;
+    }
+
+    CountingOutputPath dumpOutputPath;
+    SyntheticSearchPath objSearchPath;
+    const auto dumpBasePath = (m_working_directory / "dump").string();
+    AssetDumpingContext dumpingContext(*loadedZone, dumpBasePath, dumpOutputPath, objSearchPath);
+
+    const auto dumpStart = std::chrono::steady_clock::now();
+    const auto dumpSuccess = IObjWriter::GetObjWriterForGame(m_game)->DumpZone(dumpingContext);
+    const auto dumpEnd = std::chrono::steady_clock::now();
+
+    if (!dumpSuccess)
+    {
+        std::cerr << std::format("Failed to dump zone {}\n", zoneName);
+        return false;
+    }
+
+    result.m_zone_size = zoneData.size();
+    result.m_dumped_size = dumpOutputPath.GetByteCount();
+
+    result.m_phases[PHASE_WRITE].m_byte_count = zoneData.size();
+    result.m_phases[PHASE_LOAD].m_byte_count = zoneData.size();
+    result.m_phases[PHASE_DUMP].m_byte_count = zoneData.size();
+
+    result.m_phases[PHASE_CREATE].m_seconds.emplace_back(SecondsBetween(createStart, createEnd));
+    result.m_phases[PHASE_WRITE].m_seconds.emplace_back(SecondsBetween(writeStart, writeEnd));
+    result.m_phases[PHASE_LOAD].m_seconds.emplace_back(SecondsBetween(loadStart, loadEnd));
+    result.m_phases[PHASE_DUMP].m_seconds.emplace_back(SecondsBetween(dumpStart, dumpEnd));
+
+    std::error_code ec;
+    fs::remove(zoneFilePath, ec);
+
+    return true;
+}
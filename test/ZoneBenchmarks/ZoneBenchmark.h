@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Game/IGame.h"
+#include "SyntheticZone.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+class BenchmarkPhaseResult
+{
+public:
+    std::string m_name;
+    size_t m_byte_count;
+    std::vector<double> m_seconds;
+
+    BenchmarkPhaseResult(std::string name, size_t byteCount);
+
+    _NODISCARD double GetMedianSeconds() const;
+    _NODISCARD double GetMegabytesPerSecond() const;
+};
+
+class GameBenchmarkResult
+{
+public:
+    std::string m_game;
+    bool m_success;
+    size_t m_asset_count;
+    size_t m_zone_size;
+    size_t m_dumped_size;
+    std::vector<BenchmarkPhaseResult> m_phases;
+
+    explicit GameBenchmarkResult(std::string game);
+};
+
+/**
+ * \brief Measures the throughput of creating, writing, loading and dumping a synthetic zone for a single game.
+ * Every iteration runs all phases once in order, the zone of one phase being the input of the next one.
+ */
+class ZoneBenchmark
+{
+public:
+    ZoneBenchmark(GameId game, SyntheticZoneOptions options, unsigned iterationCount, std::filesystem::path workingDirectory);
+
+    GameBenchmarkResult Run() const;
+
+private:
+    bool RunIteration(SyntheticZone& syntheticZone, GameBenchmarkResult& result) const;
+
+    GameId m_game;
+    SyntheticZoneOptions m_options;
+    unsigned m_iteration_count;
+    std::filesystem::path m_working_directory;
+};
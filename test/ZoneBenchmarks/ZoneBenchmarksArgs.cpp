@@ -0,0 +1,160 @@
+#include "ZoneBenchmarksArgs.h"
+
+#include "Utils/Arguments/UsageInformation.h"
+#include "Utils/StringUtils.h"
+
+#include <charconv>
+#include <format>
+#include <iostream>
+#include <type_traits>
+
+// clang-format off
+const CommandLineOption* const OPTION_HELP =
+    CommandLineOption::Builder::Create()
+    .WithShortName("?")
+    .WithLongName("help")
+    .WithDescription("Displays usage information.")
+    .Build();
+
+const CommandLineOption* const OPTION_GAME =
+    CommandLineOption::Builder::Create()
+    .WithShortName("g")
+    .WithLongName("game")
+    .WithDescription("Only benchmarks the specified game. Can be specified multiple times. Defaults to all games.")
+    .WithParameter("gameName")
+    .Reusable()
+    .Build();
+
+const CommandLineOption* const OPTION_ITERATIONS =
+    CommandLineOption::Builder::Create()
+    .WithShortName("i")
+    .WithLongName("iterations")
+    .WithDescription(std::format("The amount of times every benchmark is run. The median duration is reported. Defaults to {}.", ZoneBenchmarksArgs::DEFAULT_ITERATION_COUNT))
+    .WithParameter("iterationCount")
+    .Build();
+
+const CommandLineOption* const OPTION_SCALE =
+    CommandLineOption::Builder::Create()
+    .WithShortName("s")
+    .WithLongName("scale")
+    .WithDescription(std::format("Multiplies the amount of assets in the synthetic zones. Defaults to {}.", ZoneBenchmarksArgs::DEFAULT_SCALE))
+    .WithParameter("scale")
+    .Build();
+
+const CommandLineOption* const OPTION_OUTPUT =
+    CommandLineOption::Builder::Create()
+    .WithShortName("o")
+    .WithLongName("output")
+    .WithDescription("Writes the results as json to the specified file.")
+    .WithParameter("outputFilePath")
+    .Build();
+
+// clang-format on
+
+const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
+    OPTION_HELP,
+    OPTION_GAME,
+    OPTION_ITERATIONS,
+    OPTION_SCALE,
+    OPTION_OUTPUT,
+};
+
+namespace
+{
+    template<typename T> bool ParsePositiveNumber(const std::string& value, T& result)
+    {
+        const auto* end = value.data() + value.size();
+        const auto [ptr, ec] = std::from_chars(value.data(), end, result);
+
+        return ec == std::errc() && ptr == end && result > 0;
+    }
+} // namespace
+
+ZoneBenchmarksArgs::ZoneBenchmarksArgs()
+    : m_iteration_count(DEFAULT_ITERATION_COUNT),
+      m_scale(DEFAULT_SCALE),
+      m_argument_parser(COMMAND_LINE_OPTIONS, std::extent_v<decltype(COMMAND_LINE_OPTIONS)>)
+{
+}
+
+void ZoneBenchmarksArgs::PrintUsage() const
+{
+    UsageInformation usage(m_argument_parser.GetExecutableName());
+
+    for (const auto* commandLineOption : COMMAND_LINE_OPTIONS)
+    {
+        usage.AddCommandLineOption(commandLineOption);
+    }
+
+    usage.Print();
+}
+
+bool ZoneBenchmarksArgs::AddGame(const std::string& gameName)
+{
+    auto upperGameName = gameName;
+    utils::MakeStringUpperCase(upperGameName);
+
+    for (auto game = 0u; game < static_cast<unsigned>(GameId::COUNT); game++)
+    {
+        const auto gameId = static_cast<GameId>(game);
+        if (IGame::GetGameById(gameId)->GetShortName() == upperGameName)
+        {
+            m_games.emplace_back(gameId);
+            return true;
+        }
+    }
+
+    std::cerr << std::format("Unknown game \"{}\"\n", gameName);
+    return false;
+}
+
+bool ZoneBenchmarksArgs::ParseArgs(const int argc, const char** argv, bool& shouldContinue)
+{
+    shouldContinue = true;
+    if (!m_argument_parser.ParseArguments(argc, argv))
+    {
+        PrintUsage();
+        return false;
+    }
+
+    // Check if the user requested help
+    if (m_argument_parser.IsOptionSpecified(OPTION_HELP))
+    {
+        PrintUsage();
+        shouldContinue = false;
+        return true;
+    }
+
+    // -g; --game
+    for (const auto& gameName : m_argument_parser.GetParametersForOption(OPTION_GAME))
+    {
+        if (!AddGame(gameName))
+            return false;
+    }
+
+    if (m_games.empty())
+    {
+        for (auto game = 0u; game < static_cast<unsigned>(GameId::COUNT); game++)
+            m_games.emplace_back(static_cast<GameId>(game));
+    }
+
+    // -i; --iterations
+    if (m_argument_parser.IsOptionSpecified(OPTION_ITERATIONS) && !ParsePositiveNumber(m_argument_parser.GetValueForOption(OPTION_ITERATIONS), m_iteration_count))
+    {
+        std::cerr << "The iteration count must be a positive number\n";
+        return false;
+    }
+
+    // -s; --scale
+    if (m_argument_parser.IsOptionSpecified(OPTION_SCALE) && !ParsePositiveNumber(m_argument_parser.GetValueForOption(OPTION_SCALE), m_scale))
+    {
+        std::cerr << "The scale must be a positive number\n";
+        return false;
+    }
+
+    // -o; --output
+    if (m_argument_parser.IsOptionSpecified(OPTION_OUTPUT))
+        m_output_file = m_argument_parser.GetValueForOption(OPTION_OUTPUT);
+
+    return true;
+}
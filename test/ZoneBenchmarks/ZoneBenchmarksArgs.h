@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Game/IGame.h"
+#include "Utils/Arguments/ArgumentParser.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class ZoneBenchmarksArgs
+{
+public:
+    static constexpr auto DEFAULT_ITERATION_COUNT = 3u;
+    static constexpr auto DEFAULT_SCALE = 1uz;
+
+    ZoneBenchmarksArgs();
+    bool ParseArgs(int argc, const char** argv, bool& shouldContinue);
+
+    std::vector<GameId> m_games;
+    unsigned m_iteration_count;
+    size_t m_scale;
+    std::string m_output_file;
+
+private:
+    /**
+     * \brief Prints a command line usage help text for the ZoneBenchmarks tool to stdout.
+     */
+    void PrintUsage() const;
+
+    bool AddGame(const std::string& gameName);
+
+    ArgumentParser m_argument_parser;
+};
@@ -0,0 +1,139 @@
+#include "GitVersion.h"
+#include "VertexWelderBenchmark.h"
+#include "ZoneBenchmark.h"
+#include "ZoneBenchmarksArgs.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <nlohmann/json.hpp>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    nlohmann::ordered_json PhasesToJson(const std::vector<BenchmarkPhaseResult>& phases)
+    {
+        auto phasesJson = nlohmann::ordered_json::object();
+        for (const auto& phase : phases)
+        {
+            phasesJson[phase.m_name] = nlohmann::ordered_json{
+                {"bytes",             phase.m_byte_count           },
+                {"median_seconds",    phase.GetMedianSeconds()     },
+                {"mb_per_second",     phase.GetMegabytesPerSecond()},
+                {"iteration_seconds", phase.m_seconds              },
+            };
+        }
+
+        return phasesJson;
+    }
+
+    nlohmann::ordered_json ResultsToJson(const ZoneBenchmarksArgs& args, const std::vector<GameBenchmarkResult>& results, const VertexWelderBenchmarkResult& welderResult)
+    {
+        auto gamesJson = nlohmann::ordered_json::array();
+        for (const auto& result : results)
+        {
+            gamesJson.emplace_back(nlohmann::ordered_json{
+                {"game",        result.m_game                },
+                {"success",     result.m_success             },
+                {"asset_count", result.m_asset_count         },
+                {"zone_size",   result.m_zone_size           },
+                {"dumped_size", result.m_dumped_size         },
+                {"phases",      PhasesToJson(result.m_phases)},
+            });
+        }
+
+        nlohmann::ordered_json welderJson{
+            {"triangle_count",      welderResult.m_triangle_count      },
+            {"corner_count",        welderResult.m_corner_count        },
+            {"welded_vertex_count", welderResult.m_welded_vertex_count },
+            {"phases",              PhasesToJson(welderResult.m_phases)},
+        };
+
+        return nlohmann::ordered_json{
+            {"version",       GIT_VERSION           },
+            {"iterations",    args.m_iteration_count},
+            {"scale",         args.m_scale          },
+            {"games",         std::move(gamesJson)  },
+            {"vertex_welder", std::move(welderJson) },
+        };
+    }
+
+    void PrintResults(const std::vector<GameBenchmarkResult>& results)
+    {
+        std::cout << std::format("\n{:<6} {:>8} {:>12} {:>14} {:>14} {:>14} {:>14}\n", "Game", "Assets", "Zone MB", "Create MB/s", "Write MB/s", "Load MB/s", "Dump MB/s");
+
+        for (const auto& result : results)
+        {
+            if (!result.m_success)
+            {
+                std::cout << std::format("{:<6} failed\n", result.m_game);
+                continue;
+            }
+
+            std::cout << std::format("{:<6} {:>8} {:>12.2f}", result.m_game, result.m_asset_count, static_cast<double>(result.m_zone_size) / (1024.0 * 1024.0));
+            for (const auto& phase : result.m_phases)
+                std::cout << std::format(" {:>14.2f}", phase.GetMegabytesPerSecond());
+            std::cout << "\n";
+        }
+    }
+
+    void PrintVertexWelderResult(const VertexWelderBenchmarkResult& result)
+    {
+        std::cout << std::format("\nWelding {} triangles ({} corners) into {} vertices\n", result.m_triangle_count, result.m_corner_count, result.m_welded_vertex_count);
+        for (const auto& phase : result.m_phases)
+            std::cout << std::format("{:<14} {:>10.2f} ms {:>14.2f} MB/s\n", phase.m_name, phase.GetMedianSeconds() * 1000.0, phase.GetMegabytesPerSecond());
+    }
+} // namespace
+
+int main(const int argc, const char** argv)
+{
+    ZoneBenchmarksArgs args;
+    auto shouldContinue = true;
+    if (!args.ParseArgs(argc, argv, shouldContinue))
+        return 1;
+
+    if (!shouldContinue)
+        return 0;
+
+    const auto workingDirectory = fs::temp_directory_path() / "oat_zone_benchmarks";
+    fs::create_directories(workingDirectory);
+
+    std::vector<GameBenchmarkResult> results;
+    for (const auto game : args.m_games)
+    {
+        const ZoneBenchmark benchmark(game, SyntheticZoneOptions::ForScale(args.m_scale), args.m_iteration_count, workingDirectory);
+        results.emplace_back(benchmark.Run());
+    }
+
+    std::error_code ec;
+    fs::remove_all(workingDirectory, ec);
+
+    const VertexWelderBenchmark welderBenchmark(VertexWelderBenchmark::DEFAULT_TRIANGLE_COUNT, args.m_iteration_count);
+    const auto welderResult = welderBenchmark.Run();
+
+    PrintResults(results);
+    PrintVertexWelderResult(welderResult);
+
+    if (!args.m_output_file.empty())
+    {
+        std::ofstream outputFile(args.m_output_file, std::fstream::out | std::fstream::binary);
+        if (!outputFile.is_open())
+        {
+            std::cerr << std::format("Could not open output file \"{}\"\n", args.m_output_file);
+            return 1;
+        }
+
+        outputFile << ResultsToJson(args, results, welderResult).dump(4) << "\n";
+    }
+
+    const auto allSucceeded = std::ranges::all_of(results,
+                                                  [](const GameBenchmarkResult& result)
+                                                  {
+                                                      return result.m_success;
+                                                  });
+
+    return allSucceeded ? 0 : 1;
+}
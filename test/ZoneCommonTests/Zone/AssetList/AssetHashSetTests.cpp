@@ -0,0 +1,58 @@
+#include "Zone/AssetList/AssetHashSet.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <format>
+#include <string>
+#include <vector>
+
+namespace test::zone::asset_list::asset_hash_set
+{
+    TEST_CASE("AssetHashSet: Contains all added assets", "[assetlist]")
+    {
+        std::vector<uint64_t> assetHashes;
+        for (auto i = 0u; i < 5000u; i++)
+            assetHashes.emplace_back(AssetHashSet::HashAsset(i % 7u, std::format("asset_{}", i)));
+
+        const AssetHashSet set(std::move(assetHashes));
+
+        for (auto i = 0u; i < 5000u; i++)
+            REQUIRE(set.Contains(i % 7u, std::format("asset_{}", i)));
+    }
+
+    TEST_CASE("AssetHashSet: Does not contain assets that were not added", "[assetlist]")
+    {
+        std::vector<uint64_t> assetHashes;
+        for (auto i = 0u; i < 1000u; i++)
+            assetHashes.emplace_back(AssetHashSet::HashAsset(1u, std::format("asset_{}", i)));
+
+        const AssetHashSet set(std::move(assetHashes));
+
+        for (auto i = 0u; i < 1000u; i++)
+        {
+            REQUIRE(!set.Contains(2u, std::format("asset_{}", i)));
+            REQUIRE(!set.Contains(1u, std::format("other_asset_{}", i)));
+        }
+    }
+
+    TEST_CASE("AssetHashSet: Handles duplicate and empty sets", "[assetlist]")
+    {
+        const AssetHashSet emptySet;
+        REQUIRE(!emptySet.Contains(1u, "asset"));
+        REQUIRE(emptySet.GetAssetHashes().empty());
+
+        const auto assetHash = AssetHashSet::HashAsset(1u, "asset");
+        const AssetHashSet set(std::vector{assetHash, assetHash, assetHash});
+        REQUIRE(set.GetAssetHashes().size() == 1u);
+        REQUIRE(set.Contains(1u, "asset"));
+        REQUIRE(!set.Contains(0u));
+    }
+
+    TEST_CASE("AssetHashSet: Hashes are stable", "[assetlist]")
+    {
+        // Hashes are persisted in cache files, so they must not change between runs or platforms
+        REQUIRE(AssetHashSet::HashAsset(1u, "asset") == 0x1A1C0C4365733D99u);
+        REQUIRE(AssetHashSet::HashAsset(2u, "asset") == 0xD66BDB90F30036E8u);
+        REQUIRE(AssetHashSet::HashAsset(0u, "") == 0xACA6D6B54BE3ED05u);
+        REQUIRE(AssetHashSet::HashAsset(0x2Au, "mp/default_weapon") == 0xA878D710493A958Fu);
+    }
+} // namespace test::zone::asset_list::asset_hash_set
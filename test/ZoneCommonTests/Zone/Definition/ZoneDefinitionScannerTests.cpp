@@ -0,0 +1,83 @@
+#include "Game/T6/T6.h"
+#include "SearchPath/MockSearchPath.h"
+#include "Zone/Definition/Parsing/ZoneDefinitionScanner.h"
+#include "Zone/Definition/ZoneDefinitionTestUtils.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+namespace test::zone::definition::zone_definition_scanner
+{
+    TEST_CASE("ZoneDefinitionScanner: Ensure scanned definition matches parsed definition", "[zonedefinition]")
+    {
+        const std::string inputData(R"sampledata(
+// Call Of Duty: Black Ops II
+>game,T6
+>name,test_mod
+>gdt,test_mod
+
+techniqueset,,trivial_9z33feqw // Comment after entry
+include,demo_gun
+material,"string // with slashes"
+ignore,common_mp
+build,other_mod
+)sampledata");
+
+        MockSearchPath mockSearchPath;
+        mockSearchPath.AddFileData("demo_gun.zone", R"sampledata(
+>level.ipak_read,code_post_gfx
+weapon,demo_gun
+  material , demo_gun_camo
+)sampledata");
+
+        ZoneDefinitionScanner scanner("test", mockSearchPath);
+        const auto scanned = scanner.Scan(inputData);
+        REQUIRE(scanned);
+
+        REQUIRE(scanned->m_assets.size() == 4u);
+        REQUIRE(scanned->m_assets[2].m_asset_name == "demo_gun_camo");
+        REQUIRE(scanned->m_assets[3].m_asset_name == "string // with slashes");
+        REQUIRE(scanned->m_properties.m_properties.size() == 1u);
+
+        const auto parsed = ParseDefinitionWithoutScanner(inputData, mockSearchPath);
+        REQUIRE(parsed);
+
+        RequireSameDefinition(*scanned, *parsed);
+    }
+
+    TEST_CASE("ZoneDefinitionScanner: Ensure preprocessor directives are left to the parser", "[zonedefinition]")
+    {
+        MockSearchPath mockSearchPath;
+        ZoneDefinitionScanner scanner("test", mockSearchPath);
+
+        REQUIRE(!scanner.Scan(R"sampledata(
+>game,T6
+#define MATERIAL_NAME gradient_top
+material,MATERIAL_NAME
+)sampledata"));
+    }
+
+    TEST_CASE("ZoneDefinitionScanner: Ensure block comments are left to the parser", "[zonedefinition]")
+    {
+        MockSearchPath mockSearchPath;
+        ZoneDefinitionScanner scanner("test", mockSearchPath);
+
+        REQUIRE(!scanner.Scan(R"sampledata(
+>game,T6
+/*
+material,gradient_top
+*/
+)sampledata"));
+    }
+
+    TEST_CASE("ZoneDefinitionScanner: Ensure unknown asset types are left to the parser", "[zonedefinition]")
+    {
+        MockSearchPath mockSearchPath;
+        ZoneDefinitionScanner scanner("test", mockSearchPath);
+
+        REQUIRE(!scanner.Scan(R"sampledata(
+>game,T6
+notanassettype,gradient_top
+)sampledata"));
+    }
+} // namespace test::zone::definition::zone_definition_scanner
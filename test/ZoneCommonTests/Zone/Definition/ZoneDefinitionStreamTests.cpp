@@ -1,16 +1,16 @@
 ﻿#include "Game/T6/T6.h"
 #include "SearchPath/MockSearchPath.h"
-#include "Zone/Definition/ZoneDefinitionStream.h"
+#include "Zone/Definition/ZoneDefinitionTestUtils.h"
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
-#include <sstream>
+#include <string>
 
 namespace test::zone::definition::zone_definition_stream
 {
     TEST_CASE("ZoneDefinitionInputStream: Ensure can read simple ZoneDefinition", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,common_mp
@@ -21,9 +21,7 @@ menu,demo_ingame
 )sampledata");
 
         MockSearchPath mockSearchPath;
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
 
         REQUIRE(result->m_game == GameId::T6);
@@ -45,7 +43,7 @@ menu,demo_ingame
 
     TEST_CASE("ZoneDefinitionInputStream: Ensure ZoneDefinition name is target name by default", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 
@@ -53,9 +51,7 @@ material,demo_material
 )sampledata");
 
         MockSearchPath mockSearchPath;
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
 
         REQUIRE(result->m_game == GameId::T6);
@@ -65,7 +61,7 @@ material,demo_material
 
     TEST_CASE("ZoneDefinitionInputStream: Ensure can include other ZoneDefinitions", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,test_mod
@@ -88,9 +84,7 @@ material,demo_gun_material
 rawfile,demo_gun_script.gsc
 )sampledata");
 
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
         REQUIRE(result->m_assets.size() == 3);
 
@@ -117,7 +111,7 @@ rawfile,demo_gun_script.gsc
 
     TEST_CASE("ZoneDefinitionInputStream: Ensure can include assetlists", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,test_mod
@@ -141,9 +135,7 @@ material,common_mat
 rawfile,common_mp
 )sampledata");
 
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
         REQUIRE(result->m_assets.size() == 6);
 
@@ -168,7 +160,7 @@ rawfile,common_mp
 
     TEST_CASE("ZoneDefinitionInputStream: Ensure can define other build targets", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,test_mod
@@ -181,9 +173,7 @@ build,more_mods
 )sampledata");
 
         MockSearchPath mockSearchPath;
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
 
         REQUIRE(result->m_assets.size() == 1);
@@ -195,7 +185,7 @@ build,more_mods
 
     TEST_CASE("ZoneDefinitionInputStream: Ensure can ignore other zones", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,test_mod
@@ -207,9 +197,7 @@ material,test_material
 )sampledata");
 
         MockSearchPath mockSearchPath;
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
 
         REQUIRE(result->m_assets.size() == 1);
@@ -221,7 +209,7 @@ material,test_material
 
     TEST_CASE("ZoneDefinitionInputStream: Ensure can read gdts", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,test_mod
@@ -232,9 +220,7 @@ material,test_material
 )sampledata");
 
         MockSearchPath mockSearchPath;
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
 
         REQUIRE(result->m_assets.size() == 1);
@@ -246,7 +232,7 @@ material,test_material
 
     TEST_CASE("ZoneDefinitionInputStream: Ensure can define meta data", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,test_mod
@@ -259,9 +245,7 @@ material,test_material
 )sampledata");
 
         MockSearchPath mockSearchPath;
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
 
         REQUIRE(result->m_assets.size() == 1);
@@ -284,7 +268,7 @@ material,test_material
 
     TEST_CASE("ZoneDefinitionInputStream: Ensure can define IWD", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,test_mod
@@ -298,9 +282,7 @@ material,lastMaterial
 )sampledata");
 
         MockSearchPath mockSearchPath;
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
 
         REQUIRE(result->m_assets.size() == 3);
@@ -314,7 +296,7 @@ material,lastMaterial
 
     TEST_CASE("ZoneDefinitionInputStream: Defining another IWD stops current one", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,test_mod
@@ -331,9 +313,7 @@ material,lastMaterial
 )sampledata");
 
         MockSearchPath mockSearchPath;
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
 
         REQUIRE(result->m_assets.size() == 3);
@@ -352,7 +332,7 @@ material,lastMaterial
 
     TEST_CASE("ZoneDefinitionInputStream: Ensure can define IPak", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,test_mod
@@ -366,9 +346,7 @@ material,lastMaterial
 )sampledata");
 
         MockSearchPath mockSearchPath;
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
 
         REQUIRE(result->m_assets.size() == 3);
@@ -382,7 +360,7 @@ material,lastMaterial
 
     TEST_CASE("ZoneDefinitionInputStream: Defining another IPak stops current one", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,test_mod
@@ -399,9 +377,7 @@ material,lastMaterial
 )sampledata");
 
         MockSearchPath mockSearchPath;
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
 
         REQUIRE(result->m_assets.size() == 3);
@@ -420,7 +396,7 @@ material,lastMaterial
 
     TEST_CASE("ZoneDefinitionInputStream: Ensure can define IWD and IPak at the same time", "[zonedefinition]")
     {
-        std::istringstream inputData(R"sampledata(
+        const std::string inputData(R"sampledata(
 // Call Of Duty: Black Ops II
 >game,T6
 >name,test_mod
@@ -437,9 +413,7 @@ material,lastMaterial
 )sampledata");
 
         MockSearchPath mockSearchPath;
-        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", mockSearchPath);
-
-        const auto result = inputStream.ReadDefinition();
+        const auto result = ReadDefinition(inputData, mockSearchPath);
         REQUIRE(result);
 
         REQUIRE(result->m_assets.size() == 3);
@@ -0,0 +1,75 @@
+#include "ZoneDefinitionTestUtils.h"
+
+#include "Parsing/Impl/CommentRemovingStreamProxy.h"
+#include "Parsing/Impl/DefinesStreamProxy.h"
+#include "Parsing/Impl/IncludingStreamProxy.h"
+#include "Parsing/Impl/ParserMultiInputStream.h"
+#include "SearchPath/SearchPathMultiInputStream.h"
+#include "Zone/Definition/Parsing/ZoneDefinitionLexer.h"
+#include "Zone/Definition/Parsing/ZoneDefinitionParser.h"
+#include "Zone/Definition/ZoneDefinitionStream.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+
+namespace test::zone::definition
+{
+    std::unique_ptr<ZoneDefinition> ParseDefinitionWithoutScanner(const std::string& content, ISearchPath& searchPath)
+    {
+        std::istringstream stream(content);
+        SearchPathMultiInputStream inclusionCallback(searchPath);
+        ParserMultiInputStream baseStream(stream, "test.zone", inclusionCallback);
+        CommentRemovingStreamProxy commentProxy(&baseStream);
+        IncludingStreamProxy includingProxy(&commentProxy);
+        DefinesStreamProxy definesProxy(&includingProxy);
+
+        ZoneDefinitionLexer lexer(&definesProxy);
+        ZoneDefinitionParser parser(&lexer, "test", searchPath, definesProxy, std::nullopt);
+        if (!parser.Parse())
+            return nullptr;
+
+        return parser.GetParsedValue();
+    }
+
+    void RequireSameDefinition(const ZoneDefinition& definition, const ZoneDefinition& expected)
+    {
+        REQUIRE(definition.m_game == expected.m_game);
+        REQUIRE(definition.m_name == expected.m_name);
+        REQUIRE(definition.m_properties.m_properties == expected.m_properties.m_properties);
+        REQUIRE(definition.m_gdts == expected.m_gdts);
+        REQUIRE(definition.m_ignores == expected.m_ignores);
+        REQUIRE(definition.m_targets_to_build == expected.m_targets_to_build);
+
+        REQUIRE(definition.m_assets.size() == expected.m_assets.size());
+        for (auto i = 0uz; i < definition.m_assets.size(); i++)
+        {
+            REQUIRE(definition.m_assets[i].m_asset_type == expected.m_assets[i].m_asset_type);
+            REQUIRE(definition.m_assets[i].m_asset_name == expected.m_assets[i].m_asset_name);
+            REQUIRE(definition.m_assets[i].m_is_reference == expected.m_assets[i].m_is_reference);
+        }
+
+        REQUIRE(definition.m_obj_containers.size() == expected.m_obj_containers.size());
+        for (auto i = 0uz; i < definition.m_obj_containers.size(); i++)
+        {
+            REQUIRE(definition.m_obj_containers[i].m_name == expected.m_obj_containers[i].m_name);
+            REQUIRE(definition.m_obj_containers[i].m_type == expected.m_obj_containers[i].m_type);
+            REQUIRE(definition.m_obj_containers[i].m_asset_start == expected.m_obj_containers[i].m_asset_start);
+            REQUIRE(definition.m_obj_containers[i].m_asset_end == expected.m_obj_containers[i].m_asset_end);
+        }
+    }
+
+    std::unique_ptr<ZoneDefinition> ReadDefinition(const std::string& content, ISearchPath& searchPath)
+    {
+        std::istringstream inputData(content);
+        ZoneDefinitionInputStream inputStream(inputData, "test", "test.zone", searchPath);
+        auto result = inputStream.ReadDefinition();
+
+        // Reading may take the scanner fast path, which must not change the outcome
+        const auto parsed = ParseDefinitionWithoutScanner(content, searchPath);
+        REQUIRE(static_cast<bool>(result) == static_cast<bool>(parsed));
+        if (result)
+            RequireSameDefinition(*result, *parsed);
+
+        return result;
+    }
+} // namespace test::zone::definition
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "SearchPath/ISearchPath.h"
+#include "Zone/Definition/ZoneDefinition.h"
+
+#include <memory>
+#include <string>
+
+namespace test::zone::definition
+{
+    /**
+     * \brief Parses a zone definition with the parser only, without trying the scanner fast path first.
+     */
+    std::unique_ptr<ZoneDefinition> ParseDefinitionWithoutScanner(const std::string& content, ISearchPath& searchPath);
+
+    void RequireSameDefinition(const ZoneDefinition& definition, const ZoneDefinition& expected);
+
+    /**
+     * \brief Reads a zone definition like the linker does and ensures the parser alone results in the same definition.
+     */
+    std::unique_ptr<ZoneDefinition> ReadDefinition(const std::string& content, ISearchPath& searchPath);
+} // namespace test::zone::definition
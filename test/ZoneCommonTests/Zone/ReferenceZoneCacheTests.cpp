@@ -0,0 +1,178 @@
+#include "Zone/ReferenceZoneCache.h"
+
+#include "Game/IW4/IW4.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <format>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace IW4;
+
+namespace
+{
+    constexpr auto ZONE_SIZE = 1024uz * 1024uz;
+
+    class ReferenceZoneCacheTestHelper
+    {
+    public:
+        ReferenceZoneCacheTestHelper()
+            : m_cache(
+                  [this](const std::string& zonePath)
+                  {
+                      return LoadZone(zonePath);
+                  },
+                  [this](std::unique_ptr<Zone> zone)
+                  {
+                      m_unloads.emplace_back(zone->m_name);
+                  },
+                  [this](const Zone& zone)
+                  {
+                      return m_zones_with_containers.contains(zone.m_name);
+                  })
+        {
+        }
+
+        void AddZones(const std::vector<std::string>& zoneNames)
+        {
+            for (const auto& zoneName : zoneNames)
+                REQUIRE(m_cache.AddZone(zoneName));
+        }
+
+        std::unique_ptr<Zone> LoadZone(const std::string& zonePath)
+        {
+            m_loads.emplace_back(zonePath);
+            if (m_failing_zones.contains(zonePath))
+                return nullptr;
+
+            auto zone = std::make_unique<Zone>(zonePath, 0, IGame::GetGameById(GameId::IW4));
+            zone->m_pools->AddAsset(ASSET_TYPE_IMAGE, std::format("{}_image", zonePath), &m_image, {}, {}, {});
+            zone->GetMemory()->AllocRaw(ZONE_SIZE);
+
+            return zone;
+        }
+
+        std::unique_ptr<Zone> CreateZoneReferencing(const std::vector<std::string>& zoneNames)
+        {
+            auto zone = std::make_unique<Zone>("unlinked", 0, IGame::GetGameById(GameId::IW4));
+            for (const auto& zoneName : zoneNames)
+                zone->m_pools->AddAsset(ASSET_TYPE_IMAGE, std::format(",{}_image", zoneName), &m_image, {}, {}, {});
+
+            return zone;
+        }
+
+        bool PrepareForZoneReferencing(const std::vector<std::string>& zoneNames)
+        {
+            const auto zone = CreateZoneReferencing(zoneNames);
+            return m_cache.PrepareForZone(*zone);
+        }
+
+        GfxImage m_image{};
+        std::unordered_set<std::string> m_zones_with_containers;
+        std::unordered_set<std::string> m_failing_zones;
+        std::vector<std::string> m_loads;
+        std::vector<std::string> m_unloads;
+        ReferenceZoneCache m_cache;
+    };
+
+    TEST_CASE("ReferenceZoneCache: Keeps all zones loaded without memory budget", "[zone][cache]")
+    {
+        ReferenceZoneCacheTestHelper helper;
+        helper.AddZones({"a", "b", "c"});
+
+        REQUIRE(helper.PrepareForZoneReferencing({"a"}));
+        REQUIRE(helper.PrepareForZoneReferencing({}));
+
+        REQUIRE(helper.m_loads == std::vector<std::string>{"a", "b", "c"});
+        REQUIRE(helper.m_unloads.empty());
+        REQUIRE(helper.m_cache.GetLoadedZoneCount() == 3u);
+        REQUIRE(helper.m_cache.GetResidentSize() >= 3u * ZONE_SIZE);
+    }
+
+    TEST_CASE("ReferenceZoneCache: Unloads least recently used zones that are not referenced to meet the budget", "[zone][cache]")
+    {
+        ReferenceZoneCacheTestHelper helper;
+        helper.AddZones({"a", "b", "c"});
+        helper.m_cache.SetMemoryBudget(ZONE_SIZE * 5u / 2u);
+
+        REQUIRE(helper.PrepareForZoneReferencing({"a"}));
+
+        REQUIRE(helper.m_unloads == std::vector<std::string>{"b"});
+        REQUIRE(helper.m_cache.GetLoadedZoneCount() == 2u);
+        REQUIRE(helper.m_cache.GetResidentSize() <= ZONE_SIZE * 5u / 2u);
+        REQUIRE(helper.m_cache.GetReloadCount() == 0u);
+    }
+
+    TEST_CASE("ReferenceZoneCache: Loads unloaded zones again when they are referenced", "[zone][cache]")
+    {
+        ReferenceZoneCacheTestHelper helper;
+        helper.AddZones({"a", "b", "c"});
+        helper.m_cache.SetMemoryBudget(ZONE_SIZE * 5u / 2u);
+
+        REQUIRE(helper.PrepareForZoneReferencing({"a"}));
+        REQUIRE(helper.PrepareForZoneReferencing({"b"}));
+
+        // "a" was used more recently by the previous zone, so "c" makes room for "b"
+        REQUIRE(helper.m_unloads == std::vector<std::string>{"b", "c"});
+        REQUIRE(helper.m_loads == std::vector<std::string>{"a", "b", "c", "b"});
+        REQUIRE(helper.m_cache.GetLoadedZoneCount() == 2u);
+        REQUIRE(helper.m_cache.GetReloadCount() == 1u);
+    }
+
+    TEST_CASE("ReferenceZoneCache: Never unloads zones with containers", "[zone][cache]")
+    {
+        ReferenceZoneCacheTestHelper helper;
+        helper.m_zones_with_containers.emplace("b");
+        helper.AddZones({"a", "b", "c"});
+        helper.m_cache.SetMemoryBudget(ZONE_SIZE * 5u / 2u);
+
+        REQUIRE(helper.PrepareForZoneReferencing({"a"}));
+        REQUIRE(helper.m_unloads == std::vector<std::string>{"c"});
+
+        // Only "a" can make room for "c"
+        REQUIRE(helper.PrepareForZoneReferencing({"c"}));
+        REQUIRE(helper.m_unloads == std::vector<std::string>{"c", "a"});
+        REQUIRE(helper.m_cache.GetLoadedZoneCount() == 2u);
+    }
+
+    TEST_CASE("ReferenceZoneCache: Keeps referenced zones loaded when the budget cannot be met", "[zone][cache]")
+    {
+        ReferenceZoneCacheTestHelper helper;
+        helper.AddZones({"a", "b", "c"});
+        helper.m_cache.SetMemoryBudget(ZONE_SIZE);
+
+        REQUIRE(helper.PrepareForZoneReferencing({"a", "b", "c"}));
+
+        REQUIRE(helper.m_unloads.empty());
+        REQUIRE(helper.m_cache.GetLoadedZoneCount() == 3u);
+    }
+
+    TEST_CASE("ReferenceZoneCache: Fails when a referenced zone cannot be loaded again", "[zone][cache]")
+    {
+        ReferenceZoneCacheTestHelper helper;
+        helper.AddZones({"a", "b"});
+        helper.m_cache.SetMemoryBudget(ZONE_SIZE * 3u / 2u);
+
+        REQUIRE(helper.PrepareForZoneReferencing({"a"}));
+        REQUIRE(helper.m_unloads == std::vector<std::string>{"b"});
+
+        helper.m_failing_zones.emplace("b");
+        REQUIRE(!helper.PrepareForZoneReferencing({"b"}));
+    }
+
+    TEST_CASE("ReferenceZoneCache: Unloads all zones in reverse order", "[zone][cache]")
+    {
+        ReferenceZoneCacheTestHelper helper;
+        helper.AddZones({"a", "b", "c"});
+        helper.m_cache.SetMemoryBudget(ZONE_SIZE * 5u / 2u);
+        REQUIRE(helper.PrepareForZoneReferencing({"a"}));
+
+        helper.m_cache.UnloadAll();
+
+        REQUIRE(helper.m_unloads == std::vector<std::string>{"b", "c", "a"});
+        REQUIRE(helper.m_cache.GetLoadedZoneCount() == 0u);
+    }
+} // namespace
@@ -0,0 +1,44 @@
+#include "Zone/ZoneMemory.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <memory>
+
+namespace
+{
+    constexpr auto BLOCK_SIZE = 4uz * 1024uz * 1024uz;
+
+    TEST_CASE("ZoneMemory: Resident size counts allocations", "[zone][memory]")
+    {
+        ZoneMemory memory;
+        REQUIRE(memory.GetResidentSize() == 0u);
+
+        memory.AllocRaw(1024u);
+        memory.AllocRaw(512u);
+
+        REQUIRE(memory.GetResidentSize() == 1536u);
+    }
+
+    TEST_CASE("ZoneMemory: Resident size only counts committed block memory", "[zone][memory]")
+    {
+        ZoneMemory memory;
+        auto block = std::make_unique<XBlock>("test", 0, XBlock::Type::BLOCK_TYPE_TEMP);
+        block->Alloc(BLOCK_SIZE);
+        auto* buffer = block->m_buffer;
+        memory.AddBlock(std::move(block));
+
+        // Memory that was reserved but never written does not count
+        REQUIRE(memory.GetResidentSize() < BLOCK_SIZE / 2u);
+
+        std::memset(buffer, 0xFF, BLOCK_SIZE / 2u);
+        const auto writtenResidentSize = memory.GetResidentSize();
+        REQUIRE(writtenResidentSize >= BLOCK_SIZE / 2u);
+        REQUIRE(writtenResidentSize < BLOCK_SIZE);
+
+#ifdef __linux__
+        // Windows may keep reset pages in the working set until they are needed elsewhere
+        memory.GetBlocks()[0]->Discard();
+        REQUIRE(memory.GetResidentSize() < writtenResidentSize);
+#endif
+    }
+} // namespace
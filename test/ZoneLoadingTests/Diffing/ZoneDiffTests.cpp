@@ -0,0 +1,256 @@
+#include "Diffing/IZoneDiffRecorder.h"
+#include "Diffing/ZoneDiff.h"
+#include "Game/IW4/IW4.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace IW4;
+
+namespace
+{
+    std::vector<std::string> PathsOf(const std::vector<FieldDiff>& fields, const DiffChange change)
+    {
+        std::vector<std::string> paths;
+        for (const auto& field : fields)
+        {
+            if (field.m_change == change)
+                paths.emplace_back(field.m_path);
+        }
+
+        return paths;
+    }
+
+    TEST_CASE("ZoneDiff: Finds no changes in equal records", "[zone][diff]")
+    {
+        const std::vector<AssetDiffRecord> records{
+            {"name", "model"},
+            {"numBones", "\x02"},
+            {"boneNames[0]", "tag_origin"},
+        };
+
+        REQUIRE(ZoneDiff::CompareRecords(records, records).empty());
+        REQUIRE(ZoneDiff::CompareRecords({}, {}).empty());
+    }
+
+    TEST_CASE("ZoneDiff: Compares records with the same layout by position", "[zone][diff]")
+    {
+        const std::vector<AssetDiffRecord> oldRecords{
+            {"name", "model"},
+            {"scale", "1"},
+            {"boneNames[0]", "tag_origin"},
+            {"boneNames[1]", "j_head"},
+        };
+        const std::vector<AssetDiffRecord> newRecords{
+            {"name", "model"},
+            {"scale", "2"},
+            {"boneNames[0]", "tag_origin"},
+            {"boneNames[1]", "j_neck"},
+        };
+
+        const auto fields = ZoneDiff::CompareRecords(oldRecords, newRecords);
+
+        REQUIRE(fields.size() == 2u);
+        REQUIRE(PathsOf(fields, DiffChange::MODIFIED) == std::vector<std::string>{"scale", "boneNames[1]"});
+    }
+
+    TEST_CASE("ZoneDiff: Compares records with different layouts by path", "[zone][diff]")
+    {
+        const std::vector<AssetDiffRecord> oldRecords{
+            {"name", "model"},
+            {"boneNames[0]", "tag_origin"},
+            {"boneNames[1]", "j_head"},
+            {"physPreset", "default"},
+            {"radius", "1"},
+        };
+        const std::vector<AssetDiffRecord> newRecords{
+            {"name", "model"},
+            {"boneNames[0]", "tag_origin"},
+            {"radius", "2"},
+            {"physCollmap", "collmap"},
+        };
+
+        const auto fields = ZoneDiff::CompareRecords(oldRecords, newRecords);
+
+        // Changes of the new records come first in their order, removed records follow in their old order
+        REQUIRE(fields.size() == 4u);
+        REQUIRE(fields[0].m_path == "radius");
+        REQUIRE(fields[0].m_change == DiffChange::MODIFIED);
+        REQUIRE(fields[1].m_path == "physCollmap");
+        REQUIRE(fields[1].m_change == DiffChange::ADDED);
+        REQUIRE(fields[2].m_path == "boneNames[1]");
+        REQUIRE(fields[2].m_change == DiffChange::REMOVED);
+        REQUIRE(fields[3].m_path == "physPreset");
+        REQUIRE(fields[3].m_change == DiffChange::REMOVED);
+    }
+
+    TEST_CASE("ZoneDiff: Compares records of the same count but different paths by path", "[zone][diff]")
+    {
+        const std::vector<AssetDiffRecord> oldRecords{
+            {"name", "model"},
+            {"physPreset", "default"},
+            {"radius", "1"},
+        };
+        const std::vector<AssetDiffRecord> newRecords{
+            {"name", "model"},
+            {"radius", "1"},
+            {"physCollmap", "collmap"},
+        };
+
+        const auto fields = ZoneDiff::CompareRecords(oldRecords, newRecords);
+
+        REQUIRE(PathsOf(fields, DiffChange::MODIFIED).empty());
+        REQUIRE(PathsOf(fields, DiffChange::ADDED) == std::vector<std::string>{"physCollmap"});
+        REQUIRE(PathsOf(fields, DiffChange::REMOVED) == std::vector<std::string>{"physPreset"});
+    }
+
+    TEST_CASE("ZoneDiff: Reports all records as added or removed when the other side has none", "[zone][diff]")
+    {
+        const std::vector<AssetDiffRecord> records{
+            {"name", "model"},
+            {"radius", "1"},
+        };
+
+        REQUIRE(PathsOf(ZoneDiff::CompareRecords({}, records), DiffChange::ADDED) == std::vector<std::string>{"name", "radius"});
+        REQUIRE(PathsOf(ZoneDiff::CompareRecords(records, {}), DiffChange::REMOVED) == std::vector<std::string>{"name", "radius"});
+    }
+
+    class XModelDiffTestData
+    {
+    public:
+        XModelDiffTestData(Zone& zone, const std::vector<std::string>& boneNames, const std::vector<const char*>& materialNames)
+            : m_model{},
+              m_materials(materialNames.size()),
+              m_material_ptrs(materialNames.size()),
+              m_parent_list{0u, 1u, 1u}
+        {
+            for (const auto& boneName : boneNames)
+                m_bone_names.emplace_back(zone.m_script_strings.AddOrGetScriptString(boneName));
+
+            for (auto i = 0uz; i < materialNames.size(); i++)
+            {
+                m_materials[i].info.name = materialNames[i];
+                m_material_ptrs[i] = &m_materials[i];
+            }
+
+            m_model.name = "model";
+            m_model.numBones = static_cast<unsigned char>(m_bone_names.size());
+            m_model.numRootBones = 1u;
+            m_model.numsurfs = static_cast<unsigned char>(m_material_ptrs.size());
+            m_model.boneNames = m_bone_names.data();
+            m_model.parentList = m_parent_list;
+            m_model.materialHandles = m_material_ptrs.data();
+            m_model.radius = 1.0f;
+        }
+
+        std::vector<AssetDiffRecord> Record(const Zone& zone)
+        {
+            const XAssetInfoGeneric asset(ASSET_TYPE_XMODEL, m_model.name, &m_model);
+
+            std::vector<AssetDiffRecord> records;
+            REQUIRE(IZoneDiffRecorder::GetZoneDiffRecorderForGame(GameId::IW4)->RecordAsset(zone, asset, records));
+
+            return records;
+        }
+
+        XModel m_model;
+        std::vector<scr_string_t> m_bone_names;
+        std::vector<Material> m_materials;
+        std::vector<Material*> m_material_ptrs;
+        unsigned char m_parent_list[3];
+    };
+
+    class XModelDiffTestHelper
+    {
+    public:
+        XModelDiffTestHelper()
+            : m_old_zone("OldZone", 0, IGame::GetGameById(GameId::IW4)),
+              m_new_zone("NewZone", 0, IGame::GetGameById(GameId::IW4))
+        {
+            // Script string indices differ between the zones
+            m_old_zone.m_script_strings.AddOrGetScriptString("unrelated");
+        }
+
+        Zone m_old_zone;
+        Zone m_new_zone;
+    };
+
+    TEST_CASE("ZoneDiff: Generated recorder compares data behind pointers, script strings and asset names by content", "[zone][diff]")
+    {
+        XModelDiffTestHelper helper;
+        XModelDiffTestData oldModel(helper.m_old_zone, {"tag_origin", "j_head", "j_neck"}, {"mtl_body", "mtl_head"});
+        XModelDiffTestData newModel(helper.m_new_zone, {"tag_origin", "j_head", "j_neck"}, {"mtl_body", "mtl_head"});
+        REQUIRE(oldModel.m_bone_names != newModel.m_bone_names);
+
+        const auto oldRecords = oldModel.Record(helper.m_old_zone);
+        const auto newRecords = newModel.Record(helper.m_new_zone);
+
+        REQUIRE(!oldRecords.empty());
+        REQUIRE(ZoneDiff::CompareRecords(oldRecords, newRecords).empty());
+    }
+
+    TEST_CASE("ZoneDiff: Generated recorder finds modified pointer data, script strings and asset names", "[zone][diff]")
+    {
+        XModelDiffTestHelper helper;
+        XModelDiffTestData oldModel(helper.m_old_zone, {"tag_origin", "j_head", "j_neck"}, {"mtl_body", "mtl_head"});
+        XModelDiffTestData newModel(helper.m_new_zone, {"tag_origin", "j_head", "j_spine"}, {"mtl_body", "mtl_face"});
+        newModel.m_parent_list[1] = 0u;
+        newModel.m_model.radius = 2.0f;
+
+        const auto fields = ZoneDiff::CompareRecords(oldModel.Record(helper.m_old_zone), newModel.Record(helper.m_new_zone));
+
+        REQUIRE(PathsOf(fields, DiffChange::MODIFIED) == std::vector<std::string>{"boneNames[2]", "parentList", "materialHandles[1]", "radius"});
+        REQUIRE(PathsOf(fields, DiffChange::ADDED).empty());
+        REQUIRE(PathsOf(fields, DiffChange::REMOVED).empty());
+    }
+
+    TEST_CASE("ZoneDiff: Generated recorder finds added and removed array elements and asset references", "[zone][diff]")
+    {
+        XModelDiffTestHelper helper;
+        XModelDiffTestData oldModel(helper.m_old_zone, {"tag_origin", "j_head"}, {"mtl_body", "mtl_head"});
+        XModelDiffTestData newModel(helper.m_new_zone, {"tag_origin", "j_head", "j_neck"}, {"mtl_body"});
+
+        PhysPreset physPreset{};
+        physPreset.name = "default";
+        oldModel.m_model.physPreset = &physPreset;
+
+        const auto fields = ZoneDiff::CompareRecords(oldModel.Record(helper.m_old_zone), newModel.Record(helper.m_new_zone));
+
+        REQUIRE(PathsOf(fields, DiffChange::ADDED) == std::vector<std::string>{"boneNames[2]"});
+        REQUIRE(PathsOf(fields, DiffChange::REMOVED) == std::vector<std::string>{"materialHandles[1]", "physPreset"});
+        REQUIRE(PathsOf(fields, DiffChange::MODIFIED) == std::vector<std::string>{"numBones", "numsurfs", "parentList"});
+    }
+
+    TEST_CASE("ZoneDiff: Finds added, removed and modified assets of zones", "[zone][diff]")
+    {
+        XModelDiffTestHelper helper;
+        XModelDiffTestData oldModel(helper.m_old_zone, {"tag_origin", "j_head"}, {"mtl_body"});
+        XModelDiffTestData newModel(helper.m_new_zone, {"tag_origin", "j_neck"}, {"mtl_body"});
+        RawFile oldRawFile{};
+        RawFile newRawFile{};
+
+        helper.m_old_zone.m_pools->AddAsset(ASSET_TYPE_XMODEL, "model", &oldModel.m_model, {}, {}, {});
+        helper.m_new_zone.m_pools->AddAsset(ASSET_TYPE_XMODEL, "model", &newModel.m_model, {}, {}, {});
+        helper.m_old_zone.m_pools->AddAsset(ASSET_TYPE_RAWFILE, "removed.cfg", &oldRawFile, {}, {}, {});
+        helper.m_new_zone.m_pools->AddAsset(ASSET_TYPE_RAWFILE, "added.cfg", &newRawFile, {}, {}, {});
+
+        const auto diffs = ZoneDiff::Compare(helper.m_old_zone,
+                                             helper.m_new_zone,
+                                             [](const asset_type_t assetType)
+                                             {
+                                                 return assetType == ASSET_TYPE_XMODEL;
+                                             });
+
+        REQUIRE(diffs.size() == 3u);
+        REQUIRE(diffs[0].m_type == ASSET_TYPE_XMODEL);
+        REQUIRE(diffs[0].m_name == "model");
+        REQUIRE(diffs[0].m_change == DiffChange::MODIFIED);
+        REQUIRE(PathsOf(diffs[0].m_fields, DiffChange::MODIFIED) == std::vector<std::string>{"boneNames[1]"});
+        REQUIRE(diffs[1].m_name == "added.cfg");
+        REQUIRE(diffs[1].m_change == DiffChange::ADDED);
+        REQUIRE(diffs[2].m_name == "removed.cfg");
+        REQUIRE(diffs[2].m_change == DiffChange::REMOVED);
+    }
+} // namespace
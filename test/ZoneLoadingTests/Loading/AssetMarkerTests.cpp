@@ -0,0 +1,103 @@
+#include "Game/IW4/IW4.h"
+#include "Loading/AssetMarker.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+using namespace IW4;
+
+namespace
+{
+    class TestMarker final : public AssetMarker
+    {
+    public:
+        explicit TestMarker(Zone& zone)
+            : AssetMarker(ASSET_TYPE_XMODEL, &zone)
+        {
+        }
+
+        void Depend(XAssetInfoGeneric* assetInfo)
+        {
+            AddDependency(assetInfo);
+        }
+
+        void UseScriptString(const scr_string_t scrString)
+        {
+            Mark_ScriptString(scrString);
+        }
+    };
+
+    class AssetMarkerTestsFixture
+    {
+    public:
+        AssetMarkerTestsFixture()
+            : m_zone("MockZone", 0, IGame::GetGameById(GameId::IW4)),
+              m_material(ASSET_TYPE_MATERIAL, "material", nullptr),
+              m_image(ASSET_TYPE_IMAGE, "image", nullptr)
+        {
+            m_zone.m_script_strings.AddOrGetScriptString("");
+            m_first_string = m_zone.m_script_strings.AddOrGetScriptString("first");
+            m_second_string = m_zone.m_script_strings.AddOrGetScriptString("second");
+        }
+
+        Zone m_zone;
+        XAssetInfoGeneric m_material;
+        XAssetInfoGeneric m_image;
+        scr_string_t m_first_string;
+        scr_string_t m_second_string;
+    };
+
+    TEST_CASE_METHOD(AssetMarkerTestsFixture, "AssetMarker: Adds each dependency once in marking order", "[zone][marking]")
+    {
+        TestMarker marker(m_zone);
+        marker.Depend(&m_image);
+        marker.Depend(&m_material);
+        marker.Depend(&m_image);
+        marker.Depend(nullptr);
+        marker.Depend(&m_material);
+
+        REQUIRE(marker.GetDependencies() == std::vector<XAssetInfoGeneric*>{&m_image, &m_material});
+    }
+
+    TEST_CASE_METHOD(AssetMarkerTestsFixture, "AssetMarker: Adds dependencies that a previous marker already added", "[zone][marking]")
+    {
+        {
+            TestMarker previousMarker(m_zone);
+            previousMarker.Depend(&m_material);
+            previousMarker.UseScriptString(m_first_string);
+        }
+
+        TestMarker marker(m_zone);
+        REQUIRE(marker.GetDependencies().empty());
+        REQUIRE(marker.GetUsedScriptStrings().empty());
+
+        marker.Depend(&m_material);
+        marker.UseScriptString(m_first_string);
+
+        REQUIRE(marker.GetDependencies() == std::vector<XAssetInfoGeneric*>{&m_material});
+        REQUIRE(marker.GetUsedScriptStrings() == std::vector<scr_string_t>{m_first_string});
+    }
+
+    TEST_CASE_METHOD(AssetMarkerTestsFixture, "AssetMarker: Keeps the marks of a marker while a nested marker is alive", "[zone][marking]")
+    {
+        TestMarker marker(m_zone);
+        marker.Depend(&m_material);
+        marker.UseScriptString(m_second_string);
+
+        {
+            TestMarker nestedMarker(m_zone);
+            nestedMarker.Depend(&m_image);
+            nestedMarker.UseScriptString(m_first_string);
+
+            REQUIRE(nestedMarker.GetDependencies() == std::vector<XAssetInfoGeneric*>{&m_image});
+            REQUIRE(nestedMarker.GetUsedScriptStrings() == std::vector<scr_string_t>{m_first_string});
+        }
+
+        marker.Depend(&m_material);
+        marker.UseScriptString(m_second_string);
+        marker.UseScriptString(m_first_string);
+
+        REQUIRE(marker.GetDependencies() == std::vector<XAssetInfoGeneric*>{&m_material});
+        REQUIRE(marker.GetUsedScriptStrings() == std::vector<scr_string_t>{m_first_string, m_second_string});
+    }
+} // namespace